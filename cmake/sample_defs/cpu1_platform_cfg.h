@@ -117,6 +117,39 @@
 */
 #define CFE_PLATFORM_SB_MAX_DEST_PER_PKT 16
 
+/**
+**  \cfesbcfg Maximum Number of Buffers Received in a Batch
+**
+**  \par Description:
+**       Dictates the maximum number of buffers that can be returned by a single
+**       call to #CFE_SB_ReceiveBuffers.  Each pipe keeps a reference to the buffers
+**       returned by the last call until the next receive on that pipe, so this
+**       also sizes the per-pipe table used to hold those references.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.  There are no restrictions on the upper
+**       limit however, each pipe descriptor uses one pointer per entry.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_RECEIVE_BATCH 16
+
+/**
+**  \cfesbcfg Maximum Number of Buffers Transmitted in a Batch
+**
+**  \par Description:
+**       Dictates the maximum number of messages or buffers that can be passed to a
+**       single call to #CFE_SB_TransmitMsgBatch or #CFE_SB_TransmitBufferBatch.  The
+**       buffer descriptors of the whole batch are held on the stack of the calling
+**       task while the batch is sent, and other tasks cannot use the software bus
+**       while a batch is being sent.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.  There are no restrictions on the upper
+**       limit however, each entry uses one pointer of stack in the calling task.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH 16
+
 /**
 **  \cfesbcfg Default Subscription Message Limit
 **
@@ -154,6 +187,63 @@
 */
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Depth of the SB buffer caches
+**
+**  \par Description:
+**       Dictates the maximum number of released message buffers that SB keeps
+**       on hand for each memory pool block size, for reuse by the next message
+**       of a similar size.  Taking a buffer from the cache skips the memory pool
+**       allocation and release entirely.  Cached buffers remain allocated from
+**       the SB memory pool, but are not counted in the memory-in-use statistics.
+**       They are given back to the pool if an allocation would otherwise fail,
+**       and on each housekeeping request for any size that saw no reuse since
+**       the previous request.  The cache hit and miss counts are reported in
+**       the SB statistics packet.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.  The
+**       caches can be disabled via #CFE_PLATFORM_SB_BUFFER_CACHE_MAX_BLOCK_SIZE.
+**
+*/
+#define CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH 8
+
+/**
+**  \cfesbcfg Largest block size held in the SB buffer caches
+**
+**  \par Description:
+**       Message buffers which need a memory pool block larger than this size
+**       are always returned directly to the SB memory pool, and are not cached.
+**       This bounds the amount of pool memory that the caches can hold on to,
+**       to approximately #CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH times the sum of
+**       all SB memory pool block sizes up to and including this size.
+**
+**  \par Limits
+**       This parameter has no lower limit, a value less than the smallest
+**       SB memory pool block size disables the caches.
+**
+*/
+#define CFE_PLATFORM_SB_BUFFER_CACHE_MAX_BLOCK_SIZE 1024
+
+/**
+**  \cfesbcfg Number of SB route locks
+**
+**  \par Description:
+**       Dictates the number of mutexes that SB uses to write messages to pipe
+**       queues.  Each route (message ID) maps to one of these locks.  A message
+**       is written to the queues of its subscribers while holding the lock of
+**       its route rather than the SB global lock, so transmits on routes that
+**       map to different locks do not wait on each other's queue writes.
+**       Holding the route lock also keeps the messages of each route in
+**       sequence count order on every pipe.  Each lock is an OSAL mutex, so
+**       this counts against OS_MAX_MUTEXES.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 32.
+**
+*/
+#define CFE_PLATFORM_SB_ROUTE_LOCKS 8
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -548,6 +638,39 @@
 */
 #define CFE_PLATFORM_ES_SYSTEM_LOG_SIZE 3072
 
+/**
+**  \cfeescfg Define System Log Rate Limit
+**
+**  \par Description:
+**       Defines the number of messages that each task may write to the system
+**       log using CFE_ES_WriteToSysLog() within one rate limit period (see
+**       #CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT_PERIOD_MSEC).  Further messages from the
+**       same task in that period are discarded without being formatted, and are
+**       reported by a single "messages suppressed" line once the task logs
+**       again in a later period.
+**
+**       The limit only applies once the system is operational, so messages
+**       written during startup are never suppressed.  When zero, no rate
+**       limit is applied.
+**
+**  \par Limits
+**       Must be zero or greater.  Each task is tracked separately, which takes
+**       a small record per OSAL task.
+*/
+#define CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT 20
+
+/**
+**  \cfeescfg Define System Log Rate Limit Period
+**
+**  \par Description:
+**       Defines the length in milliseconds of the period over which
+**       #CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT messages are allowed from each task.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT_PERIOD_MSEC 1000
+
 /**
 **  \cfeescfg Define Number of entries in the ES Object table
 **
@@ -929,6 +1052,35 @@
 */
 #define CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE 10000
 
+/**
+**  \cfeescfg Define Size of the Per-Task Performance Data Rings
+**
+**  \par Description:
+**       When nonzero, each task records performance data entries into a ring
+**       of this many entries that only it writes, instead of taking the
+**       performance data mutex for every entry.  The rings are merged into the
+**       performance data buffer, in time stamp order, when the data is written
+**       to a file.  Entries from callers that are not OSAL tasks share one more
+**       ring, which is protected by the mutex.  After a trigger, each ring
+**       stops recording on its own once it holds the entries kept by the
+**       trigger mode.
+**
+**       When zero, every entry is written directly into the performance data
+**       buffer while holding the mutex.
+**
+**  \par Limits
+**       Must be zero or a power of two.  The rings take
+**       (OS_MAX_TASKS + 1) times this many entries of memory, in addition to
+**       the performance data buffer.  Ring contents are not preserved across
+**       a processor reset.
+**
+**       The ES unit tests define this on the compiler command line, so that
+**       both settings are covered.
+*/
+#ifndef CFE_PLATFORM_ES_PERF_TASK_RING_SIZE
+#define CFE_PLATFORM_ES_PERF_TASK_RING_SIZE 0
+#endif
+
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
 **
@@ -1074,6 +1226,18 @@
 */
 #define CFE_PLATFORM_EVS_START_TASK_PRIORITY 61
 
+/**
+**  \cfeescfg Define EVS Asynchronous Event Task Priority
+**
+**  \par Description:
+**       Defines the priority of the EVS child task which sends the events
+**       queued when #CFE_PLATFORM_EVS_ASYNC_RING_SIZE is nonzero.
+**
+**  \par Limits
+**       Not Applicable
+*/
+#define CFE_PLATFORM_EVS_ASYNC_TASK_PRIORITY 62
+
 /**
 **  \cfeescfg Define EVS Task Stack Size
 **
@@ -1089,6 +1253,19 @@
 */
 #define CFE_PLATFORM_EVS_START_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
 
+/**
+**  \cfeescfg Define EVS Asynchronous Event Task Stack Size
+**
+**  \par Description:
+**       Defines the stack size of the EVS child task which sends the events
+**       queued when #CFE_PLATFORM_EVS_ASYNC_RING_SIZE is nonzero.
+**
+**  \par Limits
+**       There is a lower limit of 2048 on this configuration parameter.  The
+**       task formats the port output strings on its stack.
+*/
+#define CFE_PLATFORM_EVS_ASYNC_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
+
 /**
 **  \cfeescfg Define SB Task Priority
 **
@@ -1216,6 +1393,23 @@
 */
 #define CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES 512
 
+/**
+**  \cfeescfg Define Size of the CDS Write Journal
+**
+**  \par Description:
+**       Size, in bytes, of the journal area reserved at the start of the CDS.
+**       Partial block writes made with CFE_ES_CopyToCDSRange() are first stored
+**       in the journal, so a reset part way through the write cannot leave the
+**       block with a CRC that does not match its content.  Ranges larger than
+**       the journal are written as a whole block instead.
+**
+**  \par Limits
+**       There is a lower limit of 16 and the value must be a multiple of 4.
+**       The journal is taken out of the CDS size, and the same amount of RAM
+**       is used as a working buffer.
+*/
+#define CFE_PLATFORM_ES_CDS_JOURNAL_SIZE 512
+
 /**
 **  \cfeescfg Define Number of Processor Resets Before a Power On Reset
 **
@@ -1331,11 +1525,14 @@
 **
 **  \par Description:
 **       Maximum number of events that may be filtered per application.
+**       Filters are found through an index per application, so the time to
+**       send an event does not depend on this value.  Each application uses
+**       an extra 4 bytes of memory per filter for the index.
 **
 **  \par Limits
-**       There are no restrictions on the lower and upper limits however,
-**       the maximum number of event filters is system dependent and should be
-**       verified.
+**       This cannot be greater than 65535.  Otherwise there are no restrictions on
+**       the lower and upper limits however, the maximum number of event filters
+**       is system dependent and should be verified.
 */
 #define CFE_PLATFORM_EVS_MAX_EVENT_FILTERS 8
 
@@ -1431,15 +1628,45 @@
 **  \cfeevscfg Default EVS Message Format Mode
 **
 **  \par Description:
-**       Defines the default message format (long or short) for event messages being
-**       sent to the ground. Choose between #CFE_EVS_MsgFormat_LONG or
-**       #CFE_EVS_MsgFormat_SHORT.
+**       Defines the default message format (long, short or binary) for event messages
+**       being sent to the ground. Choose between #CFE_EVS_MsgFormat_LONG,
+**       #CFE_EVS_MsgFormat_SHORT or #CFE_EVS_MsgFormat_BINARY.
 **
 **  \par Limits
-**       The valid settings are #CFE_EVS_MsgFormat_LONG or #CFE_EVS_MsgFormat_SHORT
+**       The valid settings are #CFE_EVS_MsgFormat_LONG, #CFE_EVS_MsgFormat_SHORT or
+**       #CFE_EVS_MsgFormat_BINARY
 */
 #define CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE CFE_EVS_MsgFormat_LONG
 
+/**
+**  \cfeevscfg Define Size of the Per-Task Asynchronous Event Rings
+**
+**  \par Description:
+**       When nonzero, events sent by applications are queued into a ring of
+**       this many entries that only the sending task writes.  An EVS child
+**       task then does the logging, port output and software bus transmit.
+**       The message text is still formatted by the sending task, as the
+**       format arguments may refer to data that does not outlive the call.
+**
+**       If the ring of the sending task is full, or the sender is not an
+**       OSAL task, the event is sent directly by the caller as when this is
+**       zero.  Such an event may be sent before events from the same task
+**       that are still queued.
+**
+**       When zero, all event processing is done by the sending task.
+**
+**  \par Limits
+**       Must be zero or a power of two.  The rings take OS_MAX_TASKS times
+**       this many entries of memory, each slightly larger than
+**       #CFE_MISSION_EVS_MAX_MESSAGE_LENGTH.
+**
+**       The EVS unit tests define this on the compiler command line, so that
+**       both settings are covered.
+*/
+#ifndef CFE_PLATFORM_EVS_ASYNC_RING_SIZE
+#define CFE_PLATFORM_EVS_ASYNC_RING_SIZE 0
+#endif
+
 /* Platform Configuration Parameters for Table Service (TBL) */
 
 /**
@@ -1484,6 +1711,22 @@
 */
 #define CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE 16384
 
+/**
+**  \cfetblcfg Size of Each Read when Loading a Table from a File
+**
+**  \par Description:
+**       Table images are read from the file in pieces of this many bytes, and the
+**       CRC of each piece is computed right after it is read, while it is still in
+**       the data cache.  This avoids a second pass over the whole table to compute
+**       the CRC once the file has been read.
+**
+**  \par Limits
+**       This must be greater than zero.  Values that are too small increase the
+**       number of file system calls, values larger than the data cache lose the
+**       benefit of computing the CRC while reading.
+*/
+#define CFE_PLATFORM_TBL_LOAD_CHUNK_BYTES 4096
+
 /**
 **  \cfetblcfg Maximum Number of Tables Allowed to be Registered
 **
@@ -1708,4 +1951,33 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Number of extra tasks used to start the startup script entries
+**
+**  \par Description:
+**      The entries in the CFE ES startup script are loaded, and library init
+**      functions are called, by the CFE "main" thread.  This sets the number of
+**      additional tasks which are created to do this alongside the main thread,
+**      so that modules which do not depend on each other can be loaded at the
+**      same time.  The tasks exit once all entries have been started.
+**
+**      An entry may list the names of the entries it depends on after the
+**      standard fields of the startup script, and will only be started once
+**      those have been started.  An entry without such a list depends on all of
+**      the libraries listed before it.
+**
+**      When zero, all entries are started by the main thread, in the order
+**      they are listed in the startup script.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero.  Extra tasks only help if the underlying module
+**       loader can load more than one module at a time.
+**
+**       The ES unit tests define this on the compiler command line, so that
+**       both settings are covered.
+*/
+#ifndef CFE_PLATFORM_ES_STARTUP_WORKERS
+#define CFE_PLATFORM_ES_STARTUP_WORKERS 0
+#endif
+
 #endif /* CPU1_PLATFORM_CFG_H */
@@ -260,11 +260,9 @@
 
 /** \name Checksum/CRC algorithm identifiers */
 /** \{ */
-#define CFE_MISSION_ES_CRC_8  1 /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
-#define CFE_MISSION_ES_CRC_16 2 /**< \brief CRC (16 bit additive - returns 32 bit total) */
-#define CFE_MISSION_ES_CRC_32                                                              \
-    3 /**< \brief CRC (32 bit additive - returns 32 bit total) (Currently not implemented) \
-       */
+#define CFE_MISSION_ES_CRC_8  1 /**< \brief CRC-8/SMBUS (returns 32 bit total) */
+#define CFE_MISSION_ES_CRC_16 2 /**< \brief CRC-16/ARC (returns 32 bit total, sign extended) */
+#define CFE_MISSION_ES_CRC_32 3 /**< \brief CRC-32/ISO-HDLC (returns 32 bit total) */
 /** \} */
 
 /**
@@ -276,7 +274,9 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_MISSION_ES_CRC_16 is supported (see #CFE_MISSION_ES_CRC_16)
+**      Must be one of #CFE_MISSION_ES_CRC_8, #CFE_MISSION_ES_CRC_16 or #CFE_MISSION_ES_CRC_32.
+**      Changing this value means that CRCs saved in the Critical Data Store
+**      by a prior build will no longer match.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_MISSION_ES_CRC_16
 
@@ -351,13 +351,13 @@
 **  \par Limits
 **      Not Applicable
 */
-#define CFE_MISSION_ES_HK_TLM_MSG  0
-#define CFE_MISSION_EVS_HK_TLM_MSG 1
-/* Offset 2 is available */
-#define CFE_MISSION_SB_HK_TLM_MSG     3
-#define CFE_MISSION_TBL_HK_TLM_MSG    4
-#define CFE_MISSION_TIME_HK_TLM_MSG   5
-#define CFE_MISSION_TIME_DIAG_TLM_MSG 6
+#define CFE_MISSION_ES_HK_TLM_MSG            0
+#define CFE_MISSION_EVS_HK_TLM_MSG           1
+#define CFE_MISSION_EVS_BINARY_EVENT_MSG_MSG 2
+#define CFE_MISSION_SB_HK_TLM_MSG            3
+#define CFE_MISSION_TBL_HK_TLM_MSG           4
+#define CFE_MISSION_TIME_HK_TLM_MSG          5
+#define CFE_MISSION_TIME_DIAG_TLM_MSG        6
 
 #define CFE_MISSION_EVS_LONG_EVENT_MSG_MSG  8
 #define CFE_MISSION_EVS_SHORT_EVENT_MSG_MSG 9
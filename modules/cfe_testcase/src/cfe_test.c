@@ -56,8 +56,11 @@ void CFE_TestMain(void)
     ESCDSTestSetup();
     ESMiscTestSetup();
     ESMemPoolTestSetup();
+    ESMemPoolPerformanceTestSetup();
+    ESCrcPerformanceTestSetup();
     FSHeaderTestSetup();
     SBPipeMangSetup();
+    SBPerformanceTestSetup();
     TimeCurrentTestSetup();
 
     /*
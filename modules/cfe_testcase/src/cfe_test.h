@@ -78,8 +78,11 @@ void ESTaskTestSetup(void);
 void ESCDSTestSetup(void);
 void ESMiscTestSetup(void);
 void ESMemPoolTestSetup(void);
+void ESMemPoolPerformanceTestSetup(void);
+void ESCrcPerformanceTestSetup(void);
 void FSHeaderTestSetup(void);
 void SBPipeMangSetup(void);
+void SBPerformanceTestSetup(void);
 void TimeCurrentTestSetup(void);
 
 #endif /* CFE_TEST_H */
@@ -0,0 +1,104 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: es_crc_performance_test.c
+**
+** Purpose:
+**   Functional test of ES CRC calculation throughput
+**
+**   Measures the rate of CFE_ES_CalculateCRC() for each CRC type,
+**   over a buffer in several pieces as is done when loading a large table.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define CFE_TEST_ES_CRC_PERF_BUF_SIZE 65536
+#define CFE_TEST_ES_CRC_PERF_PASSES   64
+
+uint8 CFE_TEST_ESCrcPerfBuf[CFE_TEST_ES_CRC_PERF_BUF_SIZE];
+
+void ESCrcPerfRunType(uint32 TypeCRC, const char *TypeName)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int64     ElapsedUsec;
+    uint32    Crc;
+    uint32    FirstCrc;
+    uint32    i;
+    uint32    Errors;
+
+    /* the whole buffer in one call, for comparison with the pieces below */
+    FirstCrc = CFE_ES_CalculateCRC(CFE_TEST_ESCrcPerfBuf, sizeof(CFE_TEST_ESCrcPerfBuf), 0, TypeCRC);
+
+    Errors = 0;
+    CFE_PSP_GetTime(&StartTime);
+
+    for (i = 0; i < CFE_TEST_ES_CRC_PERF_PASSES; ++i)
+    {
+        /* an odd split, so the second piece does not start on an aligned address */
+        Crc = CFE_ES_CalculateCRC(CFE_TEST_ESCrcPerfBuf, 1001, 0, TypeCRC);
+        Crc = CFE_ES_CalculateCRC(&CFE_TEST_ESCrcPerfBuf[1001], sizeof(CFE_TEST_ESCrcPerfBuf) - 1001, Crc, TypeCRC);
+        if (Crc != FirstCrc)
+        {
+            ++Errors;
+        }
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    if (ElapsedUsec <= 0)
+    {
+        ElapsedUsec = 1;
+    }
+
+    UtAssert_UINT32_EQ(Errors, 0);
+
+    /* bytes per microsecond is the same as (decimal) megabytes per second */
+    UtPrintf("ES CRC %s: %lu bytes in %ld usec, %lu MB/s", TypeName,
+             (unsigned long)(CFE_TEST_ES_CRC_PERF_BUF_SIZE * CFE_TEST_ES_CRC_PERF_PASSES), (long)ElapsedUsec,
+             (unsigned long)(((int64)CFE_TEST_ES_CRC_PERF_BUF_SIZE * CFE_TEST_ES_CRC_PERF_PASSES) / ElapsedUsec));
+}
+
+void TestCalculateCRCThroughput(void)
+{
+    uint32 i;
+
+    UtPrintf("Testing: CFE_ES_CalculateCRC throughput");
+
+    for (i = 0; i < sizeof(CFE_TEST_ESCrcPerfBuf); ++i)
+    {
+        CFE_TEST_ESCrcPerfBuf[i] = (uint8)((i * 131) ^ (i >> 8));
+    }
+
+    ESCrcPerfRunType(CFE_MISSION_ES_CRC_8, "CRC-8");
+    ESCrcPerfRunType(CFE_MISSION_ES_CRC_16, "CRC-16");
+    ESCrcPerfRunType(CFE_MISSION_ES_CRC_32, "CRC-32");
+}
+
+void ESCrcPerformanceTestSetup(void)
+{
+    UtTest_Add(TestCalculateCRCThroughput, NULL, NULL, "Test ES CRC Throughput");
+}
@@ -0,0 +1,110 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: es_mempool_performance_test.c
+**
+** Purpose:
+**   Functional test of ES memory pool allocation latency
+**
+**   Measures the time of CFE_ES_GetPoolBuf()/CFE_ES_PutPoolBuf() pairs
+**   in pools configured with a varying number of block sizes (buckets).
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+/* All pools use the same largest block size, so the same requests fit in every pool */
+#define CFE_TEST_ES_POOL_PERF_MAX_BLOCK  1024
+#define CFE_TEST_ES_POOL_PERF_NUM_SIZES  16
+#define CFE_TEST_ES_POOL_PERF_ITERATIONS 10000
+
+CFE_ES_STATIC_POOL_TYPE(32768) CFE_TEST_ESPoolPerfMem;
+
+void ESPoolPerfRunBuckets(uint16 NumBuckets)
+{
+    CFE_ES_MemHandle_t  PoolID;
+    CFE_ES_MemPoolBuf_t BufPtr;
+    size_t              BlockSizes[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+    size_t              ReqSize;
+    OS_time_t           StartTime;
+    OS_time_t           EndTime;
+    int64               ElapsedUsec;
+    uint32              i;
+    uint32              Errors;
+
+    /* Spread the block sizes evenly up to the largest block, in multiples of 8 */
+    for (i = 0; i < NumBuckets; ++i)
+    {
+        BlockSizes[i] = (((CFE_TEST_ES_POOL_PERF_MAX_BLOCK * (i + 1)) / NumBuckets) + 7) & ~((size_t)7);
+    }
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateEx(&PoolID, CFE_TEST_ESPoolPerfMem.Data, sizeof(CFE_TEST_ESPoolPerfMem),
+                                          NumBuckets, BlockSizes, CFE_ES_NO_MUTEX),
+                      CFE_SUCCESS);
+
+    /*
+     * Cycle through request sizes across the whole range, so every bucket is used.
+     * After the first pass through all the sizes, every get is a recycled block.
+     */
+    Errors = 0;
+    CFE_PSP_GetTime(&StartTime);
+
+    for (i = 0; i < CFE_TEST_ES_POOL_PERF_ITERATIONS; ++i)
+    {
+        ReqSize = ((i % CFE_TEST_ES_POOL_PERF_NUM_SIZES) + 1) *
+                  (CFE_TEST_ES_POOL_PERF_MAX_BLOCK / CFE_TEST_ES_POOL_PERF_NUM_SIZES);
+
+        if (CFE_ES_GetPoolBuf(&BufPtr, PoolID, ReqSize) < 0 || CFE_ES_PutPoolBuf(PoolID, BufPtr) < 0)
+        {
+            ++Errors;
+        }
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+
+    UtAssert_UINT32_EQ(Errors, 0);
+
+    UtPrintf("ES pool get/put: %u bucket(s), %lu pairs in %ld usec, %lu nsec per pair", (unsigned int)NumBuckets,
+             (unsigned long)CFE_TEST_ES_POOL_PERF_ITERATIONS, (long)ElapsedUsec,
+             (unsigned long)((ElapsedUsec * 1000) / CFE_TEST_ES_POOL_PERF_ITERATIONS));
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+}
+
+void TestPoolAllocationLatency(void)
+{
+    UtPrintf("Testing: CFE_ES_GetPoolBuf/CFE_ES_PutPoolBuf latency");
+
+    ESPoolPerfRunBuckets(1);
+    ESPoolPerfRunBuckets(4);
+    ESPoolPerfRunBuckets(8);
+    ESPoolPerfRunBuckets(CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+}
+
+void ESMemPoolPerformanceTestSetup(void)
+{
+    UtTest_Add(TestPoolAllocationLatency, NULL, NULL, "Test ES Pool Allocation Latency");
+}
@@ -35,7 +35,8 @@
 
 void TestCalculateCRC(void)
 {
-    const char *Data = "Random Stuff";
+    const char *Data      = "Random Stuff";
+    const char *CheckData = "123456789";
     uint8       Data2[12];
     uint32      expectedCrc      = 20824;
     uint32      inputCrc         = 345353;
@@ -48,8 +49,10 @@ void TestCalculateCRC(void)
     memset(Data2, 1, sizeof(Data2));
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data2, sizeof(Data2), inputCrc, CFE_MISSION_ES_CRC_16), expectedBlockCrc);
 
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_8), 0);
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_32), 0);
+    /* check values from the definition of each algorithm */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CheckData, strlen(CheckData), 0, CFE_MISSION_ES_CRC_8), 0xF4);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CheckData, strlen(CheckData), 0, CFE_MISSION_ES_CRC_16), 0xFFFFBB3D);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CheckData, strlen(CheckData), 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
 
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(NULL, sizeof(Data), expectedCrc, CFE_MISSION_ES_CRC_16), expectedCrc);
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(Data, 0, expectedBlockCrc, CFE_MISSION_ES_CRC_16), expectedBlockCrc);
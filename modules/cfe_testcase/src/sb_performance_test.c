@@ -0,0 +1,217 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_performance_test.c
+**
+** Purpose:
+**   Functional test of SB transmit throughput
+**
+**   Measures the rate of CFE_SB_TransmitMsg() calls with a varying
+**   number of publisher tasks sending to a single subscriber.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_msgids.h"
+
+/* Message ID used for the throughput test, not used by any CFE core app */
+#define CFE_TEST_SB_PERF_TLM_MID (CFE_PLATFORM_TLM_MID_BASE + 0x7F)
+
+#define CFE_TEST_SB_PERF_MAX_PUBLISHERS 4
+#define CFE_TEST_SB_PERF_MSGS_PER_PUB   10000
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader;
+    uint32                    Sequence;
+} CFE_TEST_SBPerfMsg_t;
+
+typedef struct
+{
+    CFE_ES_TaskId_t TaskId;
+    uint32          SendCount;
+    uint32          SendErrors;
+    OS_time_t       EndTime;
+    volatile bool   Done;
+} CFE_TEST_SBPerfPublisher_t;
+
+typedef struct
+{
+    volatile bool              Go;
+    volatile uint32            NextIndex;
+    volatile bool              IndexTaken;
+    CFE_TEST_SBPerfPublisher_t Publisher[CFE_TEST_SB_PERF_MAX_PUBLISHERS];
+} CFE_TEST_SBPerfState_t;
+
+CFE_TEST_SBPerfState_t CFE_TEST_SBPerfState;
+
+void SBPerfPublisherTask(void)
+{
+    CFE_TEST_SBPerfMsg_t        Msg;
+    CFE_TEST_SBPerfPublisher_t *PubPtr;
+    uint32                      i;
+
+    /* pick up the slot assigned by the parent task */
+    PubPtr                          = &CFE_TEST_SBPerfState.Publisher[CFE_TEST_SBPerfState.NextIndex];
+    CFE_TEST_SBPerfState.IndexTaken = true;
+
+    CFE_MSG_Init(&Msg.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_TEST_SB_PERF_TLM_MID), sizeof(Msg));
+
+    while (!CFE_TEST_SBPerfState.Go)
+    {
+        OS_TaskDelay(1);
+    }
+
+    for (i = 0; i < CFE_TEST_SB_PERF_MSGS_PER_PUB; ++i)
+    {
+        Msg.Sequence = i;
+        if (CFE_SB_TransmitMsg(&Msg.TlmHeader.Msg, true) == CFE_SUCCESS)
+        {
+            ++PubPtr->SendCount;
+        }
+        else
+        {
+            ++PubPtr->SendErrors;
+        }
+    }
+
+    CFE_PSP_GetTime(&PubPtr->EndTime);
+    PubPtr->Done = true;
+
+    CFE_ES_ExitChildTask();
+}
+
+void SBPerfRunPublishers(uint32 NumPublishers)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_Buffer_t *BufPtr;
+    char             TaskName[OS_MAX_API_NAME];
+    OS_time_t        StartTime;
+    OS_time_t        EndTime;
+    int64            ElapsedUsec;
+    uint32           i;
+    uint32           TotalSent;
+    uint32           TotalErrors;
+    uint32           RecvCount;
+    bool             AllDone;
+    int32            Status;
+
+    memset(&CFE_TEST_SBPerfState, 0, sizeof(CFE_TEST_SBPerfState));
+
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId, OS_QUEUE_MAX_DEPTH, "SB Perf Pipe"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_SubscribeEx(CFE_SB_ValueToMsgId(CFE_TEST_SB_PERF_TLM_MID), PipeId, CFE_SB_DEFAULT_QOS,
+                                         OS_QUEUE_MAX_DEPTH),
+                      CFE_SUCCESS);
+
+    for (i = 0; i < NumPublishers; ++i)
+    {
+        /* names are unique per run, as children from a prior run may still be exiting */
+        snprintf(TaskName, sizeof(TaskName), "SB_PERF_%u_%u", (unsigned int)NumPublishers, (unsigned int)i);
+
+        CFE_TEST_SBPerfState.NextIndex  = i;
+        CFE_TEST_SBPerfState.IndexTaken = false;
+        UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&CFE_TEST_SBPerfState.Publisher[i].TaskId, TaskName,
+                                                 SBPerfPublisherTask, CFE_ES_TASK_STACK_ALLOCATE,
+                                                 CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE,
+                                                 CFE_PLATFORM_ES_PERF_CHILD_PRIORITY, 0),
+                          CFE_SUCCESS);
+
+        /* wait for the child to pick up its slot before creating the next one */
+        while (!CFE_TEST_SBPerfState.IndexTaken)
+        {
+            OS_TaskDelay(1);
+        }
+    }
+
+    /*
+     * Release all publishers at once, and drain the pipe while they run.
+     * Messages which overflow the pipe are dropped by SB, but are still
+     * counted as transmitted, as the transmit path is what is being measured.
+     */
+    RecvCount = 0;
+    CFE_PSP_GetTime(&StartTime);
+    CFE_TEST_SBPerfState.Go = true;
+
+    do
+    {
+        AllDone = true;
+        for (i = 0; i < NumPublishers; ++i)
+        {
+            AllDone = AllDone && CFE_TEST_SBPerfState.Publisher[i].Done;
+        }
+
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, PipeId, 10);
+        if (Status == CFE_SUCCESS)
+        {
+            ++RecvCount;
+        }
+    } while (!AllDone || Status == CFE_SUCCESS);
+
+    TotalSent   = 0;
+    TotalErrors = 0;
+    EndTime     = StartTime;
+    for (i = 0; i < NumPublishers; ++i)
+    {
+        TotalSent += CFE_TEST_SBPerfState.Publisher[i].SendCount;
+        TotalErrors += CFE_TEST_SBPerfState.Publisher[i].SendErrors;
+        if (OS_TimeGetTotalMicroseconds(OS_TimeSubtract(CFE_TEST_SBPerfState.Publisher[i].EndTime, EndTime)) > 0)
+        {
+            EndTime = CFE_TEST_SBPerfState.Publisher[i].EndTime;
+        }
+    }
+
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    if (ElapsedUsec <= 0)
+    {
+        ElapsedUsec = 1;
+    }
+
+    UtAssert_UINT32_EQ(TotalErrors, 0);
+    UtAssert_UINT32_EQ(TotalSent, NumPublishers * CFE_TEST_SB_PERF_MSGS_PER_PUB);
+    UtAssert_True(RecvCount <= TotalSent, "Received (%lu) <= Sent (%lu)", (unsigned long)RecvCount,
+                  (unsigned long)TotalSent);
+
+    UtPrintf("SB transmit: %u publisher(s), %lu msgs in %ld usec, %lu msgs/sec, %lu received",
+             (unsigned int)NumPublishers, (unsigned long)TotalSent, (long)ElapsedUsec,
+             (unsigned long)(((int64)TotalSent * 1000000) / ElapsedUsec), (unsigned long)RecvCount);
+
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId), CFE_SUCCESS);
+}
+
+void TestTransmitMsgThroughput(void)
+{
+    uint32 NumPublishers;
+
+    UtPrintf("Testing: CFE_SB_TransmitMsg throughput");
+
+    for (NumPublishers = 1; NumPublishers <= CFE_TEST_SB_PERF_MAX_PUBLISHERS; NumPublishers *= 2)
+    {
+        SBPerfRunPublishers(NumPublishers);
+    }
+}
+
+void SBPerformanceTestSetup(void)
+{
+    UtTest_Add(TestTransmitMsgThroughput, NULL, NULL, "Test SB Transmit Throughput");
+}
@@ -617,6 +617,15 @@ typedef int32 CFE_Status_t;
  */
 #define CFE_ES_ERR_DUPLICATE_NAME ((CFE_Status_t)0xc400002E)
 
+/**
+ * @brief System Log Message Suppressed
+ *
+ *  This information code means the message was not written to the syslog
+ *  because the calling task has exceeded its syslog rate limit.
+ *
+ */
+#define CFE_ES_ERR_SYS_LOG_SUPPRESSED ((CFE_Status_t)0x4400002F)
+
 /**
  * @brief Not Implemented
  *
@@ -943,15 +943,19 @@ void CFE_ES_BackgroundWakeup(void);
 **        critical errors, and conditionally compiled debug software.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        Once the system is operational, each task may only write a limited
+**        number of messages per period (see #CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT).
+**        Messages over the limit are discarded, and the number discarded is
+**        logged the next time the task writes a message after the period ends.
 **
 ** \param[in]   SpecStringPtr     The format string for the log message.
 **                                This is similar to the format string for a printf() call.
 **
 ** \return Execution status, see \ref CFEReturnCodes
-** \retval #CFE_SUCCESS             \copybrief CFE_SUCCESS
-** \retval #CFE_ES_ERR_SYS_LOG_FULL \copybrief CFE_ES_ERR_SYS_LOG_FULL
-** \retval #CFE_ES_BAD_ARGUMENT     \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_SUCCESS                   \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_SYS_LOG_FULL       \copybrief CFE_ES_ERR_SYS_LOG_FULL
+** \retval #CFE_ES_ERR_SYS_LOG_SUPPRESSED \copybrief CFE_ES_ERR_SYS_LOG_SUPPRESSED
+** \retval #CFE_ES_BAD_ARGUMENT           \copybrief CFE_ES_BAD_ARGUMENT
 **
 ******************************************************************************/
 CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2);
@@ -976,21 +980,68 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 **                          a single value.  Nominally, the user should set this value to zero.
 **
 ** \param[in]   TypeCRC     One of the following CRC algorithm selections:
-**                          \arg \c CFE_MISSION_ES_CRC_8 -  (Not currently implemented)
+**                          \arg \c CFE_MISSION_ES_CRC_8 - CRC-8/SMBUS <BR>
+**                                  Polynomial: 0x07 <BR>
+**                                  Initialization: 0x00 <BR>
+**                                  Reflect Input/Output: false <BR>
+**                                  XorOut: 0x00
 **                          \arg \c CFE_MISSION_ES_CRC_16 - CRC-16/ARC <BR>
 **                                  Polynomial: 0x8005 <BR>
 **                                  Initialization: 0x0000 <BR>
 **                                  Reflect Input/Output: true <BR>
-**                                  XorOut: 0x0000
-**                          \arg \c CFE_MISSION_ES_CRC_32 - (not currently implemented)
+**                                  XorOut: 0x0000 <BR>
+**                                  The result is sign extended from 16 bits
+**                          \arg \c CFE_MISSION_ES_CRC_32 - CRC-32/ISO-HDLC <BR>
+**                                  Polynomial: 0x04C11DB7 <BR>
+**                                  Initialization: 0xFFFFFFFF <BR>
+**                                  Reflect Input/Output: true <BR>
+**                                  XorOut: 0xFFFFFFFF
 **
 ** \return The result of the CRC calculation on the specified memory block.
+**         Passing this as the InputCRC of a call on the next block gives the same
+**         result as a single call on both blocks, for all CRC types.
 **         If the TypeCRC is unimplemented will return 0.
 **         If DataPtr is null or DataLength is 0, will return InputCRC
 **
 ******************************************************************************/
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC);
 
+/*****************************************************************************/
+/**
+** \ingroup CFEAPIESMisc
+** \brief Update a CRC for a change to part of a block of memory
+**
+** \par Description
+**        Given the CRC of a block of memory, as returned by #CFE_ES_CalculateCRC with an
+**        InputCRC of zero, this routine returns the CRC of the same block after a range
+**        within it has been changed.  Only the changed range is read, so the cost does
+**        not depend on the size of the rest of the block.
+**
+** \par Assumptions, External Events, and Notes:
+**        Both the old and the new contents of the changed range must be supplied.
+**
+** \param[in]   InputCRC        The CRC of the whole block before the change.
+**
+** \param[in]   OldDataPtr      Pointer to the contents of the changed range before the change.
+**
+** \param[in]   NewDataPtr      Pointer to the contents of the changed range after the change.
+**
+** \param[in]   DataLength      The number of bytes in the changed range.
+**
+** \param[in]   TrailingLength  The number of bytes in the block after the end of the changed range.
+**
+** \param[in]   TypeCRC         The CRC algorithm, as for #CFE_ES_CalculateCRC.
+**
+** \return The CRC of the whole block after the change.
+**         If the TypeCRC is unimplemented will return 0.
+**         If OldDataPtr or NewDataPtr is null or DataLength is 0, will return InputCRC
+**
+** \sa #CFE_ES_CalculateCRC
+**
+******************************************************************************/
+uint32 CFE_ES_UpdateCRC(uint32 InputCRC, const void *OldDataPtr, const void *NewDataPtr, size_t DataLength,
+                        size_t TrailingLength, uint32 TypeCRC);
+
 /*****************************************************************************/
 /**
 ** \ingroup CFEAPIESMisc
@@ -1133,6 +1184,45 @@ CFE_Status_t CFE_ES_GetCDSBlockName(char *BlockName, CFE_ES_CDSHandle_t BlockId,
 */
 CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save a changed range of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine updates part of a CDS block that had been previously registered via
+**        #CFE_ES_RegisterCDS.  Only the range of \c Size bytes starting at \c Offset within
+**        \c DataToCopy is written, and the integrity check of the block is updated from the
+**        old and new content of that range, so the cost depends on the size of the change
+**        rather than the size of the block.  This suits applications that save their state
+**        every cycle but only change a small part of it each time.
+**
+** \par Assumptions, External Events, and Notes:
+**        \c DataToCopy points to the whole block content, as for #CFE_ES_CopyToCDS, not to the
+**        start of the range.
+**
+**        The change is first stored in a write journal, so if a reset occurs part way
+**        through, the block is restored with either its old or its new content.  A range
+**        larger than #CFE_PLATFORM_ES_CDS_JOURNAL_SIZE is saved by writing the whole block,
+**        exactly as #CFE_ES_CopyToCDS does.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   DataToCopy   A Pointer to the block of memory holding the new content of the CDS.
+**
+** \param[in]   Offset       The offset of the changed range within the block.
+**
+** \param[in]   Size         The number of bytes in the changed range.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
@@ -53,7 +53,12 @@ enum CFE_EVS_MsgFormat
     /**
      * @brief Long Format Messages
      */
-    CFE_EVS_MsgFormat_LONG = 1
+    CFE_EVS_MsgFormat_LONG = 1,
+
+    /**
+     * @brief Binary Format Messages
+     */
+    CFE_EVS_MsgFormat_BINARY = 2
 };
 
 /**
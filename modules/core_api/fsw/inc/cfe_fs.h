@@ -295,6 +295,9 @@ CFE_Status_t CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *File
 **        must persist and be accessible by the file writer task throughout the asynchronous
 **        job operation.
 **
+**        If the \c Compress member of the metadata is set, the file data is compressed
+**        as it is written.  See #CFE_FS_SUBTYPE_COMPRESSED_FLAG for the file format.
+**
 ** \param[inout] Meta        The background file write persistent state object
 **
 ** \return Execution status, see \ref CFEReturnCodes
@@ -37,6 +37,16 @@
 #include "osconfig.h"
 #include "cfe_fs_extern_typedefs.h"
 
+/**
+ * \brief Flag in the FS header SubType indicating compressed file data
+ *
+ * Set in the SubType of files written by the background file writer when
+ * CFE_FS_FileWriteMetaData_t::Compress is set.  The remaining bits of the
+ * SubType are the original value.  The data following the FS header is
+ * a series of blocks, each beginning with a #CFE_FS_CompressedBlockHeader_t.
+ */
+#define CFE_FS_SUBTYPE_COMPRESSED_FLAG 0x80000000
+
 /**
  * \brief Generalized file types/categories known to FS
  *
@@ -116,6 +126,8 @@ typedef struct CFE_FS_FileWriteMetaData
     CFE_FS_FileWriteGetData_t GetData; /**< Application callback to get a data record */
     CFE_FS_FileWriteOnEvent_t OnEvent; /**< Application callback for abstract event processing */
 
+    bool Compress; /**< Whether to compress the file data, see #CFE_FS_SUBTYPE_COMPRESSED_FLAG */
+
 } CFE_FS_FileWriteMetaData_t;
 
 #endif /* CFE_FS_API_TYPEDEFS_H */
@@ -221,6 +221,21 @@ typedef struct CFE_FS_Header
 
 } CFE_FS_Header_t;
 
+/**
+** \brief Header preceding each block of data in a compressed file
+**
+** The block data is in the LZ4 block format, unless both sizes are equal,
+** in which case the data did not compress and is stored as-is.  Each block
+** decodes to at most the size of the writer's staging buffer.
+**
+** As with the FS header, these fields are always big endian in the file.
+*/
+typedef struct CFE_FS_CompressedBlockHeader
+{
+    uint32 CompressedSize;   /**< \brief Size of the block data in the file, not including this header */
+    uint32 UncompressedSize; /**< \brief Size of the block data once decompressed */
+} CFE_FS_CompressedBlockHeader_t;
+
 #endif /* CFE_EDS_ENABLED_BUILD */
 
 #endif /* CFE_FS_EXTERN_TYPEDEFS_H */
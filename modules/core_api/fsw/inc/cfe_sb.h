@@ -425,6 +425,44 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 **/
 CFE_Status_t CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount);
 
+/*****************************************************************************/
+/**
+** \brief Transmit a batch of messages
+**
+** \par Description
+**          This routine is equivalent to calling #CFE_SB_TransmitMsg for each of
+**          the specified messages in order, but the software bus shared data is
+**          locked only once for the entire batch.  Applications which generate
+**          many messages at the same time (such as a set of housekeeping packets)
+**          can use this to reduce the per-message overhead.
+**
+** \par Assumptions, External Events, and Notes:
+**          - All messages in the batch are validated before any are sent.  If
+**            any message fails validation, none of the messages are sent.
+**          - Once validated, the software bus will attempt to send every message
+**            in the batch, even if sending one of them fails.  In this case the
+**            status of the first failure is returned.
+**          - To limit the event traffic, at most one "no subscribers" or buffer
+**            allocation failure event is generated per batch.  The associated
+**            housekeeping counters are incremented for every message.
+**          - Other tasks are blocked from using the software bus while the batch
+**            is being sent, so Count is limited to #CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH.
+**
+** \param[in] MsgPtrs                An array of pointers to the messages to be sent.
+**                                   Each must point to the first byte of the message header.
+** \param[in] Count                  The number of entries in MsgPtrs
+** \param[in] IncrementSequenceCount Boolean to increment the internally tracked
+**                                   sequence count and update the message if the
+**                                   buffer contains a telemetry message
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_TransmitMsgBatch(CFE_MSG_Message_t *MsgPtrs[], uint32 Count, bool IncrementSequenceCount);
+
 /*****************************************************************************/
 /**
 ** \brief Receive a message from a software bus pipe
@@ -465,6 +503,52 @@ CFE_Status_t CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenc
 ** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Receive a batch of messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to MaxCount pending messages from the specified
+**          pipe in a single call.  If the pipe is empty, this routine will block until
+**          either a new message comes in or the timeout value is reached.  Once at
+**          least one message is available, any other messages already pending on the
+**          pipe are returned as well, without waiting for more to arrive.
+**
+** \par Assumptions, External Events, and Notes:
+**          - The returned buffers are valid only until the next call to
+**            CFE_SB_ReceiveBuffers or CFE_SB_ReceiveBuffer for the same pipe.  All of
+**            them are released together at that time.
+**          - MaxCount is limited to #CFE_PLATFORM_SB_MAX_RECEIVE_BATCH.
+**          - This is intended for applications that process a large number of
+**            messages on each wakeup, as it reduces the per-message overhead.
+**
+** \param[out] BufPtrs     An array of at least MaxCount buffer pointers.  On success
+**                         the first *CountPtr entries point to the received messages,
+**                         in the order they were sent to the pipe.  These should be
+**                         used as read-only pointers.
+**
+** \param[in]  MaxCount    The maximum number of messages to receive
+**
+** \param[out] CountPtr    Set to the number of messages received, which is 0 if
+**                         this function does not return CFE_SUCCESS.
+**
+** \param[in]  PipeId      The pipe ID of the pipe containing the messages to be obtained.
+**
+** \param[in]  TimeOut     The number of milliseconds to wait for a new message if the
+**                         pipe is empty at the time of the call.  This can also be set
+**                         to #CFE_SB_POLL for a non-blocking receive or
+**                         #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**/
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t *BufPtrs[], uint32 MaxCount, uint32 *CountPtr,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut);
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -567,6 +651,83 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 **/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount);
 
+/*****************************************************************************/
+/**
+** \brief Transmit a batch of buffers
+**
+** \par Description
+**          This routine is equivalent to calling #CFE_SB_TransmitBuffer for each of
+**          the specified buffers in order, but the software bus shared data is
+**          locked only once for the entire batch.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# All buffers in the batch are validated before any are sent.  If this
+**             function fails (returns any error status) none of the buffers are
+**             consumed, and the calling application still owns all of them.
+**          -# If this function returns CFE_SUCCESS, all of the buffers are now owned
+**             by software bus, and must not be de-referenced or re-used.
+**          -# Each buffer must appear in the batch only once.  A batch that lists the
+**             same buffer more than once is rejected with #CFE_SB_BAD_ARGUMENT.
+**          -# Count is limited to #CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH.
+**          -# To limit the event traffic, at most one "no subscribers" event is
+**             generated per batch.  The associated housekeeping counter is
+**             incremented for every message.
+**
+** \param[in] BufPtrs                An array of pointers to the buffers to be sent.
+** \param[in] Count                  The number of entries in BufPtrs
+** \param[in] IncrementSequenceCount Boolean to increment the internally tracked
+**                                   sequence count and update the message if the
+**                                   buffer contains a telemetry message
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+** \retval #CFE_SB_MSG_TOO_BIG    \copybrief CFE_SB_MSG_TOO_BIG
+**/
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *BufPtrs[], uint32 Count, bool IncrementSequenceCount);
+
+/*****************************************************************************/
+/**
+** \brief Compose the header of a buffer in place, and transmit it
+**
+** \par Description
+**          This routine sends a message whose payload has been filled in directly
+**          in an internal SB message buffer by an application (after a call to
+**          #CFE_SB_AllocateMessageBuffer), without the application initializing the
+**          message header.  The software bus composes the header in place in the buffer,
+**          for the given message ID and size, and then transmits the buffer as
+**          #CFE_SB_TransmitBuffer does.  The payload is never copied.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The header is composed according to the message type of the MsgId.
+**             The payload must be placed directly after a command header or telemetry
+**             header accordingly, i.e. the buffer must be laid out as the application's
+**             own command or telemetry packet structure.
+**          -# Only the header is written, the payload content is not modified.
+**          -# Telemetry messages are time stamped with the current spacecraft time, as
+**             by #CFE_SB_TimeStampMsg.
+**          -# The buffer ownership rules are the same as #CFE_SB_TransmitBuffer.  If this
+**             function fails, the calling application still owns the buffer, although the
+**             header may have been modified.
+**
+** \param[in] BufPtr                 A pointer to the buffer to be sent.
+** \param[in] MsgId                  The message ID to put in the header.
+** \param[in] Size                   The total size of the message, including the header.
+**                                   This must not be larger than the size allocated.
+** \param[in] IncrementSequenceCount Boolean to increment the internally tracked
+**                                   sequence count and update the message if the
+**                                   buffer contains a telemetry message
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+** \retval #CFE_SB_MSG_TOO_BIG    \copybrief CFE_SB_MSG_TOO_BIG
+**/
+CFE_Status_t CFE_SB_TransferBuffer(CFE_SB_Buffer_t *BufPtr, CFE_SB_MsgId_t MsgId, size_t Size,
+                                   bool IncrementSequenceCount);
+
 /** @} */
 
 /** @defgroup CFEAPISBSetMessage cFE Setting Message Characteristics APIs
@@ -613,6 +774,27 @@ void CFE_SB_SetUserDataLength(CFE_MSG_Message_t *MsgPtr, size_t DataLength);
 **/
 void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr);
 
+/*****************************************************************************/
+/**
+** \brief Sets the time field in a group of software bus messages with the current spacecraft time.
+**
+** \par Description
+**          This routine sets the time of each message in the group to the same
+**          current spacecraft time, as #CFE_SB_TimeStampMsg does for a single
+**          message.  The time is only read once for the whole group.
+**
+** \par Assumptions, External Events, and Notes:
+**          - NULL entries in the array are skipped.
+**          - If the underlying implementation of software bus messages does not
+**            include a time field, then this routine will do nothing.
+**
+** \param[in]  MsgPtrs     An array of pointers to the software bus messages.
+**                         Each must point to the first byte of the message header.
+**
+** \param[in]  Count       The number of entries in the MsgPtrs array.
+**/
+void CFE_SB_TimeStampMsgs(CFE_MSG_Message_t *MsgPtrs[], uint32 Count);
+
 /******************************************************************************/
 /**
 ** \brief Copies a string into a software bus message
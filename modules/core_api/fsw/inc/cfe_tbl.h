@@ -152,6 +152,17 @@
 **                                                                 quick and it could be blocked.  Therefore, critical
 **                                                                 tables should not be updated by Interrupt Service
 **                                                                 Routines.
+**                                 \arg #CFE_TBL_OPT_FULL_COPY -   When this option is selected, the contents of the
+**                                                                 whole active table are copied into the working
+**                                                                 buffer before each load.  This is the default.
+**                                 \arg #CFE_TBL_OPT_CHANGED_COPY- When this option is selected, loads only copy
+**                                                                 the range of the active table which has changed
+**                                                                 since the working buffer last matched it, and the
+**                                                                 CRC of a partial load is updated from the CRC of
+**                                                                 the active table.  The Application must call
+**                                                                 #CFE_TBL_Modified after every change it makes to
+**                                                                 the table through #CFE_TBL_GetAddress, or the
+**                                                                 change can be lost by the next load.
 **
 ** \param[in] TblValidationFuncPtr is a pointer to a function that will be executed in the context of the Table
 **                                 Management Service when the contents of a table need to be validated.  If set
@@ -617,6 +628,72 @@ CFE_Status_t CFE_TBL_GetAddresses(void **TblPtrs[], uint16 NumTables, const CFE_
 **
 ******************************************************************************/
 CFE_Status_t CFE_TBL_ReleaseAddresses(uint16 NumTables, const CFE_TBL_Handle_t TblHandles[]);
+
+/*****************************************************************************/
+/**
+** \brief Obtain the current address of a table without validating the caller
+**
+** \par Description
+**        Provides the same result as #CFE_TBL_GetAddress, for use in code that reads a
+**        table on every cycle.  The calling application is not looked up through ES, so
+**        this call does not take any ES or TBL lock, and does not block when the table
+**        is being updated.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The handle is only checked to be in use.  It is the responsibility of the
+**           caller to only use handles it obtained from #CFE_TBL_Register or #CFE_TBL_Share.
+**        -# The address must be released with #CFE_TBL_ReleaseSnapshot (or #CFE_TBL_ReleaseAddress)
+**           under the same conditions as an address obtained by #CFE_TBL_GetAddress.
+**        -# A double buffered table can be loaded while a snapshot is held.  The snapshot
+**           keeps the previous contents, and the next load of the table waits until it is
+**           released.
+**        -# Errors are returned to the caller but are not written to the system log.
+**
+** \param[in, out]  TblPtr     The address of a pointer that will be loaded with the address of the first byte
+**                             of table data.  This pointer can then be typecast by the calling application to the
+**                             appropriate table data structure. *TblPtr is the address of the first byte of data
+**                             associated with the specified table.
+**
+** \param[in]  TblHandle      Table handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                             identifies the Table whose address is to be returned.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_INFO_UPDATED       \copybrief CFE_TBL_INFO_UPDATED
+** \retval #CFE_TBL_ERR_INVALID_HANDLE \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_UNREGISTERED   \copybrief CFE_TBL_ERR_UNREGISTERED
+** \retval #CFE_TBL_ERR_NEVER_LOADED   \copybrief CFE_TBL_ERR_NEVER_LOADED
+** \retval #CFE_TBL_BAD_ARGUMENT       \copybrief CFE_TBL_BAD_ARGUMENT
+**
+** \sa #CFE_TBL_ReleaseSnapshot, #CFE_TBL_GetAddress
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_SnapshotAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle);
+
+/*****************************************************************************/
+/**
+** \brief Release a table address obtained by #CFE_TBL_SnapshotAddress
+**
+** \par Description
+**        Releases the table address so the table can be updated.  As with
+**        #CFE_TBL_SnapshotAddress, the calling application is not validated.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in] TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                       identifies the Table whose address is to be released.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_INFO_UPDATED       \copybrief CFE_TBL_INFO_UPDATED
+** \retval #CFE_TBL_ERR_INVALID_HANDLE \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_NEVER_LOADED   \copybrief CFE_TBL_ERR_NEVER_LOADED
+**
+** \sa #CFE_TBL_SnapshotAddress
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_ReleaseSnapshot(CFE_TBL_Handle_t TblHandle);
 /**@}*/
 
 /** @defgroup CFEAPITBLInfo cFE Get Table Information APIs
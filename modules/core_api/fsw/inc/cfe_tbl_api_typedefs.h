@@ -63,6 +63,10 @@
 #define CFE_TBL_OPT_NOT_CRITICAL (0x0000) /**< \brief Not critical table */
 #define CFE_TBL_OPT_CRITICAL     (0x0008) /**< \brief Critical table */
 
+#define CFE_TBL_OPT_COPY_MSK     (0x0010) /**< \brief Table load copy mask */
+#define CFE_TBL_OPT_FULL_COPY    (0x0000) /**< \brief Loads copy the whole active table */
+#define CFE_TBL_OPT_CHANGED_COPY (0x0010) /**< \brief Loads copy only the changed range of the active table */
+
 /** @brief Default table options */
 #define CFE_TBL_OPT_DEFAULT (CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP)
 /**@}*/
@@ -110,6 +110,25 @@ CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return UT_GenStub_GetReturnValue(CFE_ES_CopyToCDS, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CopyToCDSRange()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_CopyToCDSRange, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, CFE_ES_CDSHandle_t, Handle);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, const void *, DataToCopy);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, size_t, Offset);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, size_t, Size);
+
+    UT_GenStub_Execute(CFE_ES_CopyToCDSRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_CopyToCDSRange, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_CounterID_ToIndex()
@@ -907,6 +926,28 @@ CFE_Status_t CFE_ES_TaskID_ToIndex(CFE_ES_TaskId_t TaskID, uint32 *Idx)
     return UT_GenStub_GetReturnValue(CFE_ES_TaskID_ToIndex, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_UpdateCRC()
+ * ----------------------------------------------------
+ */
+uint32 CFE_ES_UpdateCRC(uint32 InputCRC, const void *OldDataPtr, const void *NewDataPtr, size_t DataLength,
+                        size_t TrailingLength, uint32 TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_UpdateCRC, uint32);
+
+    UT_GenStub_AddParam(CFE_ES_UpdateCRC, uint32, InputCRC);
+    UT_GenStub_AddParam(CFE_ES_UpdateCRC, const void *, OldDataPtr);
+    UT_GenStub_AddParam(CFE_ES_UpdateCRC, const void *, NewDataPtr);
+    UT_GenStub_AddParam(CFE_ES_UpdateCRC, size_t, DataLength);
+    UT_GenStub_AddParam(CFE_ES_UpdateCRC, size_t, TrailingLength);
+    UT_GenStub_AddParam(CFE_ES_UpdateCRC, uint32, TypeCRC);
+
+    UT_GenStub_Execute(CFE_ES_UpdateCRC, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_UpdateCRC, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_WaitForStartupSync()
@@ -269,6 +269,27 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBuffers()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t *BufPtrs[], uint32 MaxCount, uint32 *CountPtr,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBuffers, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, CFE_SB_Buffer_t **, BufPtrs);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, uint32, MaxCount);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, uint32 *, CountPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBuffers, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffers, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_ReleaseMessageBuffer()
@@ -381,6 +402,39 @@ void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr)
     UT_GenStub_Execute(CFE_SB_TimeStampMsg, Basic, UT_DefaultHandler_CFE_SB_TimeStampMsg);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TimeStampMsgs()
+ * ----------------------------------------------------
+ */
+void CFE_SB_TimeStampMsgs(CFE_MSG_Message_t *MsgPtrs[], uint32 Count)
+{
+    UT_GenStub_AddParam(CFE_SB_TimeStampMsgs, CFE_MSG_Message_t **, MsgPtrs);
+    UT_GenStub_AddParam(CFE_SB_TimeStampMsgs, uint32, Count);
+
+    UT_GenStub_Execute(CFE_SB_TimeStampMsgs, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransferBuffer()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransferBuffer(CFE_SB_Buffer_t *BufPtr, CFE_SB_MsgId_t MsgId, size_t Size,
+                                   bool IncrementSequenceCount)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransferBuffer, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransferBuffer, CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(CFE_SB_TransferBuffer, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_TransferBuffer, size_t, Size);
+    UT_GenStub_AddParam(CFE_SB_TransferBuffer, bool, IncrementSequenceCount);
+
+    UT_GenStub_Execute(CFE_SB_TransferBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransferBuffer, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_TransmitBuffer()
@@ -398,6 +452,24 @@ CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequen
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitBufferBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *BufPtrs[], uint32 Count, bool IncrementSequenceCount)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitBufferBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, CFE_SB_Buffer_t **, BufPtrs);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, uint32, Count);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, bool, IncrementSequenceCount);
+
+    UT_GenStub_Execute(CFE_SB_TransmitBufferBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitBufferBatch, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_TransmitMsg()
@@ -415,6 +487,24 @@ CFE_Status_t CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenc
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsg, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitMsgBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitMsgBatch(CFE_MSG_Message_t *MsgPtrs[], uint32 Count, bool IncrementSequenceCount)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitMsgBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgBatch, CFE_MSG_Message_t **, MsgPtrs);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgBatch, uint32, Count);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgBatch, bool, IncrementSequenceCount);
+
+    UT_GenStub_Execute(CFE_SB_TransmitMsgBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsgBatch, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_Unsubscribe()
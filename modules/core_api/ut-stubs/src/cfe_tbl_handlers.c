@@ -85,3 +85,21 @@ void UT_DefaultHandler_CFE_TBL_GetInfo(void *UserObj, UT_EntryKey_t FuncKey, con
         memset(TblInfoPtr, 0, sizeof(*TblInfoPtr));
     }
 }
+
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_TBL_SnapshotAddress coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_TBL_SnapshotAddress(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **TblPtr = UT_Hook_GetArgValueByName(Context, "TblPtr", void **);
+
+    int32 status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_TBL_SnapshotAddress), (uint8 *)TblPtr, sizeof(void *));
+    }
+}
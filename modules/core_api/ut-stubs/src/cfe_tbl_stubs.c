@@ -30,6 +30,7 @@
 extern void UT_DefaultHandler_CFE_TBL_GetAddress(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_TBL_GetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_TBL_Register(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_CFE_TBL_SnapshotAddress(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -236,6 +237,22 @@ CFE_Status_t CFE_TBL_ReleaseAddresses(uint16 NumTables, const CFE_TBL_Handle_t T
     return UT_GenStub_GetReturnValue(CFE_TBL_ReleaseAddresses, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_ReleaseSnapshot()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_ReleaseSnapshot(CFE_TBL_Handle_t TblHandle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_ReleaseSnapshot, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_ReleaseSnapshot, CFE_TBL_Handle_t, TblHandle);
+
+    UT_GenStub_Execute(CFE_TBL_ReleaseSnapshot, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_ReleaseSnapshot, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_Share()
@@ -253,6 +270,23 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
     return UT_GenStub_GetReturnValue(CFE_TBL_Share, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_SnapshotAddress()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_SnapshotAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_SnapshotAddress, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_SnapshotAddress, void **, TblPtr);
+    UT_GenStub_AddParam(CFE_TBL_SnapshotAddress, CFE_TBL_Handle_t, TblHandle);
+
+    UT_GenStub_Execute(CFE_TBL_SnapshotAddress, Basic, UT_DefaultHandler_CFE_TBL_SnapshotAddress);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_SnapshotAddress, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_Unregister()
@@ -21,7 +21,7 @@
 /**
  * @file
  *
- * Definition of the CFE_SB_DestinationD_t structure type
+ * Definition of the CFE_SB_DestinationD_t and CFE_SB_DestinationList_t structure types
  * This was moved into its own header file since it is referenced by multiple CFE modules.
  */
 
@@ -30,25 +30,46 @@
 
 #include "common_types.h"
 #include "cfe_sb_extern_typedefs.h" /* Required for CFE_SB_PipeId_t definition */
+#include "cfe_platform_cfg.h"       /* Required for CFE_PLATFORM_SB_MAX_DEST_PER_PKT */
 
 /******************************************************************************
  * This structure defines a DESTINATION DESCRIPTOR used to specify
  * each destination pipe for a message.
  *
+ * Destinations are stored by value in the destination list of the route,
+ * and are 16 bytes so that several of them share each cache line.
+ *
  * Note: Changing the size of this structure may require the memory pool
  * block sizes to change.
  */
 typedef struct CFE_SB_DestinationD
 {
-    CFE_SB_PipeId_t             PipeId;
-    uint8                       Active;
-    uint16                      MsgId2PipeLim;
-    uint16                      BuffCount;
-    uint16                      DestCnt;
-    uint8                       Scope;
-    uint8                       Spare[3];
-    struct CFE_SB_DestinationD *Prev;
-    struct CFE_SB_DestinationD *Next;
+    CFE_SB_PipeId_t PipeId;
+    uint16          PipeIdx; /**< Index of the pipe descriptor, saves a lookup by PipeId on each send */
+    uint8           Active;
+    uint8           Scope;
+    uint16          MsgId2PipeLim;
+    uint16          BuffCount;
+    uint16          DestCnt;
+    uint16          Spare;
 } CFE_SB_DestinationD_t;
 
+/******************************************************************************
+ * This structure defines the DESTINATION LIST of a route, which holds all
+ * of its destinations in a single contiguous array.  The destinations in
+ * use are always the first Count entries, in the order they subscribed.
+ *
+ * Only Capacity entries are actually allocated, which grows as needed.
+ *
+ * Note: Changing the size of this structure may require the memory pool
+ * block sizes to change.
+ */
+typedef struct CFE_SB_DestinationList
+{
+    uint16                Count;    /**< Number of destinations in use */
+    uint16                Capacity; /**< Number of destinations allocated */
+    uint16                Spare[6]; /**< Keeps the array aligned the same as the header */
+    CFE_SB_DestinationD_t Dest[CFE_PLATFORM_SB_MAX_DEST_PER_PKT]; /* Variably sized, Keep last */
+} CFE_SB_DestinationList_t;
+
 #endif /* CFE_SB_DESTINATION_TYPEDEF_H */
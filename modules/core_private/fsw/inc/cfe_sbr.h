@@ -72,6 +72,18 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr);
  */
 CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId);
 
+/**
+ *  \brief Obtain the map probe length of a message id
+ *
+ *  The number of map slots past the hashed slot of the message id that
+ *  have to be checked to find it, which is always 0 for the direct map.
+ *
+ *  \param[in] MsgId Message ID to get the probe length of
+ *
+ *  \returns Probe length, 0 if not mapped
+ */
+uint16 CFE_SBR_GetProbeLength(CFE_SB_MsgId_t MsgId);
+
 /**
  *  \brief Obtain the message id given a route id
  *
@@ -82,22 +94,22 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId);
 CFE_SB_MsgId_t CFE_SBR_GetMsgId(CFE_SBR_RouteId_t RouteId);
 
 /**
- *  \brief Obtain the destination list head pointer given a route id
+ *  \brief Obtain the destination list pointer given a route id
  *
  *  \param[in] RouteId Route ID
  *
- *  \returns Destination list head pointer for the given route id.
+ *  \returns Destination list pointer for the given route id.
  *           Will be null if route doesn't exist or no subscribers.
  */
-CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId);
+CFE_SB_DestinationList_t *CFE_SBR_GetDestList(CFE_SBR_RouteId_t RouteId);
 
 /**
- * \brief Set the destination list head pointer for given route id
+ * \brief Set the destination list pointer for given route id
  *
- * \param[in] RouteId Route Id
- * \param[in] DestPtr Destination list head pointer
+ * \param[in] RouteId  Route Id
+ * \param[in] DestList Destination list pointer
  */
-void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
+void CFE_SBR_SetDestList(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationList_t *DestList);
 
 /**
  * \brief Increment the sequence counter associated with the supplied route ID
@@ -1579,6 +1579,7 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
 {
     char    TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE];
     int32   ReturnCode;
+    uint32  Suppressed;
     va_list ArgPtr;
 
     if (SpecStringPtr == NULL)
@@ -1586,17 +1587,27 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
         return CFE_ES_BAD_ARGUMENT;
     }
 
+    /* Check the rate limit first, so a suppressed message is never formatted */
+    if (!CFE_ES_SysLogRateCheck(&Suppressed))
+    {
+        return CFE_ES_ERR_SYS_LOG_SUPPRESSED;
+    }
+
+    if (Suppressed > 0)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: %lu messages from task %lu suppressed\n", __func__, (unsigned long)Suppressed,
+                                  OS_ObjectIdToInteger(OS_TaskGetId()));
+    }
+
     va_start(ArgPtr, SpecStringPtr);
     CFE_ES_SysLog_vsnprintf(TmpString, sizeof(TmpString), SpecStringPtr, ArgPtr);
     va_end(ArgPtr);
 
     /*
-     * Append to the syslog buffer, which must be done while locked.
-     * Only one thread can actively write into the buffer at time.
+     * Append to the syslog buffer.  This only takes the syslog mutex, and the message
+     * is already formatted, so it does not hold up ES table lookups.
      */
-    CFE_ES_LockSharedData(__func__, __LINE__);
-    ReturnCode = CFE_ES_SysLogAppend_Unsync(TmpString);
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    ReturnCode = CFE_ES_SysLogAppend(TmpString);
 
     /* Output the entry to the console */
     OS_printf("%s", TmpString);
@@ -1614,66 +1625,92 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
  *-----------------------------------------------------------------*/
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
 {
-    uint32       i;
-    int16        Index;
-    int16        Crc = 0;
-    const uint8 *BufPtr;
-    uint8        ByteValue;
-
-    static const uint16 CrcTable[256] = {
-
-        0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1,
-        0xC481, 0x0440, 0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40,
-        0xC901, 0x09C0, 0x0880, 0xC841, 0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1,
-        0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41, 0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
-        0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040, 0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1,
-        0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441, 0x3C00, 0xFCC1, 0xFD81, 0x3D40,
-        0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840, 0x2800, 0xE8C1,
-        0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-        0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0,
-        0x2080, 0xE041, 0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740,
-        0xA501, 0x65C0, 0x6480, 0xA441, 0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0,
-        0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840, 0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
-        0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40, 0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1,
-        0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041, 0x5000, 0x90C1, 0x9181, 0x5140,
-        0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440, 0x9C01, 0x5CC0,
-        0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-        0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0,
-        0x4C80, 0x8C41, 0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341,
-        0x4100, 0x81C1, 0x8081, 0x4040
-
-    };
+    uint32 Crc = 0;
 
     if (DataPtr == NULL || DataLength == 0)
     {
         return InputCRC;
     }
 
+    /*
+     * It is assumed that the supplied buffer is in a
+     * directly-accessible memory space that does not
+     * require special logic to access
+     */
     switch (TypeCRC)
     {
         case CFE_MISSION_ES_CRC_32:
-            CFE_ES_WriteToSysLog("%s: Calculate CRC32 not Implemented\n", __func__);
+            /* the input is the result of the previous block, so the final XOR is undone first */
+            Crc = ~CFE_ES_CalculateCRC32(DataPtr, DataLength, ~InputCRC);
             break;
 
         case CFE_MISSION_ES_CRC_16:
-            Crc    = (int16)(0xFFFF & InputCRC);
-            BufPtr = (const uint8 *)DataPtr;
+            Crc = CFE_ES_CalculateCRC16(DataPtr, DataLength, (uint16)InputCRC);
 
-            for (i = 0; i < DataLength; i++, BufPtr++)
+            /*
+             * The result has always been sign extended from 16 bits, keep doing
+             * so in order for CRCs which were saved before, such as in the CDS, to match
+             */
+            if ((Crc & 0x8000) != 0)
             {
-                /*
-                 * It is assumed that the supplied buffer is in a
-                 * directly-accessible memory space that does not
-                 * require special logic to access
-                 */
-                ByteValue = *BufPtr;
-                Index     = ((Crc ^ ByteValue) & 0x00FF);
-                Crc       = ((Crc >> 8) & 0x00FF) ^ CrcTable[Index];
+                Crc |= 0xFFFF0000;
             }
             break;
 
         case CFE_MISSION_ES_CRC_8:
-            CFE_ES_WriteToSysLog("%s: Calculate CRC8 not Implemented\n", __func__);
+            Crc = CFE_ES_CalculateCRC8(DataPtr, DataLength, (uint8)InputCRC);
+            break;
+
+        default:
+            break;
+    }
+    return (Crc);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_UpdateCRC
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_UpdateCRC(uint32 InputCRC, const void *OldDataPtr, const void *NewDataPtr, size_t DataLength,
+                        size_t TrailingLength, uint32 TypeCRC)
+{
+    uint32 Crc = 0;
+
+    if (OldDataPtr == NULL || NewDataPtr == NULL || DataLength == 0)
+    {
+        return InputCRC;
+    }
+
+    /*
+     * The CRC is linear, so the effect of the change is the CRC of the difference,
+     * starting from an empty register and carried over the bytes after the change.
+     * The initial value and final XOR of each algorithm cancel out.
+     */
+    switch (TypeCRC)
+    {
+        case CFE_MISSION_ES_CRC_32:
+            Crc = CFE_ES_CalculateCRC32(OldDataPtr, DataLength, 0) ^ CFE_ES_CalculateCRC32(NewDataPtr, DataLength, 0);
+            Crc = InputCRC ^ CFE_ES_ShiftCRC32(Crc, TrailingLength);
+            break;
+
+        case CFE_MISSION_ES_CRC_16:
+            Crc = CFE_ES_CalculateCRC16(OldDataPtr, DataLength, 0) ^ CFE_ES_CalculateCRC16(NewDataPtr, DataLength, 0);
+            Crc = (InputCRC ^ CFE_ES_ShiftCRC16(Crc, TrailingLength)) & 0xFFFF;
+
+            /* Sign extend the same way as CFE_ES_CalculateCRC() */
+            if ((Crc & 0x8000) != 0)
+            {
+                Crc |= 0xFFFF0000;
+            }
+            break;
+
+        case CFE_MISSION_ES_CRC_8:
+            Crc = CFE_ES_CalculateCRC8(OldDataPtr, DataLength, 0) ^ CFE_ES_CalculateCRC8(NewDataPtr, DataLength, 0);
+            Crc = (InputCRC ^ CFE_ES_ShiftCRC8(Crc, TrailingLength)) & 0xFF;
             break;
 
         default:
@@ -1868,6 +1905,24 @@ CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return CFE_ES_CDSBlockWrite(Handle, DataToCopy);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CopyToCDSRange
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    if (DataToCopy == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_CDSBlockWriteRange(Handle, DataToCopy, Offset, Size);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_RestoreFromCDS
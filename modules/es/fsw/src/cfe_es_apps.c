@@ -50,7 +50,8 @@
 /*
 ** Defines
 */
-#define ES_START_BUFF_SIZE 128
+#define ES_START_BUFF_SIZE 256
+#define ES_START_READ_SIZE 256
 
 /*
 **
@@ -75,17 +76,23 @@
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
 {
     char        ES_AppLoadBuffer[ES_START_BUFF_SIZE]; /* A buffer of for a line in a file */
+    char        ES_AppReadBuffer[ES_START_READ_SIZE]; /* A buffer for data read from the file */
     char        ScriptFileName[OS_MAX_PATH_LEN];
     const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
     uint32      NumTokens;
     uint32      NumLines;
     uint32      BuffLen; /* Length of the current buffer */
+    uint32      ReadLen; /* Length of the data in the read buffer */
+    uint32      ReadPos; /* Position of the next character in the read buffer */
     osal_id_t   AppFile = OS_OBJECT_ID_UNDEFINED;
     int32       Status;
     char        c;
     bool        LineTooLong = false;
     bool        FileOpened  = false;
 
+    CFE_ES_Global.StartupGraph.NumEntries  = 0;
+    CFE_ES_Global.StartupGraph.NumFinished = 0;
+
     /*
     ** Get the ES startup script filename.
     ** If this is a Processor Reset, try to open the file in the volatile disk first.
@@ -153,6 +160,8 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         BuffLen      = 0;
         NumTokens    = 0;
         NumLines     = 0;
+        ReadLen      = 0;
+        ReadPos      = 0;
         TokenList[0] = ES_AppLoadBuffer;
 
         /*
@@ -161,20 +170,34 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         */
         while (1)
         {
-            Status = OS_read(AppFile, &c, 1);
-            if (Status < 0)
-            {
-                CFE_ES_WriteToSysLog("%s: Error Reading Startup file. EC = 0x%08X\n", __func__, (unsigned int)Status);
-                break;
-            }
-            else if (Status == 0)
+            /*
+            ** Read the file in blocks, rather than a character at a time
+            */
+            if (ReadPos >= ReadLen)
             {
-                /*
-                ** EOF Reached
-                */
-                break;
+                Status = OS_read(AppFile, ES_AppReadBuffer, sizeof(ES_AppReadBuffer));
+                if (Status < 0)
+                {
+                    CFE_ES_WriteToSysLog("%s: Error Reading Startup file. EC = 0x%08X\n", __func__,
+                                         (unsigned int)Status);
+                    break;
+                }
+                else if (Status == 0)
+                {
+                    /*
+                    ** EOF Reached
+                    */
+                    break;
+                }
+
+                ReadLen = Status;
+                ReadPos = 0;
             }
-            else if (c != '!')
+
+            c = ES_AppReadBuffer[ReadPos];
+            ++ReadPos;
+
+            if (c != '!')
             {
                 if (c <= ' ')
                 {
@@ -248,7 +271,7 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
                         ** Ensure termination of the last token and send it along
                         */
                         ES_AppLoadBuffer[BuffLen] = 0;
-                        CFE_ES_ParseFileEntry(TokenList, 1 + NumTokens);
+                        CFE_ES_StartupGraphAdd(TokenList, 1 + NumTokens);
                     }
                     BuffLen   = 0;
                     NumTokens = 0;
@@ -266,62 +289,66 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         ** close the file
         */
         OS_close(AppFile);
+
+        /*
+        ** Now start everything that was listed in the file
+        */
+        CFE_ES_StartupGraphRun();
     }
 }
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_ES_ParseFileEntry
+ * Function: CFE_ES_ParseStartupEntry
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
+int32 CFE_ES_ParseStartupEntry(const char **TokenList, uint32 NumTokens, CFE_ES_StartupEntry_t *Entry)
 {
-    const char *  ModuleName;
     const char *  EntryType;
     unsigned long ParsedValue;
-    union
-    {
-        CFE_ES_AppId_t AppId;
-        CFE_ES_LibId_t LibId;
-    } IdBuf;
-    int32                   Status;
-    CFE_ES_AppStartParams_t ParamBuf;
+    int32         Status;
 
     /*
     ** Check to see if the correct number of items were parsed
     */
-    if (NumTokens < 8)
+    if (NumTokens < CFE_ES_STARTSCRIPT_MIN_TOKENS_PER_LINE)
     {
         CFE_ES_WriteToSysLog("%s: Invalid ES Startup file entry: %u\n", __func__, (unsigned int)NumTokens);
         return CFE_ES_BAD_ARGUMENT;
     }
 
     /* Get pointers to specific tokens that are simple strings used as-is */
-    EntryType  = TokenList[0];
-    ModuleName = TokenList[3];
+    EntryType = TokenList[0];
+
+    /* Confirm name will fit inside the entry */
+    if (memchr(TokenList[3], 0, sizeof(Entry->ModuleName)) == NULL)
+    {
+        CFE_ES_WriteToSysLog("%s: Invalid ES Startup script module name: %s\n", __func__, TokenList[3]);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    memset(Entry, 0, sizeof(*Entry));
+    strncpy(Entry->ModuleName, TokenList[3], sizeof(Entry->ModuleName) - 1);
 
     /*
      * Other tokens will need to be scrubbed/converted.
      * Both Libraries and Apps use File Name (1) and Symbol Name (2) fields so copy those now
      */
-    memset(&ParamBuf, 0, sizeof(ParamBuf));
-    Status = CFE_FS_ParseInputFileName(ParamBuf.BasicInfo.FileName, TokenList[1], sizeof(ParamBuf.BasicInfo.FileName),
-                                       CFE_FS_FileCategory_DYNAMIC_MODULE);
+    Status = CFE_FS_ParseInputFileName(Entry->Params.BasicInfo.FileName, TokenList[1],
+                                       sizeof(Entry->Params.BasicInfo.FileName), CFE_FS_FileCategory_DYNAMIC_MODULE);
     if (Status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("%s: Invalid ES Startup script file name: %s\n", __func__, TokenList[1]);
         return Status;
     }
 
-    strncpy(ParamBuf.BasicInfo.InitSymbolName, TokenList[2], sizeof(ParamBuf.BasicInfo.InitSymbolName) - 1);
+    strncpy(Entry->Params.BasicInfo.InitSymbolName, TokenList[2], sizeof(Entry->Params.BasicInfo.InitSymbolName) - 1);
 
     if (strcmp(EntryType, "CFE_APP") == 0)
     {
-        CFE_ES_WriteToSysLog("%s: Loading file: %s, APP: %s\n", __func__, ParamBuf.BasicInfo.FileName, ModuleName);
-
         /*
          * Priority and Exception action have limited ranges, which is checked here
          * Task priority cannot be bigger than OS_MAX_TASK_PRIORITY
@@ -329,16 +356,16 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
         ParsedValue = strtoul(TokenList[4], NULL, 0);
         if (ParsedValue > OS_MAX_TASK_PRIORITY)
         {
-            ParamBuf.MainTaskInfo.Priority = OS_MAX_TASK_PRIORITY;
+            Entry->Params.MainTaskInfo.Priority = OS_MAX_TASK_PRIORITY;
         }
         else
         {
             /* convert parsed value to correct type */
-            ParamBuf.MainTaskInfo.Priority = (CFE_ES_TaskPriority_Atom_t)ParsedValue;
+            Entry->Params.MainTaskInfo.Priority = (CFE_ES_TaskPriority_Atom_t)ParsedValue;
         }
 
         /* No specific upper/lower limit for stack size - will pass value through */
-        ParamBuf.MainTaskInfo.StackSize = strtoul(TokenList[5], NULL, 0);
+        Entry->Params.MainTaskInfo.StackSize = strtoul(TokenList[5], NULL, 0);
 
         /*
         ** Validate Some parameters
@@ -349,37 +376,344 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
         ParsedValue = strtoul(TokenList[7], NULL, 0);
         if (ParsedValue > CFE_ES_ExceptionAction_RESTART_APP)
         {
-            ParamBuf.ExceptionAction = CFE_ES_ExceptionAction_PROC_RESTART;
+            Entry->Params.ExceptionAction = CFE_ES_ExceptionAction_PROC_RESTART;
         }
         else
         {
             /* convert parsed value to correct type */
-            ParamBuf.ExceptionAction = (CFE_ES_ExceptionAction_Enum_t)ParsedValue;
+            Entry->Params.ExceptionAction = (CFE_ES_ExceptionAction_Enum_t)ParsedValue;
         }
-
-        /*
-        ** Now create the application
-        */
-        Status = CFE_ES_AppCreate(&IdBuf.AppId, ModuleName, &ParamBuf);
     }
     else if (strcmp(EntryType, "CFE_LIB") == 0)
     {
-        CFE_ES_WriteToSysLog("%s: Loading shared library: %s\n", __func__, ParamBuf.BasicInfo.FileName);
+        Entry->IsLibrary = true;
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("%s: Unexpected EntryType %s in startup file.\n", __func__, EntryType);
+        Status = CFE_ES_ERR_APP_CREATE;
+    }
+
+    return (Status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_LaunchStartupEntry
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_LaunchStartupEntry(const CFE_ES_StartupEntry_t *Entry)
+{
+    union
+    {
+        CFE_ES_AppId_t AppId;
+        CFE_ES_LibId_t LibId;
+    } IdBuf;
+    int32 Status;
+
+    if (Entry->IsLibrary)
+    {
+        CFE_ES_WriteToSysLog("%s: Loading shared library: %s\n", __func__, Entry->Params.BasicInfo.FileName);
 
         /*
         ** Now load the library
         */
-        Status = CFE_ES_LoadLibrary(&IdBuf.LibId, ModuleName, &ParamBuf.BasicInfo);
+        Status = CFE_ES_LoadLibrary(&IdBuf.LibId, Entry->ModuleName, &Entry->Params.BasicInfo);
     }
     else
     {
-        CFE_ES_WriteToSysLog("%s: Unexpected EntryType %s in startup file.\n", __func__, EntryType);
-        Status = CFE_ES_ERR_APP_CREATE;
+        CFE_ES_WriteToSysLog("%s: Loading file: %s, APP: %s\n", __func__, Entry->Params.BasicInfo.FileName,
+                             Entry->ModuleName);
+
+        /*
+        ** Now create the application
+        */
+        Status = CFE_ES_AppCreate(&IdBuf.AppId, Entry->ModuleName, &Entry->Params);
     }
 
     return (Status);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupGraphAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StartupGraphAdd(const char **TokenList, uint32 NumTokens)
+{
+    CFE_ES_StartupGraph_t *Graph;
+    CFE_ES_StartupEntry_t *Entry;
+    int32                  Status;
+    uint32                 i;
+    uint32                 j;
+
+    Graph = &CFE_ES_Global.StartupGraph;
+
+    if (Graph->NumEntries >= CFE_ES_STARTSCRIPT_MAX_ENTRIES)
+    {
+        CFE_ES_WriteToSysLog("%s: Too many entries in startup file, max %u\n", __func__,
+                             (unsigned int)CFE_ES_STARTSCRIPT_MAX_ENTRIES);
+        return CFE_ES_ERR_APP_CREATE;
+    }
+
+    Entry  = &Graph->Entry[Graph->NumEntries];
+    Status = CFE_ES_ParseStartupEntry(TokenList, NumTokens, Entry);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /*
+     * Any fields after the standard ones name the entries this one depends on.
+     * These must be listed earlier, so the dependencies can never form a loop.
+     * A single empty field just means that there are no dependencies.
+     */
+    Entry->HasDependencyList = (NumTokens > CFE_ES_STARTSCRIPT_MIN_TOKENS_PER_LINE);
+    for (i = CFE_ES_STARTSCRIPT_MIN_TOKENS_PER_LINE; i < NumTokens; ++i)
+    {
+        if (TokenList[i][0] == 0)
+        {
+            continue;
+        }
+
+        for (j = 0; j < Graph->NumEntries; ++j)
+        {
+            if (strcmp(Graph->Entry[j].ModuleName, TokenList[i]) == 0)
+            {
+                break;
+            }
+        }
+
+        if (j >= Graph->NumEntries)
+        {
+            CFE_ES_WriteToSysLog("%s: %s depends on %s, which is not listed before it in startup file\n", __func__,
+                                 Entry->ModuleName, TokenList[i]);
+            return CFE_ES_BAD_ARGUMENT;
+        }
+
+        Entry->DepIndex[Entry->NumDeps] = j;
+        ++Entry->NumDeps;
+    }
+
+    Entry->State = CFE_ES_StartupState_PENDING;
+    ++Graph->NumEntries;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupGraphCheckDeps
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Returns DONE if the entry at the given index is ready to start, FAILED
+ * if one of its listed dependencies failed, or PENDING if it must wait.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_StartupState_t CFE_ES_StartupGraphCheckDeps(const CFE_ES_StartupGraph_t *Graph, uint32 Index)
+{
+    const CFE_ES_StartupEntry_t *Entry;
+    CFE_ES_StartupState_t        DepState;
+    CFE_ES_StartupState_t        Result;
+    uint32                       i;
+
+    Entry  = &Graph->Entry[Index];
+    Result = CFE_ES_StartupState_DONE;
+
+    if (Entry->HasDependencyList)
+    {
+        for (i = 0; i < Entry->NumDeps; ++i)
+        {
+            DepState = Graph->Entry[Entry->DepIndex[i]].State;
+            if (DepState == CFE_ES_StartupState_FAILED)
+            {
+                return CFE_ES_StartupState_FAILED;
+            }
+
+            if (DepState != CFE_ES_StartupState_DONE)
+            {
+                Result = CFE_ES_StartupState_PENDING;
+            }
+        }
+    }
+    else
+    {
+        /*
+         * Without a list, wait for every library listed earlier, as if the file was
+         * processed in order.  As before, a library failing does not stop the entry.
+         */
+        for (i = 0; i < Index; ++i)
+        {
+            DepState = Graph->Entry[i].State;
+            if (Graph->Entry[i].IsLibrary &&
+                (DepState == CFE_ES_StartupState_PENDING || DepState == CFE_ES_StartupState_STARTING))
+            {
+                Result = CFE_ES_StartupState_PENDING;
+            }
+        }
+    }
+
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupGraphGetNext
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_StartupEntry_t *CFE_ES_StartupGraphGetNext(void)
+{
+    CFE_ES_StartupGraph_t *Graph;
+    CFE_ES_StartupEntry_t *Entry;
+    CFE_ES_StartupState_t  DepState;
+    uint32                 i;
+
+    Graph = &CFE_ES_Global.StartupGraph;
+
+    for (i = 0; i < Graph->NumEntries; ++i)
+    {
+        Entry = &Graph->Entry[i];
+        if (Entry->State != CFE_ES_StartupState_PENDING)
+        {
+            continue;
+        }
+
+        DepState = CFE_ES_StartupGraphCheckDeps(Graph, i);
+        if (DepState == CFE_ES_StartupState_FAILED)
+        {
+            CFE_ES_SysLogWrite_Unsync("%s: Skipping %s, as an entry it depends on failed to start\n", __func__,
+                                      Entry->ModuleName);
+            Entry->State = CFE_ES_StartupState_FAILED;
+            ++Graph->NumFinished;
+        }
+        else if (DepState == CFE_ES_StartupState_DONE)
+        {
+            Entry->State = CFE_ES_StartupState_STARTING;
+            return Entry;
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupGraphProcess
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupGraphProcess(void)
+{
+    CFE_ES_StartupGraph_t *Graph;
+    CFE_ES_StartupEntry_t *Entry;
+    int32                  Status;
+    bool                   IsFinished;
+
+    Graph = &CFE_ES_Global.StartupGraph;
+
+    while (true)
+    {
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        Entry      = CFE_ES_StartupGraphGetNext();
+        IsFinished = (Graph->NumFinished >= Graph->NumEntries);
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (Entry != NULL)
+        {
+            /* The lock is not held here, so other tasks can start other entries at the same time */
+            Status = CFE_ES_LaunchStartupEntry(Entry);
+
+            CFE_ES_LockSharedData(__func__, __LINE__);
+            if (Status == CFE_SUCCESS)
+            {
+                Entry->State = CFE_ES_StartupState_DONE;
+            }
+            else
+            {
+                Entry->State = CFE_ES_StartupState_FAILED;
+            }
+            ++Graph->NumFinished;
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+        }
+        else if (IsFinished)
+        {
+            break;
+        }
+        else
+        {
+            /* Nothing is ready yet - wait for the entries being started by other tasks */
+            OS_TaskDelay(CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupGraphWorkerMain
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupGraphWorkerMain(void)
+{
+    CFE_ES_StartupGraphProcess();
+
+    /* returning from the entry point causes OSAL to clean up the task */
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupGraphRun
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupGraphRun(void)
+{
+#if (CFE_PLATFORM_ES_STARTUP_WORKERS > 0)
+    char      WorkerName[OS_MAX_API_NAME];
+    osal_id_t WorkerId;
+    int32     Status;
+    uint32    i;
+
+    /* Extra tasks are only worth creating if there is more than one entry */
+    for (i = 0; i < CFE_PLATFORM_ES_STARTUP_WORKERS && CFE_ES_Global.StartupGraph.NumEntries > 1; ++i)
+    {
+        snprintf(WorkerName, sizeof(WorkerName), "ES_STARTUP%u", (unsigned int)i);
+        Status = OS_TaskCreate(&WorkerId, WorkerName, CFE_ES_StartupGraphWorkerMain, OSAL_TASK_STACK_ALLOCATE,
+                               CFE_PLATFORM_ES_START_TASK_STACK_SIZE, CFE_PLATFORM_ES_START_TASK_PRIORITY,
+                               OS_FP_ENABLED);
+        if (Status != OS_SUCCESS)
+        {
+            /* not fatal - the entries will still be started by the remaining tasks */
+            CFE_ES_WriteToSysLog("%s: Could not create startup task %s. EC = 0x%08X\n", __func__, WorkerName,
+                                 (unsigned int)Status);
+            break;
+        }
+    }
+#endif
+
+    /*
+     * The main thread also starts entries, and only returns once every
+     * entry has either been started or has failed.
+     */
+    CFE_ES_StartupGraphProcess();
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_LoadModule
@@ -45,7 +45,11 @@
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_MIN_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES    8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE \
+    (CFE_ES_STARTSCRIPT_MIN_TOKENS_PER_LINE + CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES)
+#define CFE_ES_STARTSCRIPT_MAX_ENTRIES         (CFE_PLATFORM_ES_MAX_APPLICATIONS + CFE_PLATFORM_ES_MAX_LIBRARIES)
 
 /*
 ** Type Definitions
@@ -183,6 +187,44 @@ typedef struct
     uint8  LastScanCommandCount;
 } CFE_ES_AppTableScanState_t;
 
+/*
+** State of an entry from the ES startup script
+*/
+typedef enum
+{
+    CFE_ES_StartupState_PENDING,  /**< Not started yet */
+    CFE_ES_StartupState_STARTING, /**< Being started by one of the startup tasks */
+    CFE_ES_StartupState_DONE,     /**< Started successfully */
+    CFE_ES_StartupState_FAILED    /**< Failed to start, or skipped because a dependency failed */
+} CFE_ES_StartupState_t;
+
+/*
+** CFE_ES_StartupEntry_t holds one parsed line of the ES startup script
+*/
+typedef struct
+{
+    bool                    IsLibrary;         /**< CFE_LIB entry, rather than CFE_APP */
+    bool                    HasDependencyList; /**< Dependencies were listed in the script, rather than implied */
+    CFE_ES_StartupState_t   State;
+    uint16                  NumDeps;
+    uint16                  DepIndex[CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES]; /**< Indices of listed dependencies */
+    char                    ModuleName[OS_MAX_API_NAME];
+    CFE_ES_AppStartParams_t Params;
+} CFE_ES_StartupEntry_t;
+
+/*
+** CFE_ES_StartupGraph_t holds all entries of the ES startup script
+**
+** Entries can only depend on entries listed before them, so there
+** can be no dependency loops.  This is protected by the ES shared data lock.
+*/
+typedef struct
+{
+    uint32                NumEntries;
+    uint32                NumFinished; /**< Entries which are DONE or FAILED */
+    CFE_ES_StartupEntry_t Entry[CFE_ES_STARTSCRIPT_MAX_ENTRIES];
+} CFE_ES_StartupGraph_t;
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -196,9 +238,72 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * This function parses the startup file line for an individual cFE application.
+ * Parses the standard fields of a startup file line, without starting it
+ *
+ * @param[in]  TokenList  The fields of the startup file line
+ * @param[in]  NumTokens  The number of fields
+ * @param[out] Entry      Filled in with the parsed information
+ * @returns CFE_SUCCESS if the line is valid, or an error code otherwise
+ */
+int32 CFE_ES_ParseStartupEntry(const char **TokenList, uint32 NumTokens, CFE_ES_StartupEntry_t *Entry);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads the library, or creates the application, for a parsed startup file line
+ *
+ * @param[in]  Entry      The parsed startup file line
+ * @returns CFE_SUCCESS if started, or an error code otherwise
+ */
+int32 CFE_ES_LaunchStartupEntry(const CFE_ES_StartupEntry_t *Entry);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Adds a startup file line to the startup graph, to be started later
+ *
+ * Any fields after the standard ones name the entries that this entry
+ * depends on, which must already be in the graph.
+ *
+ * @param[in]  TokenList  The fields of the startup file line
+ * @param[in]  NumTokens  The number of fields
+ * @returns CFE_SUCCESS if added, or an error code otherwise
+ */
+int32 CFE_ES_StartupGraphAdd(const char **TokenList, uint32 NumTokens);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Gets the next startup graph entry which is ready to be started
+ *
+ * Marks the returned entry as STARTING.  Any entries with a failed dependency
+ * are marked as FAILED along the way.
+ *
+ * @note This must be called with the ES shared data lock held
+ *
+ * @returns The entry to start, or NULL if no entry is ready
+ */
+CFE_ES_StartupEntry_t *CFE_ES_StartupGraphGetNext(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Starts entries from the startup graph until all have been started
+ *
+ * This is run by the CFE main thread and each of the extra startup tasks.
+ */
+void CFE_ES_StartupGraphProcess(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point for the extra startup tasks
+ */
+void CFE_ES_StartupGraphWorkerMain(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Starts all entries in the startup graph
+ *
+ * Creates the extra startup tasks, if configured, then returns once
+ * every entry has either been started or has failed.
  */
-int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens);
+void CFE_ES_StartupGraphRun(void);
 
 /*---------------------------------------------------------------------------------------*/
 /**
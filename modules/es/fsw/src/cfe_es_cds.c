@@ -497,6 +497,12 @@ int32 CFE_ES_ValidateCDS(void)
     if (strncmp(CDS->Cache.Data.Sig, CFE_ES_CDS_SIGNATURE_BEGIN, CFE_ES_CDS_SIGNATURE_LEN) != 0)
     {
         /* Beginning Validity Field failed */
+        if (strncmp(CDS->Cache.Data.Sig, CFE_ES_CDS_SIGNATURE_BEGIN_V1, CFE_ES_CDS_SIGNATURE_LEN) == 0)
+        {
+            CFE_ES_WriteToSysLog("%s: CDS has the layout of an earlier version, contents will be discarded\n",
+                                 __func__);
+        }
+
         return CFE_ES_CDS_INVALID;
     }
 
@@ -589,7 +595,7 @@ int32 CFE_ES_InitCDSSignatures(void)
     if (Status != CFE_SUCCESS)
     {
         /* BSP reported an error writing to CDS */
-        CFE_ES_WriteToSysLog("%s: '_CDSBeg_' write failed. Status=0x%08X\n", __func__,
+        CFE_ES_WriteToSysLog("%s: '" CFE_ES_CDS_SIGNATURE_BEGIN "' write failed. Status=0x%08X\n", __func__,
                              (unsigned int)CDS->Cache.AccessStatus);
         return Status;
     }
@@ -601,7 +607,7 @@ int32 CFE_ES_InitCDSSignatures(void)
     Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
     if (Status != CFE_PSP_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("%s: '_CDSEnd_' write failed. Status=0x%08X\n", __func__,
+        CFE_ES_WriteToSysLog("%s: '" CFE_ES_CDS_SIGNATURE_END "' write failed. Status=0x%08X\n", __func__,
                              (unsigned int)CDS->Cache.AccessStatus);
         return Status;
     }
@@ -668,6 +674,172 @@ int32 CFE_ES_UpdateCDSRegistry(void)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CDS_JournalApply
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes the data held in the journal buffer and the new block CRC
+ * for a journal entry, then clears the entry in the CDS.
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_CDS_JournalApply(const CFE_ES_CDS_JournalHeader_t *Entry)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    int32                  Status;
+
+    Status = CFE_PSP_WriteToCDS(CDS->JournalBuffer, Entry->DataOffset, Entry->DataSize);
+    if (Status != CFE_PSP_SUCCESS)
+    {
+        return CFE_ES_CDS_ACCESS_ERROR;
+    }
+
+    CFE_ES_CDS_CachePreload(&CDS->Cache, NULL, Entry->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
+    CDS->Cache.Data.BlockHeader.Crc = Entry->BlockCrc;
+
+    Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+    if (Status == CFE_SUCCESS)
+    {
+        /* The change is now complete, so the entry must not be applied again */
+        Status = CFE_ES_CDS_JournalClear();
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CDS_JournalClear
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDS_JournalClear(void)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    int32                  Status;
+
+    CFE_ES_CDS_CachePreload(&CDS->Cache, NULL, CDS_JOURNAL_OFFSET, sizeof(CFE_ES_CDS_JournalHeader_t));
+    CDS->Cache.Data.JournalHeader.Crc = CFE_ES_CalculateCRC(&CDS->Cache.Data.JournalHeader.BlockOffset,
+                                                            CDS_JOURNAL_HEADER_CRC_SIZE, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+    Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+    if (Status == CFE_SUCCESS)
+    {
+        CDS->PendingJournalBlock = 0;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CDS_JournalCommit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDS_JournalCommit(CFE_ES_CDS_JournalHeader_t *Entry)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    int32                  Status;
+
+    /* The entry CRC covers every header field after the CRC itself, then the data */
+    Entry->Crc = CFE_ES_CalculateCRC(&Entry->BlockOffset, CDS_JOURNAL_HEADER_CRC_SIZE, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    Entry->Crc = CFE_ES_CalculateCRC(CDS->JournalBuffer, Entry->DataSize, Entry->Crc, CFE_MISSION_ES_DEFAULT_CRC);
+
+    /* From here until it is cleared, the entry may be left pending in the CDS */
+    CDS->PendingJournalBlock = Entry->BlockOffset;
+
+    /* The data goes first, as the entry only becomes valid once its header has been written */
+    Status = CFE_PSP_WriteToCDS(CDS->JournalBuffer, CDS_JOURNAL_DATA_OFFSET, Entry->DataSize);
+    if (Status != CFE_PSP_SUCCESS)
+    {
+        return CFE_ES_CDS_ACCESS_ERROR;
+    }
+
+    CFE_ES_CDS_CachePreload(&CDS->Cache, Entry, CDS_JOURNAL_OFFSET, sizeof(*Entry));
+    Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    return CFE_ES_CDS_JournalApply(Entry);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_ReplayCDSJournal
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_ReplayCDSJournal(void)
+{
+    CFE_ES_CDS_Instance_t *    CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_JournalHeader_t Entry;
+    size_t                     PoolEnd;
+    uint32                     Crc;
+    int32                      Status;
+
+    Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDS_JOURNAL_OFFSET, sizeof(Entry));
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: PSP Error reading journal header (%lx)\n", __func__,
+                             (unsigned long)CDS->Cache.AccessStatus);
+        return Status;
+    }
+
+    /* Keep a copy, as the cache is reused when the entry is applied */
+    Entry = CDS->Cache.Data.JournalHeader;
+    if (Entry.DataSize == 0)
+    {
+        /* Nothing pending */
+        return CFE_SUCCESS;
+    }
+
+    PoolEnd = CDS_POOL_OFFSET + CDS->DataSize;
+    if (Entry.DataSize > sizeof(CDS->JournalBuffer) || Entry.DataOffset < CDS_POOL_OFFSET ||
+        Entry.DataOffset > (PoolEnd - Entry.DataSize) || Entry.BlockOffset < CDS_POOL_OFFSET ||
+        Entry.BlockOffset > (PoolEnd - sizeof(CFE_ES_CDS_BlockHeader_t)))
+    {
+        CFE_ES_WriteToSysLog("%s: Discarding malformed journal entry\n", __func__);
+        return CFE_SUCCESS;
+    }
+
+    Status = CFE_PSP_ReadFromCDS(CDS->JournalBuffer, CDS_JOURNAL_DATA_OFFSET, Entry.DataSize);
+    if (Status != CFE_PSP_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: PSP Error reading journal data (%lx)\n", __func__, (unsigned long)Status);
+        return CFE_ES_CDS_ACCESS_ERROR;
+    }
+
+    Crc = CFE_ES_CalculateCRC(&Entry.BlockOffset, CDS_JOURNAL_HEADER_CRC_SIZE, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    Crc = CFE_ES_CalculateCRC(CDS->JournalBuffer, Entry.DataSize, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+    if (Crc != Entry.Crc)
+    {
+        /* The entry was not completely stored, so the block itself was never changed */
+        CFE_ES_WriteToSysLog("%s: Discarding incomplete journal entry\n", __func__);
+        return CFE_SUCCESS;
+    }
+
+    CFE_ES_WriteToSysLog("%s: Completing interrupted write @Offset=0x%08lx\n", __func__,
+                         (unsigned long)Entry.DataOffset);
+
+    Status = CFE_ES_CDS_JournalApply(&Entry);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Err applying journal entry (Stat=0x%08x)\n", __func__, (unsigned int)Status);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_FormCDSName
@@ -826,6 +998,12 @@ int32 CFE_ES_RebuildCDS(void)
     {
         /* Scan the memory pool and identify the created but currently unused memory blocks */
         Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
+
+        if (Status == CFE_SUCCESS && CFE_ES_ReplayCDSJournal() != CFE_SUCCESS)
+        {
+            /* A block may have been left part way through a write */
+            Status = CFE_ES_CDS_INVALID;
+        }
     }
     else
     {
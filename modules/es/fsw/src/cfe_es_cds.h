@@ -55,8 +55,16 @@
 /** \name Registry Signature Definitions */
 /**  \{ */
 #define CFE_ES_CDS_SIGNATURE_LEN   8          /**< \brief Length of CDS signature field. */
-#define CFE_ES_CDS_SIGNATURE_BEGIN "_CDSBeg_" /**< \brief Fixed signature at beginning of CDS */
-#define CFE_ES_CDS_SIGNATURE_END   "_CDSEnd_" /**< \brief Fixed signature at end of CDS */
+#define CFE_ES_CDS_SIGNATURE_BEGIN "_CDSBg2_" /**< \brief Fixed signature at beginning of CDS */
+#define CFE_ES_CDS_SIGNATURE_END   "_CDSEn2_" /**< \brief Fixed signature at end of CDS */
+
+/*
+ * Signature at the beginning of a CDS written with the layout used before the
+ * write journal was added to the persistent header.  The journal moves the
+ * start of the memory pool, so such a CDS cannot be rebuilt and is detected
+ * explicitly rather than failing the pool rebuild.
+ */
+#define CFE_ES_CDS_SIGNATURE_BEGIN_V1 "_CDSBeg_" /**< \brief Signature of the layout without a journal */
 /** \} */
 
 /*
@@ -67,10 +75,12 @@
 #define CDS_RESERVE_SPACE(name, size) uint32 name[CDS_SIZE_TO_U32WORDS(size)]
 
 /* Define offset addresses for CDS data segments */
-#define CDS_SIG_BEGIN_OFFSET offsetof(CFE_ES_CDS_PersistentHeader_t, SignatureBegin)
-#define CDS_REG_SIZE_OFFSET  offsetof(CFE_ES_CDS_PersistentHeader_t, RegistrySize)
-#define CDS_REG_OFFSET       offsetof(CFE_ES_CDS_PersistentHeader_t, RegistryContent)
-#define CDS_POOL_OFFSET      sizeof(CFE_ES_CDS_PersistentHeader_t)
+#define CDS_SIG_BEGIN_OFFSET    offsetof(CFE_ES_CDS_PersistentHeader_t, SignatureBegin)
+#define CDS_REG_SIZE_OFFSET     offsetof(CFE_ES_CDS_PersistentHeader_t, RegistrySize)
+#define CDS_REG_OFFSET          offsetof(CFE_ES_CDS_PersistentHeader_t, RegistryContent)
+#define CDS_JOURNAL_OFFSET      offsetof(CFE_ES_CDS_PersistentHeader_t, JournalHeader)
+#define CDS_JOURNAL_DATA_OFFSET offsetof(CFE_ES_CDS_PersistentHeader_t, JournalData)
+#define CDS_POOL_OFFSET         sizeof(CFE_ES_CDS_PersistentHeader_t)
 
 /*
  * Absolute Minimum CDS size conceivably supportable by the implementation.
@@ -117,18 +127,41 @@ typedef struct CFE_ES_CDSBlockHeader
     uint32 Crc; /**< CRC of content */
 } CFE_ES_CDS_BlockHeader_t;
 
+/**
+ * Header of the pending entry in the CDS write journal
+ *
+ * An entry describes a change to part of one user block: the new data,
+ * which follows the header in the journal, and the block CRC that goes
+ * with it.  The entry is only valid if DataSize is nonzero and Crc
+ * matches the rest of the header and the data, so an entry that was
+ * only partially written before a reset is ignored.
+ */
+typedef struct CFE_ES_CDS_JournalHeader
+{
+    uint32 Crc;         /**< CRC of the remaining header fields and the data */
+    uint32 BlockOffset; /**< CDS offset of the header of the block being changed */
+    uint32 BlockCrc;    /**< CRC of the block content after the change */
+    uint32 DataOffset;  /**< CDS offset where the data is to be written */
+    uint32 DataSize;    /**< Size of the data, or 0 if there is no pending entry */
+} CFE_ES_CDS_JournalHeader_t;
+
+/* Size of the journal header fields covered by its CRC */
+#define CDS_JOURNAL_HEADER_CRC_SIZE \
+    (sizeof(CFE_ES_CDS_JournalHeader_t) - offsetof(CFE_ES_CDS_JournalHeader_t, BlockOffset))
+
 /*
  * A generic buffer to hold the various objects that need
  * to be cached in RAM from the CDS non-volatile storage.
  */
 typedef union CFE_ES_CDS_AccessCacheData
 {
-    char                     Sig[CFE_ES_CDS_SIGNATURE_LEN]; /**< A signature field (beginning or end) */
-    uint32                   RegistrySize;                  /**< Registry Size Field */
-    uint32                   Zero[4];                       /**< Used when clearing CDS content */
-    CFE_ES_GenPoolBD_t       Desc;                          /**< A generic block descriptor */
-    CFE_ES_CDS_BlockHeader_t BlockHeader;                   /**< A user block header */
-    CFE_ES_CDS_RegRec_t      RegEntry;                      /**< A registry entry */
+    char                       Sig[CFE_ES_CDS_SIGNATURE_LEN]; /**< A signature field (beginning or end) */
+    uint32                     RegistrySize;                  /**< Registry Size Field */
+    uint32                     Zero[4];                       /**< Used when clearing CDS content */
+    CFE_ES_GenPoolBD_t         Desc;                          /**< A generic block descriptor */
+    CFE_ES_CDS_BlockHeader_t   BlockHeader;                   /**< A user block header */
+    CFE_ES_CDS_JournalHeader_t JournalHeader;                 /**< The write journal header */
+    CFE_ES_CDS_RegRec_t        RegEntry;                      /**< A registry entry */
 } CFE_ES_CDS_AccessCacheData_t;
 
 typedef struct CFE_ES_CDS_AccessCache
@@ -160,6 +193,20 @@ typedef struct
      */
     CFE_ES_CDS_AccessCache_t Cache;
 
+    /*
+     * Working buffer for the data of a journal entry
+     * Holds the old content of the range being changed while the new
+     * block CRC is computed, then the new content while it is committed.
+     */
+    uint8 JournalBuffer[CFE_PLATFORM_ES_CDS_JOURNAL_SIZE];
+
+    /*
+     * CDS offset of the block header of a journal entry that was committed
+     * but not yet cleared, or 0 if there is none.  A failed apply leaves the
+     * entry pending, so it must be cleared before the block is rewritten in full.
+     */
+    size_t PendingJournalBlock;
+
     osal_id_t           GenMutex;       /**< \brief Mutex that controls access to CDS and registry */
     size_t              TotalSize;      /**< \brief Total size of the CDS as reported by BSP */
     size_t              DataSize;       /**< \brief Size of actual user data pool */
@@ -182,6 +229,8 @@ typedef struct CFE_ES_CDS_PersistentHeader
     CDS_RESERVE_SPACE(SignatureBegin, CFE_ES_CDS_SIGNATURE_LEN);
     CDS_RESERVE_SPACE(RegistrySize, sizeof(uint32));
     CDS_RESERVE_SPACE(RegistryContent, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES * sizeof(CFE_ES_CDS_RegRec_t));
+    CDS_RESERVE_SPACE(JournalHeader, sizeof(CFE_ES_CDS_JournalHeader_t));
+    CDS_RESERVE_SPACE(JournalData, CFE_PLATFORM_ES_CDS_JOURNAL_SIZE);
 } CFE_ES_CDS_PersistentHeader_t;
 
 typedef struct CFE_ES_CDS_PersistentTrailer
@@ -523,6 +572,68 @@ int32 CFE_ES_RebuildCDS(void);
 ******************************************************************************/
 int32 CFE_ES_UpdateCDSRegistry(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Commits a change to part of a CDS block through the write journal
+**
+** \par Description
+**        Stores the change described by the entry, with the data held in the
+**        journal buffer, in the CDS write journal and then applies it to the
+**        block.  If a reset occurs before the change has been fully applied,
+**        #CFE_ES_ReplayCDSJournal will complete it when the CDS is rebuilt,
+**        so the block is left with either its old or its new content.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The CDS access mutex must be held by the caller, so this does not
+**           write to the system log; the caller reports any error
+**        -# The data must already be in the journal buffer, and the CRC
+**           field of the entry is computed by this function
+**
+** \param[inout] Entry  The journal entry to commit
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_CDS_ACCESS_ERROR         \copydoc CFE_ES_CDS_ACCESS_ERROR
+**
+******************************************************************************/
+int32 CFE_ES_CDS_JournalCommit(CFE_ES_CDS_JournalHeader_t *Entry);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Clears the pending entry in the CDS write journal
+**
+** \par Description
+**        Writes an empty entry, with a matching CRC, over the journal header
+**        so that #CFE_ES_ReplayCDSJournal will not apply the previous entry.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The CDS access mutex must be held by the caller
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_CDS_ACCESS_ERROR         \copydoc CFE_ES_CDS_ACCESS_ERROR
+**
+******************************************************************************/
+int32 CFE_ES_CDS_JournalClear(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Completes a journaled CDS write that was interrupted by a reset
+**
+** \par Description
+**        Checks the CDS write journal for a valid pending entry, and if one
+**        is found, applies it to its block and clears the journal.  An entry
+**        which does not pass its CRC check was not completely stored before
+**        the reset, so the block it refers to was never changed and the
+**        entry is discarded.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Assumes the validity of the CDS has already been determined
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_CDS_ACCESS_ERROR         \copydoc CFE_ES_CDS_ACCESS_ERROR
+**
+******************************************************************************/
+int32 CFE_ES_ReplayCDSJournal(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Creates a Full CDS name from application name and CDS name
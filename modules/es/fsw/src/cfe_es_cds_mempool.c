@@ -217,6 +217,17 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
                      (unsigned long)CDSRegRecPtr->BlockSize);
             Status = CFE_ES_CDS_INVALID_SIZE;
         }
+        else if (CDS->PendingJournalBlock == CDSRegRecPtr->BlockOffset && CFE_ES_CDS_JournalClear() != CFE_SUCCESS)
+        {
+            /*
+             * A journal entry still pending for this block holds older data, which would be
+             * written over the new content if it were replayed after a reset, so it must be
+             * cleared before the block is rewritten.
+             */
+            snprintf(LogMessage, sizeof(LogMessage), "Err clearing journal entry in CDS (Stat=0x%08x)\n",
+                     (unsigned int)CDS->Cache.AccessStatus);
+            Status = CFE_ES_CDS_ACCESS_ERROR;
+        }
         else
         {
             UserDataSize = CDSRegRecPtr->BlockSize;
@@ -265,6 +276,125 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CDSBlockWriteRange
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t Offset, size_t Size)
+{
+    CFE_ES_CDS_Instance_t *    CDS = &CFE_ES_Global.CDSVars;
+    char                       LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                      Status;
+    size_t                     BlockSize;
+    size_t                     UserDataSize;
+    const uint8 *              NewDataPtr;
+    CFE_ES_CDS_JournalHeader_t Entry;
+    CFE_ES_CDS_RegRec_t *      CDSRegRecPtr;
+
+    /*
+     * A change that does not fit in the journal cannot be made atomically,
+     * so the whole block is rewritten instead, as CFE_ES_CDSBlockWrite() does.
+     */
+    if (Size > sizeof(CDS->JournalBuffer))
+    {
+        return CFE_ES_CDSBlockWrite(Handle, DataToWrite);
+    }
+
+    /* Ensure the the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
+    CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
+
+    /*
+     * A CDS block ID must be accessed by only one thread at a time.
+     * Checking the validity of the block requires access to the registry.
+     */
+    CFE_ES_LockCDS();
+
+    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+        if (Status != CFE_SUCCESS)
+        {
+            snprintf(LogMessage, sizeof(LogMessage), "Invalid Handle or Block Descriptor.\n");
+        }
+        else if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+        {
+            snprintf(LogMessage, sizeof(LogMessage), "Block size %lu invalid, expected %lu\n", (unsigned long)BlockSize,
+                     (unsigned long)CDSRegRecPtr->BlockSize);
+            Status = CFE_ES_CDS_INVALID_SIZE;
+        }
+        else
+        {
+            UserDataSize = CDSRegRecPtr->BlockSize;
+            UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
+
+            if (Offset > UserDataSize || Size > (UserDataSize - Offset))
+            {
+                snprintf(LogMessage, sizeof(LogMessage), "Range %lu+%lu outside block size %lu\n",
+                         (unsigned long)Offset, (unsigned long)Size, (unsigned long)UserDataSize);
+                Status = CFE_ES_BAD_ARGUMENT;
+            }
+            else if (Size > 0)
+            {
+                NewDataPtr        = (const uint8 *)DataToWrite + Offset;
+                Entry.BlockOffset = CDSRegRecPtr->BlockOffset;
+                Entry.DataOffset  = CDSRegRecPtr->BlockOffset + sizeof(CFE_ES_CDS_BlockHeader_t) + Offset;
+                Entry.DataSize    = Size;
+
+                /* The current CRC and the old content of the range give the new CRC, without reading the rest */
+                Status =
+                    CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
+                if (Status == CFE_SUCCESS &&
+                    CFE_PSP_ReadFromCDS(CDS->JournalBuffer, Entry.DataOffset, Size) != CFE_PSP_SUCCESS)
+                {
+                    Status = CFE_ES_CDS_ACCESS_ERROR;
+                }
+
+                if (Status != CFE_SUCCESS)
+                {
+                    snprintf(LogMessage, sizeof(LogMessage), "Err reading block from CDS @Offset=0x%08lx\n",
+                             (unsigned long)CDSRegRecPtr->BlockOffset);
+                }
+                else
+                {
+                    Entry.BlockCrc =
+                        CFE_ES_UpdateCRC(CDS->Cache.Data.BlockHeader.Crc, CDS->JournalBuffer, NewDataPtr, Size,
+                                         UserDataSize - Offset - Size, CFE_MISSION_ES_DEFAULT_CRC);
+
+                    memcpy(CDS->JournalBuffer, NewDataPtr, Size);
+
+                    Status = CFE_ES_CDS_JournalCommit(&Entry);
+                    if (Status != CFE_SUCCESS)
+                    {
+                        snprintf(LogMessage, sizeof(LogMessage),
+                                 "Err committing journal entry to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                                 (unsigned int)Status, (unsigned long)Entry.DataOffset);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockCDS();
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_CDSBlockRead
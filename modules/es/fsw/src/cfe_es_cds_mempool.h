@@ -87,6 +87,16 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset);
  */
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a range within a block of data to CDS
+ *
+ * DataToWrite refers to the whole block content, of which only the bytes
+ * from Offset to Offset + Size are written.  The change is committed
+ * through the CDS write journal.
+ */
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t Offset, size_t Size);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Reads a block of data from CDS
@@ -0,0 +1,131 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ *  Purpose:
+ *  This file contains the Internal interface for the cFE table driven CRC
+ *  algorithms.
+ *
+ *  References:
+ *     Flight Software Branch C Coding Standard Version 1.0a
+ *     cFE Flight Software Application Developers Guide
+ *
+ *  Notes:
+ *  These operate on the raw CRC register, without any initial value or final
+ *  XOR applied, so a CRC can be computed over several blocks by passing the
+ *  result from one block into the next.  CFE_ES_CalculateCRC() applies the
+ *  rest of each algorithm definition.
+ *
+ */
+
+#ifndef CFE_ES_CRC_H
+#define CFE_ES_CRC_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*****************************************************************************/
+/*
+** Function prototypes
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Updates a CRC-8/SMBUS register with a block of data
+**
+** \param[in] BufPtr      Pointer to the data
+** \param[in] DataLength  Number of bytes of data
+** \param[in] Crc         Register value before the data
+**
+** \return Register value after the data
+*/
+uint8 CFE_ES_CalculateCRC8(const uint8 *BufPtr, size_t DataLength, uint8 Crc);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Updates a CRC-16/ARC register with a block of data
+**
+** \param[in] BufPtr      Pointer to the data
+** \param[in] DataLength  Number of bytes of data
+** \param[in] Crc         Register value before the data
+**
+** \return Register value after the data
+*/
+uint16 CFE_ES_CalculateCRC16(const uint8 *BufPtr, size_t DataLength, uint16 Crc);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Updates a CRC-32/ISO-HDLC register with a block of data
+**
+** \param[in] BufPtr      Pointer to the data
+** \param[in] DataLength  Number of bytes of data
+** \param[in] Crc         Register value before the data
+**
+** \return Register value after the data
+*/
+uint32 CFE_ES_CalculateCRC32(const uint8 *BufPtr, size_t DataLength, uint32 Crc);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Advances a CRC-8/SMBUS register over a run of zero bytes
+**
+** \par Assumptions, External Events, and Notes:
+**        The time taken is proportional to the logarithm of the length, not the length.
+**
+** \param[in] Crc     Register value before the zero bytes
+** \param[in] Length  Number of zero bytes
+**
+** \return Register value after the zero bytes
+*/
+uint8 CFE_ES_ShiftCRC8(uint8 Crc, size_t Length);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Advances a CRC-16/ARC register over a run of zero bytes
+**
+** \par Assumptions, External Events, and Notes:
+**        The time taken is proportional to the logarithm of the length, not the length.
+**
+** \param[in] Crc     Register value before the zero bytes
+** \param[in] Length  Number of zero bytes
+**
+** \return Register value after the zero bytes
+*/
+uint16 CFE_ES_ShiftCRC16(uint16 Crc, size_t Length);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Advances a CRC-32/ISO-HDLC register over a run of zero bytes
+**
+** \par Assumptions, External Events, and Notes:
+**        The time taken is proportional to the logarithm of the length, not the length.
+**
+** \param[in] Crc     Register value before the zero bytes
+** \param[in] Length  Number of zero bytes
+**
+** \return Register value after the zero bytes
+*/
+uint32 CFE_ES_ShiftCRC32(uint32 Crc, size_t Length);
+
+#endif /* CFE_ES_CRC_H */
@@ -45,6 +45,67 @@
 ** Functions
 */
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolGetSizeClass
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the size class of a requested block size, which is the
+ * base 2 logarithm of the size, rounded up.  This is computed with
+ * a fixed number of steps, regardless of the size.
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolGetSizeClass(size_t ReqSize)
+{
+    size_t Value;
+    uint16 SizeClass;
+
+    if (ReqSize <= 1)
+    {
+        return 0;
+    }
+
+    Value = ReqSize - 1;
+
+#if (SIZE_MAX > 0xFFFFFFFF)
+    if ((Value >> 31) > 1)
+    {
+        /* Larger than 32 bits, use the last class */
+        return CFE_ES_GENPOOL_NUM_SIZE_CLASSES - 1;
+    }
+#endif
+
+    /* Find the position of the highest bit set in the value */
+    SizeClass = 1;
+    if (Value >= 0x10000)
+    {
+        Value >>= 16;
+        SizeClass += 16;
+    }
+    if (Value >= 0x100)
+    {
+        Value >>= 8;
+        SizeClass += 8;
+    }
+    if (Value >= 0x10)
+    {
+        Value >>= 4;
+        SizeClass += 4;
+    }
+    if (Value >= 0x4)
+    {
+        Value >>= 2;
+        SizeClass += 2;
+    }
+    if (Value >= 0x2)
+    {
+        SizeClass += 1;
+    }
+
+    return SizeClass;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_GenPoolFindBucket
@@ -58,13 +119,17 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Start at the first bucket that could possibly fit this size class,
+     * from the map computed when the pool was initialized.  Normally this
+     * bucket fits, unless there are several block sizes within the same
+     * power of two, in which case this only checks those few.
+     */
+    Index = PoolRecPtr->SizeClassMap[CFE_ES_GenPoolGetSizeClass(ReqSize)];
+
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
-        {
-            /* it fits - stop here */
-            break;
-        }
+        ++Index;
     }
 
     /*
@@ -328,6 +393,21 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class map.  For each class, find the first bucket
+     * that can hold the smallest size in that class, which is one more
+     * than the largest size of the previous class.
+     */
+    i = 0;
+    for (j = 0; j < CFE_ES_GENPOOL_NUM_SIZE_CLASSES; ++j)
+    {
+        while (i < NumBlockSizes && j > 0 && PoolRecPtr->Buckets[i].BlockSize <= ((size_t)1 << (j - 1)))
+        {
+            ++i;
+        }
+        PoolRecPtr->SizeClassMap[j] = i;
+    }
+
     return CFE_SUCCESS;
 }
 
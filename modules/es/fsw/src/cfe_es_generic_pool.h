@@ -48,6 +48,15 @@
 #define CFE_ES_MEMORY_ALLOCATED   ((uint16)0xaaaa)
 #define CFE_ES_MEMORY_DEALLOCATED ((uint16)0xdddd)
 
+/**
+ * \brief Number of size classes used to look up the bucket for a block size
+ *
+ * Requested sizes are grouped by their base 2 logarithm, rounded up, such
+ * that class N holds sizes greater than 2^(N-1) up to and including 2^N.
+ * A 32 bit size needs 33 classes, any larger size is in the last class.
+ */
+#define CFE_ES_GENPOOL_NUM_SIZE_CLASSES 33
+
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
@@ -116,6 +125,12 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * Index of the first bucket which is large enough for the smallest size in each
+     * size class, so finding the bucket for a size does not need to search all buckets.
+     */
+    uint16 SizeClassMap[CFE_ES_GENPOOL_NUM_SIZE_CLASSES];
 };
 
 /*****************************************************************************/
@@ -145,6 +160,30 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
                                size_t AlignSize, uint16 NumBlockSizes, const size_t *BlockSizeList,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the size class of a requested block size
+ *
+ * This is the base 2 logarithm of the size, rounded up, limited to
+ * #CFE_ES_GENPOOL_NUM_SIZE_CLASSES - 1.
+ *
+ * \param[in]   ReqSize        Size of block requested
+ *
+ * \return Size class, used as an index into the pool size class map
+ */
+uint16 CFE_ES_GenPoolGetSizeClass(size_t ReqSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the smallest bucket that can hold the requested size
+ *
+ * \param[in]   PoolRecPtr     Pointer to pool structure
+ * \param[in]   ReqSize        Size of block requested
+ *
+ * \return Bucket ID (non-zero), or zero if the size is larger than all buckets
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Gets a block from the pool
@@ -71,6 +71,19 @@ typedef struct
     uint32          NumJobsRunning; /**< Current Number of active jobs (updated by background task) */
 } CFE_ES_BackgroundTaskState_t;
 
+/*
+ * Per-task syslog rate limit state
+ *
+ * Each entry is only ever updated by the task it belongs to, so no lock is needed.
+ */
+typedef struct
+{
+    osal_id_t TaskId;      /**< OSAL task which is using this entry */
+    OS_time_t PeriodStart; /**< Time at which the current rate limit period started */
+    uint32    Count;       /**< Messages logged in the current period */
+    uint32    Suppressed;  /**< Messages discarded since the last one logged */
+} CFE_ES_SysLogProducer_t;
+
 /*
  * Background log dump state structure
  *
@@ -143,6 +156,12 @@ typedef struct
     */
     osal_id_t SharedDataMutex;
 
+    /*
+    ** System Log Mutex
+    ** Only held while reserving space in and copying a message to the syslog buffer
+    */
+    osal_id_t SysLogMutex;
+
     /*
     ** Performance Data Mutex
     */
@@ -208,6 +227,26 @@ typedef struct
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+    /*
+     * Per-task performance data rings, plus one shared ring for non-OSAL callers
+     */
+    uint32                PerfRingGeneration;
+    CFE_ES_PerfTaskRing_t PerfTaskRing[OS_MAX_TASKS + 1];
+#endif
+
+#if (CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT > 0)
+    /*
+     * Syslog rate limit state, at the same index as the OSAL task table entry
+     */
+    CFE_ES_SysLogProducer_t SysLogProducer[OS_MAX_TASKS];
+#endif
+
+    /*
+     * Entries of the ES startup script, which are started once it has been read
+     */
+    CFE_ES_StartupGraph_t StartupGraph;
+
     /*
      * Persistent state data associated with background app table scans
      */
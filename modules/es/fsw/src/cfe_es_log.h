@@ -163,34 +163,78 @@ void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer);
  * \brief Write a printf-style formatted string to the system log
  *
  * This is a drop-in replacement for the existing CFE_ES_WriteToSysLog() API
- * that does _not_ perform any synchronization or locking.  It is intended for
- * logging from within the ES subsystem where the appropriate lock is
- * already held for other reasons.
+ * that does _not_ take the ES shared data lock or apply the rate limit.  It is
+ * intended for logging from within the ES subsystem where the shared data lock
+ * is already held for other reasons.
  *
- * \note This function requires external thread synchronization
+ * \note Only the syslog mutex is taken, which is never held while taking any
+ * other lock, so this is safe to call with the shared data lock held.
  */
 int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Reserve space for a new message in the system log buffer
+ *
+ * Advances the log write position past the space for a message of the given
+ * length, and returns the position of the reserved space.  The caller must
+ * copy the message into that space before releasing the lock.
+ *
+ * If there is not sufficient space to completely store the message, then the
+ * behavior depends on the "LogMode" setting.
+ *
+ * If "LogMode" is set to DISCARD, then the length will be reduced to fit
+ * in the available space, or set to zero if no space exists.
+ *
+ * If "LogMode" is set to OVERWRITE, then the space is reserved at the start
+ * of the buffer, over the oldest message(s) in the system log.
+ *
+ * \param[inout] MessageLenPtr Length of the message, updated to the length reserved
+ * \param[out]   WriteIdxPtr   Set to the position of the reserved space
+ *
+ * \note This function requires external thread synchronization
+ * \sa CFE_ES_SysLogSetMode()
+ */
+int32 CFE_ES_SysLogReserve_Unsync(size_t *MessageLenPtr, size_t *WriteIdxPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Append a complete pre-formatted string to the ES SysLog
  *
  * The new message will be copied to the current write location in the
  * system log buffer.  If there is not sufficient space to completely store
- * the message, then the behavior depends on the "LogMode" setting.
+ * the message, then the behavior depends on the "LogMode" setting, as described
+ * in CFE_ES_SysLogReserve_Unsync().
  *
- * If "LogMode" is set to DISCARD, then the message will be truncated
- * to fit in the available space, or completely discarded if no space exists.
- *
- * If "LogMode" is set to OVERWRITE, then the oldest message(s) in the
- * system log will be overwritten with this new message.
+ * Only the syslog mutex is held while reserving space for the message and
+ * copying it in.  The ES shared data lock is not used.
  *
  * \param LogString     Message to append
  *
- * \note This function requires external thread synchronization
  * \sa CFE_ES_SysLogSetMode()
  */
-int32 CFE_ES_SysLogAppend_Unsync(const char *LogString);
+int32 CFE_ES_SysLogAppend(const char *LogString);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Apply the per-task syslog rate limit
+ *
+ * Checks whether the calling task may write another message to the system
+ * log in the current rate limit period, and counts the message as
+ * suppressed if not.  This is checked before formatting the message, so
+ * that suppressed messages cost as little as possible.
+ *
+ * The limit only applies once the system is operational, and only to OSAL
+ * tasks.  Each task only updates its own entry, so no lock is needed.
+ *
+ * \param[out] SuppressedPtr Set to the number of messages suppressed since
+ *                           the last one logged by this task, to be reported
+ *                           by the caller.  Only nonzero if the message is allowed.
+ *
+ * \return true if the message should be logged, false if it is suppressed
+ * \sa #CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT
+ */
+bool CFE_ES_SysLogRateCheck(uint32 *SuppressedPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -243,7 +287,7 @@ int32 CFE_ES_SysLogSetMode(CFE_ES_LogMode_Enum_t Mode);
 /**
  * \brief Format a message intended for output to the system log
  *
- * This function prepares a complete message for passing into CFE_ES_SysLogAppend_Unsync(),
+ * This function prepares a complete message for passing into CFE_ES_SysLogAppend(),
  * based on the given vsnprintf-style specification string and argument list.
  *
  * The message is prefixed with a time stamp based on the current time, followed by the
@@ -259,7 +303,7 @@ int32 CFE_ES_SysLogSetMode(CFE_ES_LogMode_Enum_t Mode);
  * \param SpecStringPtr Printf-style format string
  * \param ArgPtr        Variable argument list as obtained by va_start() in the caller
  *
- * \sa CFE_ES_SysLogAppend_Unsync()
+ * \sa CFE_ES_SysLogAppend()
  */
 void CFE_ES_SysLog_vsnprintf(char *Buffer, size_t BufferSize, const char *SpecStringPtr, va_list ArgPtr);
 
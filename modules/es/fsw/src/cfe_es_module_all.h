@@ -48,6 +48,7 @@
 #include "cfe_es_mempool.h"
 #include "cfe_es_global.h"
 #include "cfe_es_cds_mempool.h"
+#include "cfe_es_crc.h"
 #include "cfe_es_events.h"
 #include "cfe_es_start.h"
 #include "cfe_es_task.h"
@@ -119,7 +119,17 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
      * may change even between checking the state and checking the value.
      * This shouldn't be a big deal, as the result should still be meaningful
      * for a progress report, and the actual 32-bit counters should be atomic */
-    if (CurrentState > CFE_ES_PerfDumpState_IDLE && CurrentState < CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES)
+    if (CurrentState == CFE_ES_PerfDumpState_MERGE_TASK_RINGS)
+    {
+        /* per-task rings are being merged into the perf log,
+         * report the data count which the perf log will have after merging */
+        Result = Perf->MetaData.DataCount + PerfDumpState->StateCounter;
+        if (Result > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        {
+            Result = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+        }
+    }
+    else if (CurrentState > CFE_ES_PerfDumpState_IDLE && CurrentState < CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES)
     {
         /* dump is requested but not yet to entry writing state,
          * report the entire data count from perf log */
@@ -179,6 +189,10 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+            /* entries in the per-task rings from before this are discarded on the next write */
+            ++CFE_ES_Global.PerfRingGeneration;
+#endif
             Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
@@ -230,7 +244,10 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
         PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
     {
+        /* the dump relies on this being done under the mutex, see CFE_ES_PerfTaskRing_t */
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
         Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
         /* Copy out the string, using default if unspecified */
         Status = CFE_FS_ParseInputFileNameEx(PerfDumpState->DataFileName, CmdPtr->DataFileName,
@@ -357,6 +374,12 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
                     break;
 
+                case CFE_ES_PerfDumpState_MERGE_TASK_RINGS:
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+                    State->StateCounter = CFE_ES_PerfTaskRingMergeStart();
+#endif
+                    break;
+
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
                 case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
                     State->StateCounter = 1;
@@ -436,6 +459,12 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
             BlockSize = 0;
             switch (State->CurrentState)
             {
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+                case CFE_ES_PerfDumpState_MERGE_TASK_RINGS:
+                    CFE_ES_PerfTaskRingMergeNext();
+                    break;
+#endif
+
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
                     /* Zero cFE header, then fill in fields */
                     CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
@@ -589,7 +618,6 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
     CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
     CFE_ES_PerfData_t *    Perf;
 
     /*
@@ -639,6 +667,13 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
     CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
 
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+
+    /* record into the ring of the calling task, which does not need the perflog mutex */
+    CFE_ES_PerfTaskRingAdd(Marker, &EntryData);
+
+#else
+
     /*
      * Acquire the perflog mutex before writing into the shared area.
      * Note this lock is held for long periods while a background dump
@@ -654,27 +689,7 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
     {
         /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
-
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            DataEnd = 0;
-        }
-        Perf->MetaData.DataEnd = DataEnd;
-
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            Perf->MetaData.DataCount++;
-        }
-        else
-        {
-            /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
-            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
-        }
+        CFE_ES_PerfDataBufferAppend(Perf, &EntryData);
 
         /* waiting for trigger */
         if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
@@ -711,4 +726,283 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     }
 
     OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+#endif /* CFE_PLATFORM_ES_PERF_TASK_RING_SIZE */
 }
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfDataBufferAppend
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfDataBufferAppend(CFE_ES_PerfData_t *Perf, const CFE_ES_PerfDataEntry_t *EntryData)
+{
+    uint32 DataEnd;
+
+    DataEnd                   = Perf->MetaData.DataEnd;
+    Perf->DataBuffer[DataEnd] = *EntryData;
+
+    ++DataEnd;
+    if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        DataEnd = 0;
+    }
+    Perf->MetaData.DataEnd = DataEnd;
+
+    /* we have filled up the buffer */
+    if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        Perf->MetaData.DataCount++;
+    }
+    else
+    {
+        /* after the buffer fills up start and end point to the same entry since we
+           are now overwriting old data */
+        Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+    }
+}
+
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfTaskRingAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfTaskRingAdd(uint32 Marker, const CFE_ES_PerfDataEntry_t *EntryData)
+{
+    CFE_ES_PerfData_t *              Perf;
+    CFE_ES_PerfTaskRing_t *          Ring;
+    volatile CFE_ES_PerfDataEntry_t *RingEntry;
+    osal_index_t                     TaskIndex;
+    uint32                           WriteCount;
+    uint32                           Limit;
+    bool                             IsShared;
+
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /*
+     * Each OSAL task has its own ring, at the same index as its OSAL table entry.
+     * Callers which are not OSAL tasks use the extra ring at the end, which is shared
+     * and so still needs the perflog mutex.
+     */
+    IsShared = (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId(), &TaskIndex) != OS_SUCCESS);
+    if (IsShared)
+    {
+        Ring = &CFE_ES_Global.PerfTaskRing[OS_MAX_TASKS];
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    }
+    else
+    {
+        Ring = &CFE_ES_Global.PerfTaskRing[TaskIndex];
+    }
+
+    /* discard anything left over from a previous capture */
+    if (Ring->Generation != CFE_ES_Global.PerfRingGeneration)
+    {
+        Ring->Generation = CFE_ES_Global.PerfRingGeneration;
+        Ring->Triggered  = false;
+        Ring->WriteCount = 0;
+    }
+
+    WriteCount = Ring->WriteCount;
+
+    /* the mutex is only taken for the state change, which happens once per capture */
+    if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER &&
+        CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+    {
+        CFE_ES_PerfTaskRingSetState(CFE_ES_PERF_WAITING_FOR_TRIGGER, CFE_ES_PERF_TRIGGERED, IsShared);
+    }
+
+    if (!Ring->Triggered && Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
+    {
+        Ring->Triggered    = true;
+        Ring->TriggerStart = WriteCount;
+    }
+
+    /*
+     * After the trigger, stop before overwriting the entries that the trigger
+     * mode keeps.  This is done per ring, as there is no shared trigger count.
+     */
+    Limit = CFE_PLATFORM_ES_PERF_TASK_RING_SIZE;
+    if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER)
+    {
+        Limit /= 2;
+    }
+
+    if (!Ring->Triggered || Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END ||
+        (WriteCount - Ring->TriggerStart) < Limit)
+    {
+        /*
+         * The entry is written through a volatile pointer, so the compiler cannot
+         * move these stores after the store of the count below.  This is not a
+         * hardware barrier, the merge relies on the stop for ordering instead,
+         * see CFE_ES_PerfTaskRing_t.
+         */
+        RingEntry               = &Ring->Entry[WriteCount & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)];
+        RingEntry->Data         = EntryData->Data;
+        RingEntry->TimerUpper32 = EntryData->TimerUpper32;
+        RingEntry->TimerLower32 = EntryData->TimerLower32;
+
+        /* update the count only after the entry is complete */
+        Ring->WriteCount = WriteCount + 1;
+
+        if (Ring->Triggered && Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END &&
+            Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
+        {
+            CFE_ES_PerfTaskRingSetState(CFE_ES_PERF_TRIGGERED, CFE_ES_PERF_IDLE, IsShared);
+        }
+    }
+
+    if (IsShared)
+    {
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfTaskRingSetState
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfTaskRingSetState(uint32 FromState, uint32 ToState, bool IsLocked)
+{
+    CFE_ES_PerfData_t *Perf;
+
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    if (!IsLocked)
+    {
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    }
+
+    /* a command may have changed the state while getting the lock */
+    if (Perf->MetaData.State == FromState)
+    {
+        Perf->MetaData.State = ToState;
+    }
+
+    if (!IsLocked)
+    {
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfTaskRingMergeStart
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfTaskRingMergeStart(void)
+{
+    CFE_ES_PerfData_t *    Perf;
+    CFE_ES_PerfTaskRing_t *Ring;
+    uint32                 i;
+    uint32                 Total;
+
+    Perf  = &CFE_ES_Global.ResetDataPtr->Perf;
+    Total = 0;
+
+    /* nothing captured since boot, keep any data preserved over a processor reset */
+    if (CFE_ES_Global.PerfRingGeneration == 0)
+    {
+        return 0;
+    }
+
+    Perf->MetaData.TriggerCount = 0;
+    Perf->MetaData.DataStart    = 0;
+    Perf->MetaData.DataEnd      = 0;
+    Perf->MetaData.DataCount    = 0;
+
+    for (i = 0; i <= OS_MAX_TASKS; ++i)
+    {
+        Ring = &CFE_ES_Global.PerfTaskRing[i];
+
+        if (Ring->Generation != CFE_ES_Global.PerfRingGeneration)
+        {
+            Ring->ReadEnd = 0;
+        }
+        else
+        {
+            Ring->ReadEnd = Ring->WriteCount;
+        }
+
+        /* only the most recent entries remain in the ring */
+        if (Ring->ReadEnd > CFE_PLATFORM_ES_PERF_TASK_RING_SIZE)
+        {
+            Ring->ReadCount = Ring->ReadEnd - CFE_PLATFORM_ES_PERF_TASK_RING_SIZE;
+        }
+        else
+        {
+            Ring->ReadCount = 0;
+        }
+
+        Total += Ring->ReadEnd - Ring->ReadCount;
+    }
+
+    return Total;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfTaskRingMergeNext
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfTaskRingMergeNext(void)
+{
+    CFE_ES_PerfData_t *           Perf;
+    CFE_ES_PerfTaskRing_t *       Ring;
+    CFE_ES_PerfTaskRing_t *       OldestRing;
+    const CFE_ES_PerfDataEntry_t *EntryPtr;
+    const CFE_ES_PerfDataEntry_t *OldestEntry;
+    uint32                        i;
+
+    Perf        = &CFE_ES_Global.ResetDataPtr->Perf;
+    OldestRing  = NULL;
+    OldestEntry = NULL;
+
+    /* each ring is already in time order, so the oldest entry is at the head of one of them */
+    for (i = 0; i <= OS_MAX_TASKS; ++i)
+    {
+        Ring = &CFE_ES_Global.PerfTaskRing[i];
+        if (Ring->ReadCount != Ring->ReadEnd)
+        {
+            EntryPtr = &Ring->Entry[Ring->ReadCount & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)];
+            if (OldestEntry == NULL || EntryPtr->TimerUpper32 < OldestEntry->TimerUpper32 ||
+                (EntryPtr->TimerUpper32 == OldestEntry->TimerUpper32 &&
+                 EntryPtr->TimerLower32 < OldestEntry->TimerLower32))
+            {
+                OldestRing  = Ring;
+                OldestEntry = EntryPtr;
+            }
+        }
+    }
+
+    if (OldestRing != NULL)
+    {
+        if (OldestRing->Triggered && OldestRing->ReadCount >= OldestRing->TriggerStart)
+        {
+            Perf->MetaData.TriggerCount++;
+        }
+
+        ++OldestRing->ReadCount;
+        CFE_ES_PerfDataBufferAppend(Perf, OldestEntry);
+    }
+}
+
+#endif /* CFE_PLATFORM_ES_PERF_TASK_RING_SIZE */
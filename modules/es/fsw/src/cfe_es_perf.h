@@ -38,6 +38,7 @@
 #include "common_types.h"
 #include "osconfig.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_perfdata_typedef.h"
 
 /*
 **  Defines
@@ -74,6 +75,7 @@ typedef enum
     CFE_ES_PerfDumpState_OPEN_FILE,           /* Opening of the output file */
     CFE_ES_PerfDumpState_DELAY,               /* Wait-state to ensure in-progress writes are finished */
     CFE_ES_PerfDumpState_LOCK_DATA,           /* Locking of the global data structure */
+    CFE_ES_PerfDumpState_MERGE_TASK_RINGS,    /* Merge the per-task rings into the Perf Log (throttled) */
     CFE_ES_PerfDumpState_WRITE_FS_HDR,        /* Write the CFE FS file header */
     CFE_ES_PerfDumpState_WRITE_PERF_METADATA, /* Write the Perf global metadata */
     CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES,  /* Write the Perf Log entries (throttled) */
@@ -112,6 +114,39 @@ typedef struct
     size_t    FileSize;                      /* Total file size, for progress reporing in telemetry */
 } CFE_ES_PerfDumpGlobal_t;
 
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+
+/*
+ * Per-task performance data ring
+ *
+ * When CFE_PLATFORM_ES_PERF_TASK_RING_SIZE is nonzero, there is one of these
+ * per OSAL task, indexed the same as the OSAL task table, plus one more shared
+ * ring for callers that are not OSAL tasks.  Only the owning task writes to its
+ * ring, so no lock is needed.  The shared ring is written while holding the
+ * perf data mutex.
+ *
+ * The rings are only read by the background dump, after the perf log state
+ * has become idle and in-progress writes have had time to finish.  The writers
+ * use no memory barrier, so the dump relies on this for ordering instead of on
+ * WriteCount: the state is changed to idle while holding the perf data mutex,
+ * so no write starts after that, and the dump then yields in its DELAY state
+ * and takes the same mutex before it reads the rings.  Entries written before
+ * the stop are long complete and visible to all CPUs by then.
+ */
+typedef struct
+{
+    volatile uint32 WriteCount;   /* entries written in this capture, only updated by the owning task */
+    uint32          Generation;   /* capture the entries belong to, stale rings are reset on next write */
+    bool            Triggered;    /* whether the trigger was seen by this ring in this capture */
+    uint32          TriggerStart; /* value of WriteCount when the trigger was seen */
+    uint32          ReadCount;    /* next entry to merge, only used by the dump */
+    uint32          ReadEnd;      /* end of entries to merge, only used by the dump */
+
+    CFE_ES_PerfDataEntry_t Entry[CFE_PLATFORM_ES_PERF_TASK_RING_SIZE];
+} CFE_ES_PerfTaskRing_t;
+
+#endif /* CFE_PLATFORM_ES_PERF_TASK_RING_SIZE */
+
 /*
  * Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -139,4 +174,72 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Append an entry to the performance data buffer
+ *
+ * Writes the entry at the end of the buffer, overwriting the oldest entry
+ * once the buffer is full.
+ *
+ * @note The perf data mutex must be held, or the log must be owned by the dump
+ */
+void CFE_ES_PerfDataBufferAppend(CFE_ES_PerfData_t *Perf, const CFE_ES_PerfDataEntry_t *EntryData);
+
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Record a performance data entry in the ring of the calling task
+ *
+ * Also handles the trigger, in place of the shared trigger logic
+ * of CFE_ES_PerfLogAdd().  After the trigger, a ring stops recording once
+ * it would overwrite the entries kept for the trigger mode.
+ *
+ * @param Marker    The performance marker of the entry
+ * @param EntryData The entry to record
+ */
+void CFE_ES_PerfTaskRingAdd(uint32 Marker, const CFE_ES_PerfDataEntry_t *EntryData);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Change the performance log state on behalf of a per-task ring
+ *
+ * The state is changed while holding the perf data mutex, so it cannot race
+ * with a start or stop command.  It is only changed if it still has the
+ * expected value once the mutex is held.
+ *
+ * @param FromState The state to change from
+ * @param ToState   The state to change to
+ * @param IsLocked  Whether the caller already holds the perf data mutex
+ */
+void CFE_ES_PerfTaskRingSetState(uint32 FromState, uint32 ToState, bool IsLocked);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Prepare to merge the per-task rings into the performance data buffer
+ *
+ * Clears the performance data buffer and sets up each ring with data from
+ * the current capture for merging.  If no capture was started since boot,
+ * the buffer is left as is, so data preserved over a processor reset can
+ * still be written.
+ *
+ * @note The perf data mutex must be held
+ *
+ * @returns Number of entries to merge
+ */
+uint32 CFE_ES_PerfTaskRingMergeStart(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Merge the next entry from the per-task rings
+ *
+ * Moves the oldest entry, by time stamp, of all the rings into the
+ * performance data buffer.
+ *
+ * @note The perf data mutex must be held
+ */
+void CFE_ES_PerfTaskRingMergeNext(void);
+
+#endif /* CFE_PLATFORM_ES_PERF_TASK_RING_SIZE */
+
 #endif /* CFE_ES_PERF_H */
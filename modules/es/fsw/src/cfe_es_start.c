@@ -91,7 +91,6 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
 
     /*
     ** Create the ES Shared Data Mutex
-    ** This must be done before ANY calls to CFE_ES_WriteToSysLog(), since this uses the mutex
     */
     ReturnCode = OS_MutSemCreate(&(CFE_ES_Global.SharedDataMutex), "ES_DATA_MUTEX", 0);
     if (ReturnCode != OS_SUCCESS)
@@ -116,6 +115,33 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         return;
     } /* end if */
 
+    /*
+    ** Create the ES System Log Mutex
+    ** This must be done before ANY calls to CFE_ES_WriteToSysLog(), since this uses the mutex
+    */
+    ReturnCode = OS_MutSemCreate(&CFE_ES_Global.SysLogMutex, "ES_SYSLOG_MUTEX", 0);
+    if (ReturnCode != OS_SUCCESS)
+    {
+        /* Cannot use SysLog here, since that requires the reset area to be set up */
+        OS_printf("ES Startup: Error: ES System Log Mutex could not be created. RC=0x%08X\n",
+                  (unsigned int)ReturnCode);
+
+        /*
+        ** Delay to allow the message to be printed
+        */
+        OS_TaskDelay(CFE_ES_PANIC_DELAY);
+
+        /*
+        ** cFE Cannot continue to start up.
+        */
+        CFE_PSP_Panic(CFE_PSP_PANIC_STARTUP_SEM);
+
+        /*
+         * Normally CFE_PSP_Panic() will not return but it will under UT
+         */
+        return;
+    }
+
     /*
     ** Initialize the Reset variables. This call is required
     ** Before most of the ES functions can be used including the
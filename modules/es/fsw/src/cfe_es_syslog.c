@@ -43,9 +43,11 @@
 **     to call B_Unsync() while A_Unsync() is executing or vice-versa.  The external
 **     lock must wait until A_Unsync() finishes before calling B_Unsync().
 **
-**     The expectation is that the required level of synchronization can be achieved
-**     using the existing ES shared data lock.  However, if it becomes necessary, this
-**     could be replaced with a finer grained syslog-specific lock.
+**     The required level of synchronization is achieved using the syslog mutex,
+**     which is separate from the ES shared data lock.  Messages are formatted
+**     before taking it, and writers hold it while reserving space in the buffer
+**     and copying the message in, so a reader holding the mutex never sees a
+**     partially written message.
 */
 
 /*
@@ -131,45 +133,23 @@ void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer)
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_ES_SysLogAppend_Unsync
+ * Function: CFE_ES_SysLogReserve_Unsync
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
+int32 CFE_ES_SysLogReserve_Unsync(size_t *MessageLenPtr, size_t *WriteIdxPtr)
 {
     int32  ReturnCode;
     size_t MessageLen;
     size_t WriteIdx;
     size_t EndIdx;
 
-    /*
-     * Sanity check - Make sure the message length is actually reasonable
-     * Do not allow any single message to consume more than half of the total log
-     * (even this may be overly generous)
-     */
-    MessageLen = strlen(LogString);
-    if (MessageLen > (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2))
-    {
-        MessageLen = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2;
-        ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
-    }
-    else
-    {
-        ReturnCode = CFE_SUCCESS;
-    }
-
-    /*
-     * Final sanity check -- do not bother logging empty messages
-     */
-    if (MessageLen == 0)
-    {
-        return ReturnCode;
-    }
+    ReturnCode = CFE_SUCCESS;
+    MessageLen = *MessageLenPtr;
 
     /*
-     * Real work begins --
      * Take a local snapshot of the head & tail index values
      *
      * WriteIdx -> indicates 1 byte past the end of the newest message
@@ -221,19 +201,9 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
     }
     else
     {
-        /*
-         * Copy the message in, EXCEPT for the last char which is probably a newline
-         */
-        memcpy(&CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx], LogString, MessageLen - 1);
+        *WriteIdxPtr = WriteIdx;
         WriteIdx += MessageLen;
 
-        /*
-         * Ensure the that last-written character is a newline.
-         * This would have been enforced already except in cases where
-         * the message got truncated.
-         */
-        CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx - 1] = '\n';
-
         /*
          * Keep track of the buffer endpoint for future reference
          */
@@ -250,9 +220,20 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
         ++CFE_ES_Global.ResetDataPtr->SystemLogEntryNum;
     }
 
-    return (ReturnCode);
+    *MessageLenPtr = MessageLen;
+
+    return ReturnCode;
 }
 
+/*******************************************************************
+ *
+ * Additional helper functions
+ *
+ * These functions either perform all necessary synchronization internally,
+ * or they have no specific synchronization requirements
+ *
+ *******************************************************************/
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_SysLogWrite_Unsync
@@ -276,17 +257,155 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
     /*
      * Append to the syslog buffer
      */
-    return CFE_ES_SysLogAppend_Unsync(TmpString);
+    return CFE_ES_SysLogAppend(TmpString);
 }
 
-/*******************************************************************
+/*----------------------------------------------------------------
  *
- * Additional helper functions
+ * Function: CFE_ES_SysLogAppend
  *
- * These functions either perform all necessary synchronization internally,
- * or they have no specific synchronization requirements
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
- *******************************************************************/
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SysLogAppend(const char *LogString)
+{
+    int32  ReturnCode;
+    int32  Status;
+    size_t MessageLen;
+    size_t WriteIdx;
+
+    /*
+     * Sanity check - Make sure the message length is actually reasonable
+     * Do not allow any single message to consume more than half of the total log
+     * (even this may be overly generous)
+     */
+    MessageLen = strlen(LogString);
+    if (MessageLen > (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2))
+    {
+        MessageLen = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2;
+        ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+    }
+    else
+    {
+        ReturnCode = CFE_SUCCESS;
+    }
+
+    /*
+     * Final sanity check -- do not bother logging empty messages
+     */
+    if (MessageLen == 0)
+    {
+        return ReturnCode;
+    }
+
+    /*
+     * The message was already formatted by the caller, so only the space
+     * reservation and the copy (at most half the log) are done under the lock.
+     * The copy must be under the lock, as otherwise the reserved space could be
+     * overwritten by a wrapping writer or cleared before the copy is finished.
+     */
+    WriteIdx = 0;
+    OS_MutSemTake(CFE_ES_Global.SysLogMutex);
+
+    Status = CFE_ES_SysLogReserve_Unsync(&MessageLen, &WriteIdx);
+
+    if (MessageLen > 0)
+    {
+        /*
+         * Copy the message in, EXCEPT for the last char which is probably a newline
+         */
+        memcpy(&CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx], LogString, MessageLen - 1);
+
+        /*
+         * Ensure the that last-written character is a newline.
+         * This would have been enforced already except in cases where
+         * the message got truncated.
+         */
+        CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx + MessageLen - 1] = '\n';
+    }
+
+    OS_MutSemGive(CFE_ES_Global.SysLogMutex);
+
+    if (Status != CFE_SUCCESS)
+    {
+        ReturnCode = Status;
+    }
+
+    return ReturnCode;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_SysLogRateCheck
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_SysLogRateCheck(uint32 *SuppressedPtr)
+{
+#if (CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT > 0)
+    CFE_ES_SysLogProducer_t *Producer;
+    osal_id_t                TaskId;
+    osal_index_t             TaskIndex;
+    OS_time_t                CurrTime;
+    int64                    ElapsedTime;
+#endif
+
+    *SuppressedPtr = 0;
+
+#if (CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT > 0)
+    /*
+     * Messages written during startup are never limited.  After that, each
+     * OSAL task has its own entry, at the same index as its OSAL table entry,
+     * so only the task itself ever updates it.  Other callers are not limited.
+     */
+    if (CFE_ES_Global.SystemState != CFE_ES_SystemState_OPERATIONAL)
+    {
+        return true;
+    }
+
+    TaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, TaskId, &TaskIndex) != OS_SUCCESS)
+    {
+        return true;
+    }
+
+    Producer = &CFE_ES_Global.SysLogProducer[TaskIndex];
+    CFE_PSP_GetTime(&CurrTime);
+
+    if (!OS_ObjectIdEqual(Producer->TaskId, TaskId))
+    {
+        /* first message from this task, or the entry was left by a previous task */
+        Producer->TaskId      = TaskId;
+        Producer->PeriodStart = CurrTime;
+        Producer->Count       = 0;
+        Producer->Suppressed  = 0;
+    }
+    else
+    {
+        ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, Producer->PeriodStart));
+        if (ElapsedTime < 0 || ElapsedTime >= CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT_PERIOD_MSEC)
+        {
+            Producer->PeriodStart = CurrTime;
+            Producer->Count       = 0;
+        }
+    }
+
+    if (Producer->Count >= CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT)
+    {
+        ++Producer->Suppressed;
+        return false;
+    }
+
+    ++Producer->Count;
+    *SuppressedPtr       = Producer->Suppressed;
+    Producer->Suppressed = 0;
+#endif
+
+    return true;
+}
 
 /*----------------------------------------------------------------
  *
@@ -485,10 +604,10 @@ int32 CFE_ES_SysLogDump(const char *Filename)
          * data while locked - ensuring that nothing additional can be written
          * into the syslog buffer while getting the first block of log data.
          */
-        CFE_ES_LockSharedData(__func__, __LINE__);
+        OS_MutSemTake(CFE_ES_Global.SysLogMutex);
         CFE_ES_SysLogReadStart_Unsync(&Buffer.LogData);
         CFE_ES_SysLogReadData(&Buffer.LogData);
-        CFE_ES_UnlockSharedData(__func__, __LINE__);
+        OS_MutSemGive(CFE_ES_Global.SysLogMutex);
 
         while (Buffer.LogData.BlockSize > 0)
         {
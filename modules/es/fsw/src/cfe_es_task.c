@@ -1566,9 +1566,9 @@ int32 CFE_ES_ClearSysLogCmd(const CFE_ES_ClearSysLogCmd_t *data)
     ** Clear syslog index and memory area
     */
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
+    OS_MutSemTake(CFE_ES_Global.SysLogMutex);
     CFE_ES_SysLogClear_Unsync();
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    OS_MutSemGive(CFE_ES_Global.SysLogMutex);
 
     /*
     ** This command will always succeed...
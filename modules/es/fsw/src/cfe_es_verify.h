@@ -55,6 +55,18 @@
 #error CFE_PLATFORM_ES_SYSTEM_LOG_SIZE cannot be less than 512 Bytes!
 #endif
 
+#if CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT < 0
+#error CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT cannot be negative!
+#endif
+
+#if CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT_PERIOD_MSEC < 1
+#error CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT_PERIOD_MSEC must be greater than zero!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_WORKERS < 0
+#error CFE_PLATFORM_ES_STARTUP_WORKERS cannot be negative!
+#endif
+
 #if CFE_PLATFORM_ES_DEFAULT_STACK_SIZE < 2048
 #error CFE_PLATFORM_ES_DEFAULT_STACK_SIZE cannot be less than 2048 Bytes!
 #endif
@@ -142,6 +154,15 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Per-task performance data ring size
+*/
+#if CFE_PLATFORM_ES_PERF_TASK_RING_SIZE < 0
+#error CFE_PLATFORM_ES_PERF_TASK_RING_SIZE cannot be negative!
+#elif (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)) != 0
+#error CFE_PLATFORM_ES_PERF_TASK_RING_SIZE must be zero or a power of two!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -149,6 +170,15 @@
 #error CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES cannot be less than 8!
 #endif
 
+/*
+** Size of the CDS write journal
+*/
+#if CFE_PLATFORM_ES_CDS_JOURNAL_SIZE < 16
+#error CFE_PLATFORM_ES_CDS_JOURNAL_SIZE cannot be less than 16!
+#elif (CFE_PLATFORM_ES_CDS_JOURNAL_SIZE % 4) != 0
+#error CFE_PLATFORM_ES_CDS_JOURNAL_SIZE must be a multiple of 4!
+#endif
+
 /*
 ** Maximum number of processor resets before a power-on
 */
@@ -579,6 +579,28 @@ static int32 ES_UT_SetAppStateHook(void *UserObj, int32 StubRetcode, uint32 Call
     return StubRetcode;
 }
 
+static int32 ES_UT_GetTimeHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    OS_time_t *LocalTime = UT_Hook_GetArgValueByName(Context, "LocalTime", OS_time_t *);
+    OS_time_t *UtTime    = UserObj;
+
+    *LocalTime = *UtTime;
+
+    return StubRetcode;
+}
+
+static int32 ES_UT_StartupDelayHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                    const UT_StubContext_t *Context)
+{
+    CFE_ES_StartupEntry_t *EntryPtr = UserObj;
+
+    /* Simulates another startup task finishing the entry that is being waited on */
+    EntryPtr->State = CFE_ES_StartupState_DONE;
+    ++CFE_ES_Global.StartupGraph.NumFinished;
+
+    return StubRetcode;
+}
+
 void UtTest_Setup(void)
 {
     UT_Init("es");
@@ -592,6 +614,9 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestERLog);
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+    UT_ADD_TEST(TestPerfTaskRing);
+#endif
     UT_ADD_TEST(TestAPI);
     UT_ADD_TEST(TestGenericCounterAPI);
     UT_ADD_TEST(TestCDS);
@@ -696,7 +721,7 @@ void TestStartupErrorPaths(void)
     UtAssert_STUB_COUNT(CFE_PSP_Panic, 1);
     UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
 
-    /* Perform ES main startup with a ES Perf Data mutex creation failure */
+    /* Perform ES main startup with a ES System Log mutex creation failure */
     ES_ResetUnitTest();
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERROR);
     UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
@@ -704,6 +729,14 @@ void TestStartupErrorPaths(void)
     UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
     UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
 
+    /* Perform ES main startup with a ES Perf Data mutex creation failure */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 3, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
+
     /* Perform ES main startup with a ES Shared Data mutex creation failure */
     ES_ResetUnitTest();
     UT_SetDummyFuncRtn(OS_SUCCESS);
@@ -1014,21 +1047,22 @@ void TestApps(void)
     CFE_ES_MemPoolRecord_t *UtPoolRecPtr;
     char                    NameBuffer[OS_MAX_API_NAME + 5];
     CFE_ES_AppStartParams_t StartParams;
+    CFE_ES_StartupGraph_t * Graph;
+    CFE_ES_StartupEntry_t   StartupEntry;
+    const char *            GraphTokens[] = {"CFE_APP", "/cf/apps/tst.bundle", "TST_Main", "TST_APP",
+                                             "0",       "0",                   "0x0",      "0"};
 
     UtPrintf("Begin Test Apps");
 
     /* Test starting an application where the startup script is too long */
     ES_ResetUnitTest();
-    strncpy(StartupScript,
-            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_fghfghfghfghfg"
-            "hfghfghfghfghfghfghfghfghfghfghfghfghfghfghfghfghfghfghfghfghLIB, "
-            "0, 0, 0x0, 1; CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, "
-            "70, 4096, 0x0, 1; CFE_APP, /cf/apps/sch.bundle, SCH_TaskMain, "
-            "SCH_APP, 120, 4096, 0x0, 1; CFE_APP, /cf/apps/to.bundle, "
-            "TO_task_main, TO_APP, 74, 4096, 0x0, 1; !",
-            sizeof(StartupScript) - 1);
-    StartupScript[sizeof(StartupScript) - 1] = '\0';
-    NumBytes                                 = strlen(StartupScript);
+    memset(StartupScript, 0, sizeof(StartupScript));
+    strncpy(StartupScript, "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_", sizeof(StartupScript) - 1);
+    NumBytes = strlen(StartupScript);
+    memset(&StartupScript[NumBytes], 'f', 220);
+    strncat(StartupScript, "LIB, 0, 0, 0x0, 1; CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1; !",
+            sizeof(StartupScript) - strlen(StartupScript) - 1);
+    NumBytes = strlen(StartupScript);
     UT_SetReadBuffer(StartupScript, NumBytes);
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_FILE_LINE_TOO_LONG]);
@@ -1036,7 +1070,7 @@ void TestApps(void)
 
     /* Test starting an application where the startup script has extra tokens */
     ES_ResetUnitTest();
-    strncpy(StartupScript, "A,B,C,D,E,F,G,H,I,J,K; !", sizeof(StartupScript) - 1);
+    strncpy(StartupScript, "A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P,Q; !", sizeof(StartupScript) - 1);
     StartupScript[sizeof(StartupScript) - 1] = '\0';
     NumBytes                                 = strlen(StartupScript);
     UT_SetReadBuffer(StartupScript, NumBytes);
@@ -1088,16 +1122,128 @@ void TestApps(void)
     {
         const char *TokenList[] = {"UNKNOWN", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
                                    "1"};
-        UtAssert_INT32_EQ(CFE_ES_ParseFileEntry(TokenList, 8), CFE_ES_ERR_APP_CREATE);
+        UtAssert_INT32_EQ(CFE_ES_ParseStartupEntry(TokenList, 8, &StartupEntry), CFE_ES_ERR_APP_CREATE);
 
         /* Test parsing the startup script with an invalid file name */
         UT_SetDefaultReturnValue(UT_KEY(CFE_FS_ParseInputFileName), CFE_FS_INVALID_PATH);
-        UtAssert_INT32_EQ(CFE_ES_ParseFileEntry(TokenList, 8), CFE_FS_INVALID_PATH);
+        UtAssert_INT32_EQ(CFE_ES_ParseStartupEntry(TokenList, 8, &StartupEntry), CFE_FS_INVALID_PATH);
     }
 
     /* Test parsing the startup script with an invalid argument passed in */
     ES_ResetUnitTest();
-    UtAssert_INT32_EQ(CFE_ES_ParseFileEntry(NULL, 0), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_ParseStartupEntry(NULL, 0, &StartupEntry), CFE_ES_BAD_ARGUMENT);
+
+    /* Test that dependencies listed in the startup script are recorded, where an empty list means none */
+    ES_ResetUnitTest();
+    Graph = &CFE_ES_Global.StartupGraph;
+    strncpy(StartupScript,
+            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; "
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1, TST_LIB; "
+            "CFE_APP, /cf/apps/to.bundle, TO_task_main, TO_APP, 74, 4096, 0x0, 1, ; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    NumBytes                                 = strlen(StartupScript);
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_UINT32_EQ(Graph->NumEntries, 3);
+    UtAssert_UINT32_EQ(Graph->NumFinished, 3);
+    CFE_UtAssert_FALSE(Graph->Entry[0].HasDependencyList);
+    CFE_UtAssert_TRUE(Graph->Entry[1].HasDependencyList);
+    UtAssert_UINT32_EQ(Graph->Entry[1].NumDeps, 1);
+    UtAssert_UINT32_EQ(Graph->Entry[1].DepIndex[0], 0);
+    CFE_UtAssert_TRUE(Graph->Entry[2].HasDependencyList);
+    UtAssert_ZERO(Graph->Entry[2].NumDeps);
+    UtAssert_STUB_COUNT(OS_ModuleLoad, 3);
+
+    /* Test that a dependency on an entry not earlier in the startup script is rejected */
+    ES_ResetUnitTest();
+    strncpy(StartupScript,
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1, TO_APP; "
+            "CFE_APP, /cf/apps/to.bundle, TO_task_main, TO_APP, 74, 4096, 0x0, 1; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    NumBytes                                 = strlen(StartupScript);
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_UINT32_EQ(Graph->NumEntries, 1);
+    UtAssert_STUB_COUNT(OS_ModuleLoad, 1);
+
+    /* Test that a failed listed dependency skips the entry, but an implied library dependency does not */
+    ES_ResetUnitTest();
+    strncpy(StartupScript,
+            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; "
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1, TST_LIB; "
+            "CFE_APP, /cf/apps/to.bundle, TO_task_main, TO_APP, 74, 4096, 0x0, 1; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    NumBytes                                 = strlen(StartupScript);
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_ModuleLoad), 1, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_UINT32_EQ(Graph->NumFinished, 3);
+    UtAssert_UINT32_EQ(Graph->Entry[0].State, CFE_ES_StartupState_FAILED);
+    UtAssert_UINT32_EQ(Graph->Entry[1].State, CFE_ES_StartupState_FAILED);
+    UtAssert_UINT32_EQ(Graph->Entry[2].State, CFE_ES_StartupState_DONE);
+    UtAssert_STUB_COUNT(OS_ModuleLoad, 2);
+
+    /* Test adding an entry to a full startup graph, and an entry with a name that is too long */
+    ES_ResetUnitTest();
+    Graph->NumEntries = CFE_ES_STARTSCRIPT_MAX_ENTRIES;
+    UtAssert_INT32_EQ(CFE_ES_StartupGraphAdd(GraphTokens, 8), CFE_ES_ERR_APP_CREATE);
+    Graph->NumEntries = 0;
+    GraphTokens[3]    = "TST_APP_NAME_TOO_LONG_FOR_THE_RECORD";
+    UtAssert_INT32_EQ(CFE_ES_StartupGraphAdd(GraphTokens, 8), CFE_ES_BAD_ARGUMENT);
+    UtAssert_ZERO(Graph->NumEntries);
+
+    /* Test waiting on an entry that is being started by another task */
+    ES_ResetUnitTest();
+    Graph->NumEntries         = 2;
+    Graph->Entry[0].State     = CFE_ES_StartupState_STARTING;
+    Graph->Entry[0].IsLibrary = true;
+    Graph->Entry[1].State     = CFE_ES_StartupState_PENDING;
+    Graph->Entry[1].IsLibrary = true;
+    strncpy(Graph->Entry[1].ModuleName, "UT_LIB", sizeof(Graph->Entry[1].ModuleName) - 1);
+    UtAssert_NULL(CFE_ES_StartupGraphGetNext());
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), ES_UT_StartupDelayHook, &Graph->Entry[0]);
+    CFE_ES_StartupGraphProcess();
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(Graph->NumFinished, 2);
+    UtAssert_True(Graph->Entry[1].State != CFE_ES_StartupState_PENDING, "Waiting entry was processed");
+
+    /* Test a startup worker task with nothing left to start */
+    ES_ResetUnitTest();
+    CFE_ES_StartupGraphWorkerMain();
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+#if (CFE_PLATFORM_ES_STARTUP_WORKERS > 0)
+    /* Test creating the startup worker tasks, where the entries have already been started */
+    ES_ResetUnitTest();
+    Graph->NumEntries     = 2;
+    Graph->NumFinished    = 2;
+    Graph->Entry[0].State = CFE_ES_StartupState_DONE;
+    Graph->Entry[1].State = CFE_ES_StartupState_DONE;
+    CFE_ES_StartupGraphRun();
+    UtAssert_STUB_COUNT(OS_TaskCreate, CFE_PLATFORM_ES_STARTUP_WORKERS);
+
+    /* Test that a failure to create a worker task stops creating them, but is not fatal */
+    ES_ResetUnitTest();
+    Graph->NumEntries     = 2;
+    Graph->NumFinished    = 2;
+    Graph->Entry[0].State = CFE_ES_StartupState_DONE;
+    Graph->Entry[1].State = CFE_ES_StartupState_DONE;
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+    CFE_ES_StartupGraphRun();
+    UtAssert_STUB_COUNT(OS_TaskCreate, 1);
+    UtAssert_STUB_COUNT(OS_printf, 1);
+
+    /* Test that no worker tasks are created for a single entry */
+    ES_ResetUnitTest();
+    Graph->NumEntries     = 1;
+    Graph->NumFinished    = 1;
+    Graph->Entry[0].State = CFE_ES_StartupState_DONE;
+    CFE_ES_StartupGraphRun();
+    UtAssert_STUB_COUNT(OS_TaskCreate, 0);
+#endif
 
     /* Test application loading and creation with a task creation failure */
     ES_ResetUnitTest();
@@ -1535,7 +1681,10 @@ void TestApps(void)
     {
         const char *TokenList[] = {"CFE_APP", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
                                    "0"};
-        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(TokenList, 8));
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseStartupEntry(TokenList, 8, &StartupEntry));
+        UtAssert_BOOL_FALSE(StartupEntry.IsLibrary);
+        UtAssert_INT32_EQ(StartupEntry.Params.ExceptionAction, CFE_ES_ExceptionAction_RESTART_APP);
+        CFE_UtAssert_SUCCESS(CFE_ES_LaunchStartupEntry(&StartupEntry));
     }
 
     /* Test scanning and acting on the application table where the timer
@@ -2067,6 +2216,35 @@ void TestGenericPool(void)
 
     Pool1.TailPosition = 0xFFFFFF;
     CFE_UtAssert_FALSE(CFE_ES_GenPoolValidateState(&Pool1));
+
+    /* Check the size class calculation at the class boundaries */
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(0), 0);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(1), 0);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(2), 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(3), 2);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(4), 2);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(5), 3);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(0x10000), 16);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(0x10001), 17);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(0x80000001), 32);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetSizeClass(SIZE_MAX), CFE_ES_GENPOOL_NUM_SIZE_CLASSES - 1);
+
+    /*
+     * The bucket lookup should always select the smallest bucket that fits,
+     * the same as a search through all the (sorted) buckets.
+     */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 16, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                                                  UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve,
+                                                  ES_UT_PoolDirectCommit));
+    for (BlockSize = 0; BlockSize <= 130; ++BlockSize)
+    {
+        i = 0;
+        while (i < Pool1.NumBuckets && BlockSize > Pool1.Buckets[i].BlockSize)
+        {
+            ++i;
+        }
+        UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, BlockSize), Pool1.NumBuckets - i);
+    }
 }
 
 void TestTask(void)
@@ -3142,6 +3320,9 @@ void TestPerf(void)
     memset(&CmdBuf, 0, sizeof(CmdBuf));
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopCmd), UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
 
     /* Test performance data collection stop with a file name validation issue */
     ES_ResetUnitTest();
@@ -3223,6 +3404,9 @@ void TestPerf(void)
     CFE_ES_PerfLogAdd(CFE_MISSION_ES_PERF_MAX_IDS, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.InvalidMarkerReported, true);
 
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE == 0)
+    /* The trigger handling of the per-task rings is tested in TestPerfTaskRing */
+
     /* Test addition of a new entry to the performance log with START
      * trigger mode
      */
@@ -3256,6 +3440,8 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PERF_TRIGGER_END);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
+#endif
+
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
      */
@@ -3275,6 +3461,7 @@ void TestPerf(void)
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
 
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE == 0)
     /* Test addition of a new entry to the performance log with the data count
      * below the maximum allowed
      */
@@ -3324,6 +3511,7 @@ void TestPerf(void)
     Perf->MetaData.Mode         = -1;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+#endif
 
     /* Test performance data collection start with an invalid message length */
     ES_ResetUnitTest();
@@ -3411,7 +3599,203 @@ void TestPerf(void)
     /* in WRITE_PERF_ENTRIES, it should report the StateCounter */
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
+    /* in MERGE_TASK_RINGS, it should report what the log will hold after merging, up to its size */
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_MERGE_TASK_RINGS;
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 110);
+    CFE_ES_Global.BackgroundPerfDumpState.StateCounter = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+}
+
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+void TestPerfTaskRing(void)
+{
+    CFE_ES_PerfData_t *    Perf;
+    CFE_ES_PerfTaskRing_t *Ring;
+    CFE_ES_PerfTaskRing_t *SharedRing;
+    osal_index_t           TaskIndex;
+    uint32                 i;
+
+    UtPrintf("Begin Test Performance Log Task Rings");
+
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /* Find the ring used by the calling task, in the same way as the implementation */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId(), &TaskIndex), OS_SUCCESS);
+    Ring       = &CFE_ES_Global.PerfTaskRing[TaskIndex];
+    SharedRing = &CFE_ES_Global.PerfTaskRing[OS_MAX_TASKS];
+
+    /* Test that entries go to the ring of the calling task, not directly into the perf log */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfRingGeneration = 1;
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0] = 0xFFFF;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_PerfLogAdd(0x1, 1);
+    UtAssert_UINT32_EQ(Ring->WriteCount, 2);
+    UtAssert_UINT32_EQ(Ring->Generation, 1);
+    UtAssert_UINT32_EQ(Ring->Entry[1].Data, 0x1 | (1U << CFE_MISSION_ES_PERF_EXIT_BIT));
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Test that entries left from a previous capture are discarded */
+    CFE_ES_Global.PerfRingGeneration = 2;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Ring->WriteCount, 1);
+    UtAssert_UINT32_EQ(Ring->Generation, 2);
+
+    /* Test that callers which are not OSAL tasks use the shared ring, under the mutex */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfRingGeneration = 1;
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0] = 0xFFFF;
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERR_INVALID_ID);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(SharedRing->WriteCount, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* Test that with START trigger mode, the ring stops once it is filled after the trigger */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfRingGeneration = 1;
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode           = CFE_ES_PERF_TRIGGER_START;
+    Perf->MetaData.FilterMask[0]  = 0xFFFF;
+    Perf->MetaData.TriggerMask[0] = 0x2;
+    CFE_ES_PerfLogAdd(0x2, 0);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_BOOL_TRUE(Ring->Triggered);
+    UtAssert_UINT32_EQ(Ring->TriggerStart, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE; ++i)
+    {
+        CFE_ES_PerfLogAdd(0x1, 0);
+    }
+    UtAssert_UINT32_EQ(Ring->WriteCount, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1);
+
+    /* Test that with CENTER trigger mode, the ring stops after half of it is filled after the trigger */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfRingGeneration = 1;
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode           = CFE_ES_PERF_TRIGGER_CENTER;
+    Perf->MetaData.FilterMask[0]  = 0xFFFF;
+    Perf->MetaData.TriggerMask[0] = 0x2;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_PerfLogAdd(0x2, 0);
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE; ++i)
+    {
+        CFE_ES_PerfLogAdd(0x1, 0);
+    }
+    UtAssert_UINT32_EQ(Ring->TriggerStart, 1);
+    UtAssert_UINT32_EQ(Ring->WriteCount, 1 + CFE_PLATFORM_ES_PERF_TASK_RING_SIZE / 2);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+
+    /* Test that with END trigger mode, the capture stops after the trigger entry */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfRingGeneration = 1;
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode           = CFE_ES_PERF_TRIGGER_END;
+    Perf->MetaData.FilterMask[0]  = 0xFFFF;
+    Perf->MetaData.TriggerMask[0] = 0x2;
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 2; ++i)
+    {
+        CFE_ES_PerfLogAdd(0x1, 0);
+    }
+    CFE_ES_PerfLogAdd(0x2, 0);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Ring->WriteCount, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 3);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+
+    /* Test that the state is not changed if a command changed it while getting the mutex */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    CFE_ES_PerfTaskRingSetState(CFE_ES_PERF_WAITING_FOR_TRIGGER, CFE_ES_PERF_TRIGGERED, false);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+    /* Test that the mutex is not taken again when the caller holds it */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    CFE_ES_PerfTaskRingSetState(CFE_ES_PERF_WAITING_FOR_TRIGGER, CFE_ES_PERF_TRIGGERED, true);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Test that merging does not touch the perf log if nothing was captured since boot */
+    ES_ResetUnitTest();
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    Perf->MetaData.DataCount = 10;
+    UtAssert_UINT32_EQ(CFE_ES_PerfTaskRingMergeStart(), 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 10);
+
+    /* Test merging of rings in time stamp order, including a ring which has wrapped and a stale ring */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfRingGeneration = 3;
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    Perf->MetaData.DataCount = 10;
+    Ring                     = &CFE_ES_Global.PerfTaskRing[0];
+    Ring->Generation         = 3;
+    Ring->WriteCount         = CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1;
+    Ring->Triggered          = true;
+    Ring->TriggerStart       = CFE_PLATFORM_ES_PERF_TASK_RING_SIZE;
+    for (i = 1; i <= CFE_PLATFORM_ES_PERF_TASK_RING_SIZE; ++i)
+    {
+        Ring->Entry[i & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)].Data         = 0;
+        Ring->Entry[i & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)].TimerUpper32 = 1;
+        Ring->Entry[i & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)].TimerLower32 = 2 * i;
+    }
+    Ring                        = &CFE_ES_Global.PerfTaskRing[OS_MAX_TASKS];
+    Ring->Generation            = 3;
+    Ring->WriteCount            = 2;
+    Ring->Entry[0].Data         = 1;
+    Ring->Entry[0].TimerUpper32 = 0;
+    Ring->Entry[0].TimerLower32 = 0xFFFFFFFF;
+    Ring->Entry[1].Data         = 1;
+    Ring->Entry[1].TimerUpper32 = 1;
+    Ring->Entry[1].TimerLower32 = 3;
+    Ring                        = &CFE_ES_Global.PerfTaskRing[1];
+    Ring->Generation            = 2;
+    Ring->WriteCount            = 5;
+    UtAssert_UINT32_EQ(CFE_ES_PerfTaskRingMergeStart(), CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 2);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 3; ++i)
+    {
+        CFE_ES_PerfTaskRingMergeNext();
+    }
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 2);
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[0].TimerLower32, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[1].TimerLower32, 2);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[2].TimerLower32, 3);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[2].Data, 1);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[3].TimerLower32, 4);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1].TimerLower32,
+                       2 * CFE_PLATFORM_ES_PERF_TASK_RING_SIZE);
+
+    /* Test that the dump state machine merges the rings before writing the file */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfRingGeneration = 1;
+    memset(&Perf->MetaData, 0, sizeof(Perf->MetaData));
+    CFE_ES_Global.PerfTaskRing[0].Generation = 1;
+    CFE_ES_Global.PerfTaskRing[0].WriteCount = 3;
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize,
+                       sizeof(CFE_FS_Header_t) + sizeof(CFE_ES_PerfMetaData_t) + 3 * sizeof(CFE_ES_PerfDataEntry_t));
 }
+#endif
 
 void TestAPI(void)
 {
@@ -3419,6 +3803,11 @@ void TestAPI(void)
     char                 AppName[OS_MAX_API_NAME + 12];
     uint32               StackBuf[8];
     uint8                Data[12];
+    uint8                CrcData[40];
+    uint8                OldCrcData[5];
+    uint32               CrcType;
+    uint32               Crc;
+    uint32               i;
     uint32               ResetType;
     CFE_ES_AppId_t       AppId;
     CFE_ES_TaskId_t      TaskId;
@@ -3805,28 +4194,61 @@ void TestAPI(void)
     CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
     CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = 0;
 
-    /* Test calculating a CRC on a range of memory using CRC type 8
-     * NOTE: This capability is not currently implemented in cFE
-     */
+    /* Test calculating a CRC on a range of memory using CRC type 8 */
     memset(Data, 1, sizeof(Data));
     ES_ResetUnitTest();
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_8), 0);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_8), 0xF4);
 
     /* Test calculating a CRC on a range of memory using CRC type 16 */
     ES_ResetUnitTest();
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_16), 2688);
 
+    /* The CRC type 16 result is sign extended, as it has been historically */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_16), 0xFFFFBB3D);
+
     /*
      * CRC memory read failure test case removed in #322 -
      * deprecated CFE_PSP_MemRead8, now the FSW code does a direct read
      * which has no failure path.
      */
 
-    /* Test calculating a CRC on a range of memory using CRC type 32
-     * NOTE: This capability is not currently implemented in cFE
-     */
+    /* Test calculating a CRC on a range of memory using CRC type 32 */
     ES_ResetUnitTest();
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32), 0);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32), 1314624383);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+
+    /* Test calculating a CRC in pieces, which should be the same as all at once, for each CRC type.
+     * The pieces are sized to use both the 8 byte and the single byte steps of the calculation. */
+    for (i = 0; i < sizeof(CrcData); ++i)
+    {
+        CrcData[i] = i * 37;
+    }
+    for (CrcType = CFE_MISSION_ES_CRC_8; CrcType <= CFE_MISSION_ES_CRC_32; ++CrcType)
+    {
+        UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CrcData[3], sizeof(CrcData) - 3,
+                                               CFE_ES_CalculateCRC(CrcData, 3, 0, CrcType), CrcType),
+                           CFE_ES_CalculateCRC(CrcData, sizeof(CrcData), 0, CrcType));
+    }
+
+    /* Test updating a CRC for a change in the middle of the data, which should be the same as
+     * calculating it again, for each CRC type. */
+    for (CrcType = CFE_MISSION_ES_CRC_8; CrcType <= CFE_MISSION_ES_CRC_32; ++CrcType)
+    {
+        Crc = CFE_ES_CalculateCRC(CrcData, sizeof(CrcData), 0, CrcType);
+        memcpy(OldCrcData, &CrcData[20], sizeof(OldCrcData));
+        for (i = 0; i < sizeof(OldCrcData); ++i)
+        {
+            CrcData[20 + i] ^= (CrcType << 4) + i;
+        }
+        UtAssert_UINT32_EQ(CFE_ES_UpdateCRC(Crc, OldCrcData, &CrcData[20], sizeof(OldCrcData),
+                                            sizeof(CrcData) - 20 - sizeof(OldCrcData), CrcType),
+                           CFE_ES_CalculateCRC(CrcData, sizeof(CrcData), 0, CrcType));
+    }
+    UtAssert_UINT32_EQ(CFE_ES_UpdateCRC(1234, NULL, CrcData, 1, 0, CFE_MISSION_ES_CRC_16), 1234);
+    UtAssert_UINT32_EQ(CFE_ES_UpdateCRC(1234, CrcData, NULL, 1, 0, CFE_MISSION_ES_CRC_16), 1234);
+    UtAssert_UINT32_EQ(CFE_ES_UpdateCRC(1234, CrcData, CrcData, 0, 0, CFE_MISSION_ES_CRC_16), 1234);
+    UtAssert_UINT32_EQ(CFE_ES_UpdateCRC(1234, CrcData, OldCrcData, 1, 0, -1), 0);
 
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
@@ -4175,6 +4597,14 @@ void TestCDS()
     /* Test successfully restoring from a CDS */
     CFE_UtAssert_SUCCESS(CFE_ES_RestoreFromCDS(&BlockData, CDSHandle));
 
+    /* Test successfully copying a range to a CDS */
+    BlockData[0] ^= 0xFF;
+    CFE_UtAssert_SUCCESS(CFE_ES_CopyToCDSRange(CDSHandle, &BlockData, 0, 1));
+    CFE_UtAssert_SUCCESS(CFE_ES_RestoreFromCDS(&BlockData, CDSHandle));
+
+    /* Test copying a range to a CDS with a NULL data pointer */
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandle, NULL, 0, 1), CFE_ES_BAD_ARGUMENT);
+
     /* Test CDS registering using a name longer than the maximum allowed */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
@@ -4253,6 +4683,12 @@ void TestCDS()
     memset(CdsPtr, 'x', CFE_ES_CDS_SIGNATURE_LEN);
     UtAssert_INT32_EQ(CFE_ES_ValidateCDS(), CFE_ES_CDS_INVALID);
 
+    /* Test CDS validation of a CDS with the layout of an earlier version */
+    memcpy(CdsPtr, CFE_ES_CDS_SIGNATURE_BEGIN_V1, CFE_ES_CDS_SIGNATURE_LEN);
+    UT_ResetState(UT_KEY(OS_printf));
+    UtAssert_INT32_EQ(CFE_ES_ValidateCDS(), CFE_ES_CDS_INVALID);
+    UtAssert_STUB_COUNT(OS_printf, 1);
+
     /* Test CDS initialization where first write call to the CDS fails */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_InitCDSSignatures(), CFE_ES_CDS_ACCESS_ERROR);
@@ -4377,6 +4813,10 @@ void TestCDSMempool(void)
     size_t               SavedSize;
     size_t               SavedOffset;
     uint8 *              CdsPtr;
+    uint8                RangeData[CFE_PLATFORM_ES_CDS_JOURNAL_SIZE + 16];
+    uint8                ReadData[CFE_PLATFORM_ES_CDS_JOURNAL_SIZE + 16];
+    uint32               JournalDataSize;
+    int32                i;
 
     UtPrintf("Begin Test CDS memory pool");
 
@@ -4475,6 +4915,131 @@ void TestCDSMempool(void)
     CdsPtr[UtCdsRegRecPtr->BlockOffset] ^= 0x02; /* Bit flip */
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_BLOCK_CRC_ERR);
     CdsPtr[UtCdsRegRecPtr->BlockOffset] ^= 0x02; /* Fix Bit */
+
+    /* Test CDS block range writes */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", sizeof(RangeData) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    CFE_UtAssert_SUCCESS(CFE_ES_UpdateCDSRegistry());
+    BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    for (i = 0; i < (int32)sizeof(RangeData); ++i)
+    {
+        RangeData[i] = i;
+    }
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+
+    /* Changes in the middle and at the very end of the block, the block CRC must still match */
+    memset(&RangeData[100], 0xA5, 8);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 100, 8));
+    RangeData[sizeof(RangeData) - 1] ^= 0xFF;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, sizeof(RangeData) - 1, 1));
+    memset(ReadData, 0, sizeof(ReadData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(ReadData, BlockHandle));
+    UtAssert_MemCmp(ReadData, RangeData, sizeof(RangeData), "CDS content after range writes");
+
+    /* The journal entry is cleared once applied */
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), (void **)&CdsPtr, NULL, NULL);
+    memcpy(&JournalDataSize, &CdsPtr[CDS_JOURNAL_OFFSET + offsetof(CFE_ES_CDS_JournalHeader_t, DataSize)],
+           sizeof(JournalDataSize));
+    UtAssert_ZERO(JournalDataSize);
+
+    /* An empty range changes nothing */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 0));
+
+    /* A range larger than the journal rewrites the whole block */
+    memset(RangeData, 0x5A, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, sizeof(RangeData)));
+    memset(ReadData, 0, sizeof(ReadData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(ReadData, BlockHandle));
+    UtAssert_MemCmp(ReadData, RangeData, sizeof(RangeData), "CDS content after large range write");
+
+    /* Ranges outside of the block */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, sizeof(RangeData), 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, sizeof(RangeData) + 1, 0),
+                      CFE_ES_BAD_ARGUMENT);
+
+    /* Invalid handle, block descriptor or block size */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(CFE_ES_CDS_BAD_HANDLE, RangeData, 0, 1),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    --UtCdsRegRecPtr->BlockOffset;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_POOL_BLOCK_INVALID);
+    ++UtCdsRegRecPtr->BlockOffset;
+    --UtCdsRegRecPtr->BlockSize;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_INVALID_SIZE);
+    ++UtCdsRegRecPtr->BlockSize;
+
+    /* CDS read errors (block header, old content of the range) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 8), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 8), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* CDS write errors at each step (journal data, journal header, block data, block CRC, journal clear) */
+    for (i = 1; i <= 5; ++i)
+    {
+        UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), i, OS_ERROR);
+        UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 8), CFE_ES_CDS_ACCESS_ERROR);
+    }
+
+    /* A write interrupted after the journal entry was stored is completed when the CDS is rebuilt */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    memset(RangeData, 0x11, 8);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 8), CFE_ES_CDS_ACCESS_ERROR);
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    memset(ReadData, 0, sizeof(ReadData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(ReadData, BlockHandle));
+    UtAssert_MemCmp(ReadData, RangeData, sizeof(RangeData), "CDS content after journal replay");
+
+    /* A journal entry that was not completely stored is discarded, and the block keeps its old content */
+    memset(RangeData, 0x22, 8);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 8), CFE_ES_CDS_ACCESS_ERROR);
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), (void **)&CdsPtr, NULL, NULL);
+    CdsPtr[CDS_JOURNAL_DATA_OFFSET] ^= 0xFF;
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(ReadData, BlockHandle));
+    UtAssert_INT32_EQ(ReadData[0], 0x11);
+
+    /* A full write clears an entry left pending for the block, so the older range is not replayed over it */
+    memset(RangeData, 0x33, 8);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 8), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+    memset(RangeData, 0x44, 8);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), (void **)&CdsPtr, NULL, NULL);
+    memcpy(&JournalDataSize, &CdsPtr[CDS_JOURNAL_OFFSET + offsetof(CFE_ES_CDS_JournalHeader_t, DataSize)],
+           sizeof(JournalDataSize));
+    UtAssert_ZERO(JournalDataSize);
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    memset(ReadData, 0, sizeof(ReadData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(ReadData, BlockHandle));
+    UtAssert_MemCmp(ReadData, RangeData, sizeof(RangeData), "CDS content after full write over a pending entry");
+
+    /* Journal read errors, and a malformed entry */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_ReplayCDSJournal(), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_ReplayCDSJournal(), CFE_ES_CDS_ACCESS_ERROR);
+    JournalDataSize = CFE_PLATFORM_ES_CDS_JOURNAL_SIZE + 1;
+    memcpy(&CdsPtr[CDS_JOURNAL_OFFSET + offsetof(CFE_ES_CDS_JournalHeader_t, DataSize)], &JournalDataSize,
+           sizeof(JournalDataSize));
+    CFE_UtAssert_SUCCESS(CFE_ES_ReplayCDSJournal());
+
+    /* A pending entry that cannot be applied causes the CDS to be reinitialized */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 8), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_ReplayCDSJournal(), CFE_ES_CDS_ACCESS_ERROR);
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    UtAssert_ZERO(UtCdsRegRecPtr->BlockSize);
 }
 
 void TestESMempool(void)
@@ -4825,6 +5390,13 @@ void TestSysLog(void)
 {
     CFE_ES_SysLogReadBuffer_t SysLogBuffer;
     char                      LogString[(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 2];
+#if (CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT > 0)
+    CFE_ES_SysLogProducer_t *Producer;
+    osal_index_t             TaskIndex;
+    OS_time_t                UtTime;
+    uint32                   EntryNum;
+    uint32                   i;
+#endif
 
     char TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE + 1];
 
@@ -4851,13 +5423,13 @@ void TestSysLog(void)
     ES_ResetUnitTest();
     memset(LogString, 'a', (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1);
     LogString[(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1] = '\0';
-    UtAssert_INT32_EQ(CFE_ES_SysLogAppend_Unsync(LogString), CFE_ES_ERR_SYS_LOG_TRUNCATED);
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend(LogString), CFE_ES_ERR_SYS_LOG_TRUNCATED);
 
     /* Test code that skips writing an empty string to the sys log */
     ES_ResetUnitTest();
     memset(LogString, 'a', (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1);
     LogString[0] = '\0';
-    CFE_UtAssert_SUCCESS(CFE_ES_SysLogAppend_Unsync(LogString));
+    CFE_UtAssert_SUCCESS(CFE_ES_SysLogAppend(LogString));
 
     /* Test Reading space between the current read offset and end of the log buffer */
     ES_ResetUnitTest();
@@ -4899,6 +5471,74 @@ void TestSysLog(void)
     TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE] = '\0';
 
     CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("%s", TmpString));
+
+    /* Test that the space for a message is reserved under the syslog mutex */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    CFE_UtAssert_SUCCESS(CFE_ES_SysLogAppend("SysLogText\n"));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    CFE_UtAssert_MEMOFFSET_EQ(CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx, 11);
+    UtAssert_MemCmp(CFE_ES_Global.ResetDataPtr->SystemLog, "SysLogText\n", 11, "SysLog content");
+
+#if (CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT > 0)
+    /* Test that messages written during startup are never rate limited */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    for (i = 0; i <= CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("SysLogText\n"));
+    }
+
+    /* Test that each task is limited once operational, and suppressed messages are not formatted */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    UtTime                    = OS_TimeAssembleFromMilliseconds(100, 0);
+    UT_SetHookFunction(UT_KEY(CFE_PSP_GetTime), ES_UT_GetTimeHook, &UtTime);
+    UtAssert_INT32_EQ(OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId(), &TaskIndex), OS_SUCCESS);
+    Producer = &CFE_ES_Global.SysLogProducer[TaskIndex];
+    for (i = 0; i < CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("SysLogText\n"));
+    }
+
+    EntryNum = CFE_ES_Global.ResetDataPtr->SystemLogEntryNum;
+    UtAssert_INT32_EQ(CFE_ES_WriteToSysLog("SysLogText\n"), CFE_ES_ERR_SYS_LOG_SUPPRESSED);
+    UtAssert_INT32_EQ(CFE_ES_WriteToSysLog("SysLogText\n"), CFE_ES_ERR_SYS_LOG_SUPPRESSED);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, EntryNum);
+    UtAssert_UINT32_EQ(Producer->Suppressed, 2);
+    UtAssert_STUB_COUNT(CFE_TIME_Print, CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT);
+
+    /* Test that the suppressed messages are reported by the first message of the next period */
+    UtTime = OS_TimeAssembleFromMilliseconds(100 + (CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT_PERIOD_MSEC / 1000),
+                                             CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT_PERIOD_MSEC % 1000);
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("SysLogText\n"));
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, EntryNum + 2);
+    UtAssert_ZERO(Producer->Suppressed);
+    UtAssert_UINT32_EQ(Producer->Count, 1);
+
+    /* Test that a new period is started if the time goes backwards */
+    Producer->Count = CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT;
+    UtTime          = OS_TimeAssembleFromMilliseconds(50, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("SysLogText\n"));
+    UtAssert_UINT32_EQ(Producer->Count, 1);
+
+    /* Test that an entry left by a previous task is reset */
+    Producer->TaskId     = OS_OBJECT_ID_UNDEFINED;
+    Producer->Count      = CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT;
+    Producer->Suppressed = 5;
+    EntryNum             = CFE_ES_Global.ResetDataPtr->SystemLogEntryNum;
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("SysLogText\n"));
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, EntryNum + 1);
+    UtAssert_UINT32_EQ(Producer->Count, 1);
+
+    /* Test that callers which are not OSAL tasks are not limited */
+    Producer->Count = CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT;
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERR_INVALID_ID);
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("SysLogText\n"));
+    UtAssert_UINT32_EQ(Producer->Count, CFE_PLATFORM_ES_SYSLOG_RATE_LIMIT);
+#endif
 }
 
 void TestBackground(void)
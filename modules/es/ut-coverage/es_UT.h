@@ -180,6 +180,25 @@ void TestBackground(void);
 ******************************************************************************/
 void TestPerf(void);
 
+#if (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > 0)
+/*****************************************************************************/
+/**
+** \brief Performs tests on the per-task performance data rings contained in
+**        cfe_es_perf.c
+**
+** \par Description
+**        This function tests recording into the per-task rings and merging
+**        them into the performance log.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only built when CFE_PLATFORM_ES_PERF_TASK_RING_SIZE is nonzero
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestPerfTaskRing(void);
+#endif
+
 /*****************************************************************************/
 /**
 ** \brief Perform tests on the ES API functions contained in cfe_es_api.c
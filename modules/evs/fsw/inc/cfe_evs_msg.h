@@ -230,6 +230,10 @@
 **  definitions.  The short event format is used to accommodate experiences
 **  with limited telemetry bandwidth.  The long event format includes all event
 **  information included within the short format along with the Event Data.
+**  The binary event format sends the Event Data unexpanded, as an identifier of
+**  the format string and the raw arguments, to be expanded by the ground system.
+**  It also skips the application name.  Events which cannot be packed are sent
+**  in the long format.  The local event log always stores the long format.
 **
 **  \cfecmdmnemonic \EVS_SETEVTFMT
 **
@@ -1188,7 +1192,7 @@ typedef struct CFE_EVS_HousekeepingTlm_Payload
     uint8 CommandErrorCounter; /**< \cfetlmmnemonic \EVS_CMDEC
                                   \brief EVS Command Error Counter */
     uint8 MessageFormatMode;   /**< \cfetlmmnemonic \EVS_MSGFMTMODE
-                                    \brief Event message format mode (short/long) */
+                                    \brief Event message format mode (short/long/binary) */
     uint8 MessageTruncCounter; /**< \cfetlmmnemonic \EVS_MSGTRUNC
                                     \brief Event message truncation counter */
 
@@ -1266,6 +1270,34 @@ typedef struct CFE_EVS_ShortEventTlm_Payload
 
 } CFE_EVS_ShortEventTlm_Payload_t;
 
+/**
+**  \cfeevstlm Event Message Telemetry Packet (Binary format)
+**
+**  The message is variable length, it ends after the last byte of ArgData that is used.
+**
+**  FormatID is the 32 bit FNV-1a hash of the bytes of the format string, not including
+**  the terminating null.  Starting from 0x811C9DC5, each byte is XORed into the hash,
+**  which is then multiplied by 0x01000193.  The ground system can build the table of
+**  format strings from the CFE_EVS_SendEvent() calls in the flight software.
+**
+**  ArgData holds the arguments in the order they are used by the format string, in the
+**  byte order of the processor, with no padding:
+**  - Integer conversions and \c \%c: 4 bytes, or 8 bytes with the l, ll, j, z or t modifiers
+**  - Floating point conversions: 8 bytes (a double)
+**  - \c \%p: 8 bytes
+**  - \c \%s: the characters used by the conversion, followed by a null
+**  - A \c * width or precision: 4 bytes, before the argument it applies to
+**/
+typedef struct CFE_EVS_BinaryEventTlm_Payload
+{
+    uint32         FormatID;                                    /**< \brief Identifier of the format string */
+    CFE_ES_AppId_t AppID;                                       /**< \brief Application that sent the event */
+    uint16         EventID;                                     /**< \brief Numerical event identifier */
+    uint16         EventType;                                   /**< \brief Numerical event type identifier */
+    uint8          ArgData[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH]; /**< \brief Packed format arguments */
+
+} CFE_EVS_BinaryEventTlm_Payload_t;
+
 typedef struct CFE_EVS_LongEventTlm
 {
     CFE_MSG_TelemetryHeader_t      TlmHeader; /**< \brief Telemetry header */
@@ -1280,4 +1312,11 @@ typedef struct CFE_EVS_ShortEventTlm
 
 } CFE_EVS_ShortEventTlm_t;
 
+typedef struct CFE_EVS_BinaryEventTlm
+{
+    CFE_MSG_TelemetryHeader_t        TlmHeader; /**< \brief Telemetry header */
+    CFE_EVS_BinaryEventTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+
+} CFE_EVS_BinaryEventTlm_t;
+
 #endif /* CFE_EVS_MSG_H */
@@ -106,6 +106,8 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
                 AppDataPtr->BinFilters[i].Count   = 0;
             }
 
+            EVS_UpdateFilterIndex(AppDataPtr);
+
             EVS_AppDataSetUsed(AppDataPtr, AppID);
         }
     }
@@ -268,7 +270,7 @@ int32 CFE_EVS_ResetFilter(uint16 EventID)
         }
         else
         {
-            FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+            FilterPtr = EVS_FindEventID(EventID, AppDataPtr);
 
             if (FilterPtr != NULL)
             {
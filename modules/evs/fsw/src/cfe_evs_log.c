@@ -90,6 +90,33 @@ void EVS_AddLog(CFE_EVS_LongEventTlm_t *EVS_PktPtr)
     return;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_CountLogDiscard
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_CountLogDiscard(void)
+{
+    bool IsDiscarded;
+
+    /* Serialize access to event log control variables */
+    OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+
+    IsDiscarded = ((CFE_EVS_Global.EVS_LogPtr->LogFullFlag == true) &&
+                   (CFE_EVS_Global.EVS_LogPtr->LogMode == CFE_EVS_LogMode_DISCARD));
+    if (IsDiscarded)
+    {
+        CFE_EVS_Global.EVS_LogPtr->LogOverflowCounter++;
+    }
+
+    OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+
+    return IsDiscarded;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: EVS_ClearLog
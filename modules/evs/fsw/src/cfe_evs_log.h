@@ -58,6 +58,17 @@
  */
 void EVS_AddLog(CFE_EVS_LongEventTlm_t *EVS_PktPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief This routine counts an event which the internal event log does not have room for.
+ *
+ * When the log is full and in discard mode, the event is counted as an overflow, the same
+ * as EVS_AddLog() would, so callers can skip building the log entry.
+ *
+ * @returns true if the event was counted, false if it should be added with EVS_AddLog()
+ */
+bool EVS_CountLogDiscard(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief This routine clears the contents of the internal event log.
@@ -305,6 +305,34 @@ int32 CFE_EVS_TaskInit(void)
         return Status;
     }
 
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+    /* Create the task which sends events queued by other tasks */
+    Status = OS_MutSemCreate(&CFE_EVS_Global.AsyncMutexID, CFE_EVS_ASYNC_MUTEX_NAME, 0);
+    if (Status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error creating async mutex:RC=%ld\n", __func__, (long)Status);
+        return Status;
+    }
+
+    Status = OS_BinSemCreate(&CFE_EVS_Global.AsyncSemID, CFE_EVS_ASYNC_SEM_NAME, 0, 0);
+    if (Status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error creating async semaphore:RC=%ld\n", __func__, (long)Status);
+        return Status;
+    }
+
+    Status = CFE_ES_CreateChildTask(&CFE_EVS_Global.AsyncTaskID, CFE_EVS_ASYNC_TASK_NAME, CFE_EVS_AsyncTask,
+                                    CFE_ES_TASK_STACK_ALLOCATE, CFE_PLATFORM_EVS_ASYNC_TASK_STACK_SIZE,
+                                    CFE_PLATFORM_EVS_ASYNC_TASK_PRIORITY, 0);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error creating async task:RC=0x%08X\n", __func__, (unsigned int)Status);
+        return Status;
+    }
+
+    CFE_EVS_Global.AsyncEnabled = true;
+#endif
+
     /* Write the AppID to the global location, now that the rest of initialization is done */
     CFE_EVS_Global.EVS_AppID = AppID;
     EVS_SendEvent(CFE_EVS_STARTUP_EID, CFE_EVS_EventType_INFORMATION, "cFE EVS Initialized: %s", CFE_VERSION_STRING);
@@ -312,6 +340,41 @@ int32 CFE_EVS_TaskInit(void)
     return CFE_SUCCESS;
 }
 
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_EVS_AsyncTask
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_EVS_AsyncTask(void)
+{
+    int32 Status;
+
+    while (true)
+    {
+        /* Increment the task execution counter */
+        CFE_ES_IncrementTaskCounter();
+
+        /* Pend on the semaphore given when events are queued */
+        Status = OS_BinSemTake(CFE_EVS_Global.AsyncSemID);
+        if (Status != OS_SUCCESS)
+        {
+            break;
+        }
+
+        /* Events queued after the semaphore was given are picked up in the same pass, or the next */
+        EVS_AsyncProcessRings();
+    }
+
+    /* Stop queueing events, as there is no longer anything to send them */
+    CFE_EVS_Global.AsyncEnabled = false;
+    CFE_ES_WriteToSysLog("%s: Error taking async semaphore,RC=%ld\n", __func__, (long)Status);
+}
+#endif
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_EVS_ProcessCommandPacket
@@ -726,7 +789,7 @@ int32 CFE_EVS_SetFilterCmd(const CFE_EVS_SetFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         if (FilterPtr != NULL)
         {
@@ -974,7 +1037,8 @@ int32 CFE_EVS_SetEventFormatModeCmd(const CFE_EVS_SetEventFormatModeCmd_t *data)
     const CFE_EVS_SetEventFormatMode_Payload_t *CmdPtr = &data->Payload;
     int32                                       Status;
 
-    if ((CmdPtr->MsgFormat == CFE_EVS_MsgFormat_SHORT) || (CmdPtr->MsgFormat == CFE_EVS_MsgFormat_LONG))
+    if ((CmdPtr->MsgFormat == CFE_EVS_MsgFormat_SHORT) || (CmdPtr->MsgFormat == CFE_EVS_MsgFormat_LONG) ||
+        (CmdPtr->MsgFormat == CFE_EVS_MsgFormat_BINARY))
     {
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CmdPtr->MsgFormat;
 
@@ -1294,7 +1358,7 @@ int32 CFE_EVS_ResetFilterCmd(const CFE_EVS_ResetFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         if (FilterPtr != NULL)
         {
@@ -1412,7 +1476,7 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
     if (Status == CFE_SUCCESS)
     {
         /* Check to see if this event is already registered for filtering */
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         /* FilterPtr != NULL means that this Event ID was found as already being registered */
         if (FilterPtr != NULL)
@@ -1426,7 +1490,7 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
         else
         {
             /* now check to see if there is a free slot */
-            FilterPtr = EVS_FindEventID(CFE_EVS_FREE_SLOT, AppDataPtr->BinFilters);
+            FilterPtr = EVS_FindFreeFilter(AppDataPtr);
 
             if (FilterPtr != NULL)
             {
@@ -1435,6 +1499,8 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
                 FilterPtr->Mask    = CmdPtr->Mask;
                 FilterPtr->Count   = 0;
 
+                EVS_UpdateFilterIndex(AppDataPtr);
+
                 EVS_SendEvent(CFE_EVS_ADDFILTER_EID, CFE_EVS_EventType_DEBUG,
                               "Add Filter Command Received with AppName = %s, EventID = 0x%08x, Mask = 0x%04x",
                               LocalName, (unsigned int)CmdPtr->EventID, (unsigned int)CmdPtr->Mask);
@@ -1495,7 +1561,7 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         if (FilterPtr != NULL)
         {
@@ -1504,6 +1570,8 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
             FilterPtr->Mask    = CFE_EVS_NO_MASK;
             FilterPtr->Count   = 0;
 
+            EVS_UpdateFilterIndex(AppDataPtr);
+
             EVS_SendEvent(CFE_EVS_DELFILTER_EID, CFE_EVS_EventType_DEBUG,
                           "Delete Filter Command Received with AppName = %s, EventID = 0x%08x", LocalName,
                           (unsigned int)CmdPtr->EventID);
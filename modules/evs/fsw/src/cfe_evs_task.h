@@ -49,6 +49,7 @@
 #include "cfe_evs_api_typedefs.h"
 #include "cfe_evs_log_typedef.h"
 #include "cfe_sb_api_typedefs.h"
+#include "cfe_time_api_typedefs.h"
 #include "cfe_evs_events.h"
 
 /*********************  Macro and Constant Type Definitions   ***************************/
@@ -61,6 +62,14 @@
 #define CFE_EVS_MAX_FILTER_COUNT     65535
 #define CFE_EVS_PIPE_NAME            "EVS_CMD_PIPE"
 #define CFE_EVS_MAX_PORT_MSG_LENGTH  (CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + OS_MAX_API_NAME + 30)
+#define CFE_EVS_ASYNC_TASK_NAME      "CFE_EVS_ASYNC"
+#define CFE_EVS_ASYNC_SEM_NAME       "CFE_EVS_AsyncSem"
+#define CFE_EVS_ASYNC_MUTEX_NAME     "CFE_EVS_AsyncMutex"
+#define CFE_EVS_FORMAT_ID_BASIS      0x811C9DC5 /* FNV-1a offset basis, see CFE_EVS_BinaryEventTlm_Payload_t */
+#define CFE_EVS_FORMAT_ID_PRIME      0x01000193 /* FNV-1a prime */
+
+/* Size of the filter index of each app, which is kept at most half full */
+#define CFE_EVS_FILTER_INDEX_SIZE ((2 * CFE_PLATFORM_EVS_MAX_EVENT_FILTERS) + 1)
 
 /* Since CFE_EVS_MAX_PORT_MSG_LENGTH is the size of the buffer that is sent to
  * print out (using OS_printf), we need to check to make sure that the buffer
@@ -88,6 +97,12 @@ typedef struct
 
     EVS_BinFilter_t BinFilters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Array of binary filters */
 
+    /*
+     * Hash of the EventID of each filter in use to its BinFilters index + 1, or 0 if the
+     * entry is empty.  Collisions use the next entry.  See EVS_UpdateFilterIndex().
+     */
+    uint16 FilterIndex[CFE_EVS_FILTER_INDEX_SIZE];
+
     uint8  ActiveFlag;           /* Application event service active flag */
     uint8  EventTypesActiveFlag; /* Application event types active flag */
     uint16 EventCount;           /* Application event counter */
@@ -104,6 +119,41 @@ typedef struct
 
 } CFE_EVS_AppDataFile_t;
 
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+/*
+ * An event queued by the sending task, to be sent by the EVS async task
+ */
+typedef struct
+{
+    CFE_ES_AppId_t     AppID;                                       /* Application which sent the event */
+    CFE_TIME_SysTime_t Time;                                        /* Event time stamp */
+    uint16             EventID;                                     /* Numerical event identifier */
+    uint16             EventType;                                   /* Event type */
+    char               Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH]; /* Formatted event text */
+
+} EVS_AsyncEvent_t;
+
+/*
+ * Ring of queued events for one task
+ *
+ * WriteCount is only updated by the task that owns the ring, and ReadCount
+ * only by the EVS async task.  The entries themselves are written and read
+ * without a lock, so the counts are only read or updated while holding the
+ * async mutex, which orders the accesses to the entries on SMP systems:
+ *  - the writer fills in an entry before taking the mutex to update WriteCount
+ *  - the reader takes the mutex to get WriteCount before reading the entries
+ *  - the reader is finished with an entry before taking the mutex to update ReadCount
+ *  - the writer takes the mutex to get ReadCount before reusing an entry
+ */
+typedef struct
+{
+    uint32           WriteCount;
+    uint32           ReadCount;
+    EVS_AsyncEvent_t Event[CFE_PLATFORM_EVS_ASYNC_RING_SIZE];
+
+} EVS_AsyncRing_t;
+#endif
+
 /* Global data structure */
 typedef struct
 {
@@ -120,6 +170,17 @@ typedef struct
     osal_id_t                 EVS_SharedDataMutexID;
     CFE_ES_AppId_t            EVS_AppID;
 
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+    /*
+    ** Asynchronous event data, one ring per OSAL task
+    */
+    osal_id_t       AsyncSemID;
+    osal_id_t       AsyncMutexID; /* Guards the counts of all the rings, see EVS_AsyncRing_t */
+    CFE_ES_TaskId_t AsyncTaskID;
+    bool            AsyncEnabled;
+    EVS_AsyncRing_t AsyncRing[OS_MAX_TASKS];
+#endif
+
 } CFE_EVS_Global_t;
 
 /*
@@ -149,6 +210,15 @@ extern int32 CFE_EVS_TaskInit(void);
  */
 extern void CFE_EVS_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Asynchronous event task
+ *
+ * Entry point of the EVS child task which sends the events queued by other
+ * tasks.  Only used when CFE_PLATFORM_EVS_ASYNC_RING_SIZE is nonzero.
+ */
+extern void CFE_EVS_AsyncTask(void);
+
 /*
  * EVS Message Handler Functions
  */
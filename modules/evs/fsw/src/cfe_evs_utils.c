@@ -33,9 +33,11 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
 
 /* Local Function Prototypes */
 void EVS_SendViaPorts(CFE_EVS_LongEventTlm_t *EVS_PktPtr);
+bool EVS_PackEventArgData(uint8 *Buffer, size_t BufferSize, size_t *PackedSize, const void *Data, size_t DataSize);
 void EVS_OutputPort1(char *Message);
 void EVS_OutputPort2(char *Message);
 void EVS_OutputPort3(char *Message);
@@ -258,7 +260,7 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
     /* Is this type of event enabled for this application? */
     if (Filtered == false)
     {
-        FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(EventID, AppDataPtr);
 
         /* Does this event ID have an event filter table entry? */
         if (FilterPtr != NULL)
@@ -298,21 +300,93 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray)
+EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_AppData_t *AppDataPtr)
+{
+    uint32 Pos;
+    uint16 Slot;
+
+    /* The index is at most half full, so an event without a filter usually stops at the first entry */
+    Pos  = EventID % CFE_EVS_FILTER_INDEX_SIZE;
+    Slot = AppDataPtr->FilterIndex[Pos];
+
+    while (Slot != 0)
+    {
+        if (AppDataPtr->BinFilters[Slot - 1].EventID == EventID)
+        {
+            return (&AppDataPtr->BinFilters[Slot - 1]);
+        }
+
+        ++Pos;
+        if (Pos >= CFE_EVS_FILTER_INDEX_SIZE)
+        {
+            Pos = 0;
+        }
+
+        Slot = AppDataPtr->FilterIndex[Pos];
+    }
+
+    return ((EVS_BinFilter_t *)NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_FindFreeFilter
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+EVS_BinFilter_t *EVS_FindFreeFilter(EVS_AppData_t *AppDataPtr)
 {
     uint32 i;
 
     for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
     {
-        if (FilterArray[i].EventID == EventID)
+        if (AppDataPtr->BinFilters[i].EventID == (uint16)CFE_EVS_FREE_SLOT)
         {
-            return (&FilterArray[i]);
+            return (&AppDataPtr->BinFilters[i]);
         }
     }
 
     return ((EVS_BinFilter_t *)NULL);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_UpdateFilterIndex
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_UpdateFilterIndex(EVS_AppData_t *AppDataPtr)
+{
+    uint32 i;
+    uint32 Pos;
+
+    memset(AppDataPtr->FilterIndex, 0, sizeof(AppDataPtr->FilterIndex));
+
+    /* Records are added in order, so the first of any duplicate EventIDs is found first */
+    for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
+    {
+        if (AppDataPtr->BinFilters[i].EventID != (uint16)CFE_EVS_FREE_SLOT)
+        {
+            Pos = AppDataPtr->BinFilters[i].EventID % CFE_EVS_FILTER_INDEX_SIZE;
+
+            while (AppDataPtr->FilterIndex[Pos] != 0)
+            {
+                ++Pos;
+                if (Pos >= CFE_EVS_FILTER_INDEX_SIZE)
+                {
+                    Pos = 0;
+                }
+            }
+
+            AppDataPtr->FilterIndex[Pos] = i + 1;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: EVS_EnableTypes
@@ -356,50 +430,95 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask)
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
 {
-    CFE_EVS_LongEventTlm_t  LongEventTlm;  /* The "long" flavor is always generated, as this is what is logged */
-    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
-    int                     ExpandedLength;
+    CFE_EVS_LongEventTlm_t LongEventTlm; /* The "long" flavor is always generated, as this is what is logged */
+
+    /* Binary events are cheap enough to send directly, if the arguments can be packed */
+    if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_BINARY &&
+        EVS_SendBinaryEvent(AppDataPtr, EventID, EventType, TimeStamp, MsgSpec, ArgPtr))
+    {
+        return;
+    }
+
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+    /* Let the EVS async task do the rest, if it can take the event */
+    if (EVS_AsyncQueueEvent(AppDataPtr, EventID, EventType, TimeStamp, MsgSpec, ArgPtr))
+    {
+        return;
+    }
+#endif
 
     /* Initialize EVS event packets */
     CFE_MSG_Init(&LongEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID), sizeof(LongEventTlm));
     LongEventTlm.Payload.PacketID.EventID   = EventID;
     LongEventTlm.Payload.PacketID.EventType = EventType;
 
+    EVS_FormatMessage((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec, ArgPtr);
+
+    EVS_SendEventTelemetry(EVS_AppDataGetID(AppDataPtr), AppDataPtr, &LongEventTlm, TimeStamp);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_FormatMessage
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_FormatMessage(char *Buffer, size_t BufferSize, const char *MsgSpec, va_list ArgPtr)
+{
+    int ExpandedLength;
+
     /* vsnprintf() returns the total expanded length of the formatted string */
     /* vsnprintf() copies and zero terminates portion that fits in the buffer */
-    ExpandedLength =
-        vsnprintf((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec, ArgPtr);
+    ExpandedLength = vsnprintf(Buffer, BufferSize, MsgSpec, ArgPtr);
 
     /*
      * If vsnprintf is bigger than message size, mark with truncation character
      * Note negative returns (error from vsnprintf) will just leave the message as-is
      */
-    if (ExpandedLength >= (int)sizeof(LongEventTlm.Payload.Message))
+    if (ExpandedLength >= (int)BufferSize)
     {
         /* Mark character before zero terminator to indicate truncation */
-        LongEventTlm.Payload.Message[sizeof(LongEventTlm.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
+        Buffer[BufferSize - 2] = CFE_EVS_MSG_TRUNCATED;
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter++;
     }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_SendEventTelemetry
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_SendEventTelemetry(CFE_ES_AppId_t AppID, EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlm,
+                            const CFE_TIME_SysTime_t *TimeStamp)
+{
+    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
 
     /* Obtain task and system information */
-    CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
-                      sizeof(LongEventTlm.Payload.PacketID.AppName));
-    LongEventTlm.Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
-    LongEventTlm.Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
+    CFE_ES_GetAppName((char *)LongEventTlm->Payload.PacketID.AppName, AppID,
+                      sizeof(LongEventTlm->Payload.PacketID.AppName));
+    LongEventTlm->Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
+    LongEventTlm->Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
 
     /* Set the packet timestamp */
-    CFE_MSG_SetMsgTime(&LongEventTlm.TlmHeader.Msg, *TimeStamp);
+    CFE_MSG_SetMsgTime(&LongEventTlm->TlmHeader.Msg, *TimeStamp);
 
     /* Write event to the event log */
-    EVS_AddLog(&LongEventTlm);
+    EVS_AddLog(LongEventTlm);
 
     /* Send event via selected ports */
-    EVS_SendViaPorts(&LongEventTlm);
+    EVS_SendViaPorts(LongEventTlm);
 
-    if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_LONG)
+    /* Events which could not be sent in the binary format are sent in the long format */
+    if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_LONG ||
+        CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_BINARY)
     {
         /* Send long event via SoftwareBus */
-        CFE_SB_TransmitMsg(&LongEventTlm.TlmHeader.Msg, true);
+        CFE_SB_TransmitMsg(&LongEventTlm->TlmHeader.Msg, true);
     }
     else if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_SHORT)
     {
@@ -412,22 +531,516 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
         CFE_MSG_Init(&ShortEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID),
                      sizeof(ShortEventTlm));
         CFE_MSG_SetMsgTime(&ShortEventTlm.TlmHeader.Msg, *TimeStamp);
-        ShortEventTlm.Payload.PacketID = LongEventTlm.Payload.PacketID;
+        ShortEventTlm.Payload.PacketID = LongEventTlm->Payload.PacketID;
         CFE_SB_TransmitMsg(&ShortEventTlm.TlmHeader.Msg, true);
     }
 
+    EVS_IncrementSendCounters(AppDataPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_IncrementSendCounters
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_IncrementSendCounters(EVS_AppData_t *AppDataPtr)
+{
     /* Increment message send counters (prevent rollover) */
     if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter < CFE_EVS_MAX_EVENT_SEND_COUNT)
     {
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter++;
     }
 
-    if (AppDataPtr->EventCount < CFE_EVS_MAX_EVENT_SEND_COUNT)
+    if (AppDataPtr != NULL && AppDataPtr->EventCount < CFE_EVS_MAX_EVENT_SEND_COUNT)
     {
         AppDataPtr->EventCount++;
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_GetFormatID
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 EVS_GetFormatID(const char *MsgSpec)
+{
+    uint32 FormatID = CFE_EVS_FORMAT_ID_BASIS;
+
+    while (*MsgSpec != 0)
+    {
+        FormatID ^= (uint8)*MsgSpec;
+        FormatID *= CFE_EVS_FORMAT_ID_PRIME;
+        ++MsgSpec;
+    }
+
+    return FormatID;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_PackEventArgData
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Appends DataSize bytes to the packed arguments, if they fit
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_PackEventArgData(uint8 *Buffer, size_t BufferSize, size_t *PackedSize, const void *Data, size_t DataSize)
+{
+    if (DataSize > (BufferSize - *PackedSize))
+    {
+        return false;
+    }
+
+    memcpy(&Buffer[*PackedSize], Data, DataSize);
+    *PackedSize += DataSize;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_PackEventArgs
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_PackEventArgs(uint8 *Buffer, size_t BufferSize, size_t *PackedSize, const char *MsgSpec, va_list ArgPtr)
+{
+    const char *StrArg;
+    size_t      StrLength;
+    int32       IntArg;
+    uint64      WideArg;
+    double      DoubleArg;
+    int32       Precision;
+    char        LengthMod;
+    bool        IsPacked;
+
+    *PackedSize = 0;
+    IsPacked    = true;
+
+    while (IsPacked && *MsgSpec != 0)
+    {
+        /* Only conversions use arguments */
+        if (*MsgSpec++ != '%')
+        {
+            continue;
+        }
+
+        /* Skip the flags */
+        while (*MsgSpec != 0 && strchr("-+ #0", *MsgSpec) != NULL)
+        {
+            ++MsgSpec;
+        }
+
+        /* Width */
+        if (*MsgSpec == '*')
+        {
+            IntArg   = va_arg(ArgPtr, int);
+            IsPacked = EVS_PackEventArgData(Buffer, BufferSize, PackedSize, &IntArg, sizeof(IntArg));
+            ++MsgSpec;
+        }
+        while (*MsgSpec >= '0' && *MsgSpec <= '9')
+        {
+            ++MsgSpec;
+        }
+
+        /* Precision, which limits the characters used from a string argument */
+        Precision = -1;
+        if (*MsgSpec == '.')
+        {
+            ++MsgSpec;
+            Precision = 0;
+            if (*MsgSpec == '*')
+            {
+                IntArg    = va_arg(ArgPtr, int);
+                Precision = IntArg;
+                IsPacked  = IsPacked && EVS_PackEventArgData(Buffer, BufferSize, PackedSize, &IntArg, sizeof(IntArg));
+                ++MsgSpec;
+            }
+            while (*MsgSpec >= '0' && *MsgSpec <= '9')
+            {
+                Precision = (Precision * 10) + (*MsgSpec - '0');
+                ++MsgSpec;
+            }
+        }
+
+        /* Length modifier, where 'H' stands for "hh" and 'q' for "ll" */
+        LengthMod = 0;
+        if (*MsgSpec != 0 && strchr("hljztL", *MsgSpec) != NULL)
+        {
+            LengthMod = *MsgSpec++;
+            if (LengthMod == 'h' && *MsgSpec == 'h')
+            {
+                LengthMod = 'H';
+                ++MsgSpec;
+            }
+            else if (LengthMod == 'l' && *MsgSpec == 'l')
+            {
+                LengthMod = 'q';
+                ++MsgSpec;
+            }
+        }
+
+        switch (*MsgSpec)
+        {
+            case '%':
+                /* A literal percent sign */
+                break;
+
+            case 'd':
+            case 'i':
+                switch (LengthMod)
+                {
+                    case 'l':
+                        WideArg = (uint64)(int64)va_arg(ArgPtr, long);
+                        break;
+                    case 'q':
+                        WideArg = (uint64)(int64)va_arg(ArgPtr, long long);
+                        break;
+                    case 'j':
+                        WideArg = (uint64)(int64)va_arg(ArgPtr, intmax_t);
+                        break;
+                    case 'z':
+                        WideArg = (uint64)va_arg(ArgPtr, size_t);
+                        break;
+                    case 't':
+                        WideArg = (uint64)(int64)va_arg(ArgPtr, ptrdiff_t);
+                        break;
+                    default:
+                        WideArg = (uint64)(int64)va_arg(ArgPtr, int);
+                        break;
+                }
+                break;
+
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+                switch (LengthMod)
+                {
+                    case 'l':
+                        WideArg = va_arg(ArgPtr, unsigned long);
+                        break;
+                    case 'q':
+                        WideArg = va_arg(ArgPtr, unsigned long long);
+                        break;
+                    case 'j':
+                        WideArg = va_arg(ArgPtr, uintmax_t);
+                        break;
+                    case 'z':
+                        WideArg = va_arg(ArgPtr, size_t);
+                        break;
+                    case 't':
+                        WideArg = (uint64)va_arg(ArgPtr, ptrdiff_t);
+                        break;
+                    default:
+                        WideArg = va_arg(ArgPtr, unsigned int);
+                        break;
+                }
+                break;
+
+            case 'c':
+                WideArg = (uint64)(int64)va_arg(ArgPtr, int);
+                break;
+
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                if (LengthMod == 'L')
+                {
+                    DoubleArg = (double)va_arg(ArgPtr, long double);
+                }
+                else
+                {
+                    DoubleArg = va_arg(ArgPtr, double);
+                }
+                IsPacked = IsPacked &&
+                           EVS_PackEventArgData(Buffer, BufferSize, PackedSize, &DoubleArg, sizeof(DoubleArg));
+                break;
+
+            case 'p':
+                WideArg  = (cpuaddr)va_arg(ArgPtr, void *);
+                IsPacked = IsPacked && EVS_PackEventArgData(Buffer, BufferSize, PackedSize, &WideArg, sizeof(WideArg));
+                break;
+
+            case 's':
+                StrArg = va_arg(ArgPtr, const char *);
+                if (StrArg == NULL || LengthMod != 0)
+                {
+                    /* leave these to vsnprintf() */
+                    IsPacked = false;
+                    break;
+                }
+
+                StrLength = 0;
+                while ((Precision < 0 || StrLength < (size_t)Precision) && StrArg[StrLength] != 0)
+                {
+                    ++StrLength;
+                }
+
+                IsPacked = IsPacked && EVS_PackEventArgData(Buffer, BufferSize, PackedSize, StrArg, StrLength) &&
+                           EVS_PackEventArgData(Buffer, BufferSize, PackedSize, "", 1);
+                break;
+
+            default:
+                /* %n, wide characters, or not a valid conversion */
+                IsPacked = false;
+                break;
+        }
+
+        /* Integers are packed as 4 bytes, unless a modifier selects a type that may be longer */
+        if (IsPacked && *MsgSpec != 0 && strchr("diouxXc", *MsgSpec) != NULL)
+        {
+            if (LengthMod == 'L' || (*MsgSpec == 'c' && LengthMod != 0))
+            {
+                IsPacked = false;
+            }
+            else if (LengthMod == 0 || LengthMod == 'h' || LengthMod == 'H')
+            {
+                IntArg   = (int32)WideArg;
+                IsPacked = EVS_PackEventArgData(Buffer, BufferSize, PackedSize, &IntArg, sizeof(IntArg));
+            }
+            else
+            {
+                IsPacked = EVS_PackEventArgData(Buffer, BufferSize, PackedSize, &WideArg, sizeof(WideArg));
+            }
+        }
+
+        if (*MsgSpec != 0)
+        {
+            ++MsgSpec;
+        }
+    }
+
+    return IsPacked;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_SendBinaryEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_SendBinaryEvent(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                         const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
+{
+    CFE_EVS_BinaryEventTlm_t BinaryEventTlm;
+    CFE_EVS_LongEventTlm_t   LongEventTlm; /* The log and the output ports always get the long format */
+    CFE_ES_AppId_t           AppID;
+    va_list                  ArgCopy;
+    size_t                   ArgSize;
+    bool                     IsPacked;
+
+    memset(&BinaryEventTlm, 0, sizeof(BinaryEventTlm));
+    CFE_MSG_Init(&BinaryEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_BINARY_EVENT_MSG_MID),
+                 sizeof(BinaryEventTlm));
+
+    /* Pack from a copy, so the arguments can still be formatted */
+    va_copy(ArgCopy, ArgPtr);
+    IsPacked = EVS_PackEventArgs(BinaryEventTlm.Payload.ArgData, sizeof(BinaryEventTlm.Payload.ArgData), &ArgSize,
+                                 MsgSpec, ArgCopy);
+    va_end(ArgCopy);
+
+    if (!IsPacked)
+    {
+        return false;
+    }
+
+    AppID = EVS_AppDataGetID(AppDataPtr);
+
+    BinaryEventTlm.Payload.FormatID  = EVS_GetFormatID(MsgSpec);
+    BinaryEventTlm.Payload.AppID     = AppID;
+    BinaryEventTlm.Payload.EventID   = EventID;
+    BinaryEventTlm.Payload.EventType = EventType;
+
+    /* Only the part of ArgData that is used is sent */
+    CFE_MSG_SetSize(&BinaryEventTlm.TlmHeader.Msg, offsetof(CFE_EVS_BinaryEventTlm_t, Payload.ArgData) + ArgSize);
+    CFE_MSG_SetMsgTime(&BinaryEventTlm.TlmHeader.Msg, *TimeStamp);
+
+    /*
+     * The event log keeps the same format regardless of the event format mode,
+     * so the event is also expanded to a long format entry for the log and the
+     * output ports.  The text is only formatted when one of them takes it.
+     */
+    if (CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort != 0 || !EVS_CountLogDiscard())
+    {
+        CFE_MSG_Init(&LongEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
+                     sizeof(LongEventTlm));
+        CFE_MSG_SetMsgTime(&LongEventTlm.TlmHeader.Msg, *TimeStamp);
+        CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, AppID,
+                          sizeof(LongEventTlm.Payload.PacketID.AppName));
+        LongEventTlm.Payload.PacketID.EventID      = EventID;
+        LongEventTlm.Payload.PacketID.EventType    = EventType;
+        LongEventTlm.Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
+        LongEventTlm.Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
+
+        EVS_FormatMessage((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec,
+                          ArgPtr);
+
+        EVS_AddLog(&LongEventTlm);
+        EVS_SendViaPorts(&LongEventTlm);
+    }
+
+    CFE_SB_TransmitMsg(&BinaryEventTlm.TlmHeader.Msg, true);
+
+    EVS_IncrementSendCounters(AppDataPtr);
+
+    return true;
+}
+
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_AsyncQueueEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_AsyncQueueEvent(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                         const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
+{
+    EVS_AsyncRing_t * Ring;
+    EVS_AsyncEvent_t *Event;
+    osal_index_t      TaskIndex;
+    uint32            WriteCount;
+    uint32            ReadCount;
+
+    /* Nothing to send the event until the async task is running */
+    if (!CFE_EVS_Global.AsyncEnabled)
+    {
+        return false;
+    }
+
+    /*
+     * Each OSAL task has its own ring, at the same index as its OSAL table entry,
+     * so there is only ever one writer to a ring.  Other callers send directly.
+     */
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId(), &TaskIndex) != OS_SUCCESS)
+    {
+        return false;
+    }
+
+    Ring       = &CFE_EVS_Global.AsyncRing[TaskIndex];
+    WriteCount = Ring->WriteCount;
+
+    /* The entry must not be reused until the async task has finished with it */
+    OS_MutSemTake(CFE_EVS_Global.AsyncMutexID);
+    ReadCount = Ring->ReadCount;
+    OS_MutSemGive(CFE_EVS_Global.AsyncMutexID);
+
+    if ((WriteCount - ReadCount) >= CFE_PLATFORM_EVS_ASYNC_RING_SIZE)
+    {
+        /* ring is full */
+        return false;
+    }
+
+    Event            = &Ring->Event[WriteCount & (CFE_PLATFORM_EVS_ASYNC_RING_SIZE - 1)];
+    Event->AppID     = EVS_AppDataGetID(AppDataPtr);
+    Event->Time      = *TimeStamp;
+    Event->EventID   = EventID;
+    Event->EventType = EventType;
+
+    /* The arguments may point to data owned by the caller, so the text is formatted now */
+    EVS_FormatMessage(Event->Message, sizeof(Event->Message), MsgSpec, ArgPtr);
+
+    /* update the count only after the entry is complete, the mutex makes the entry visible to the reader */
+    OS_MutSemTake(CFE_EVS_Global.AsyncMutexID);
+    Ring->WriteCount = WriteCount + 1;
+    OS_MutSemGive(CFE_EVS_Global.AsyncMutexID);
+
+    OS_BinSemGive(CFE_EVS_Global.AsyncSemID);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_AsyncProcessRings
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 EVS_AsyncProcessRings(void)
+{
+    CFE_EVS_LongEventTlm_t  LongEventTlm;
+    EVS_AsyncRing_t *       Ring;
+    const EVS_AsyncEvent_t *Event;
+    EVS_AppData_t *         AppDataPtr;
+    uint32                  i;
+    uint32                  ReadCount;
+    uint32                  WriteCount[OS_MAX_TASKS];
+    uint32                  Total;
+
+    Total = 0;
+
+    /* Entries up to these counts are complete and visible, once the mutex has been taken */
+    OS_MutSemTake(CFE_EVS_Global.AsyncMutexID);
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        WriteCount[i] = CFE_EVS_Global.AsyncRing[i].WriteCount;
+    }
+    OS_MutSemGive(CFE_EVS_Global.AsyncMutexID);
+
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        Ring      = &CFE_EVS_Global.AsyncRing[i];
+        ReadCount = Ring->ReadCount;
+
+        while (ReadCount != WriteCount[i])
+        {
+            Event = &Ring->Event[ReadCount & (CFE_PLATFORM_EVS_ASYNC_RING_SIZE - 1)];
+
+            CFE_MSG_Init(&LongEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
+                         sizeof(LongEventTlm));
+            LongEventTlm.Payload.PacketID.EventID   = Event->EventID;
+            LongEventTlm.Payload.PacketID.EventType = Event->EventType;
+            memcpy(LongEventTlm.Payload.Message, Event->Message, sizeof(LongEventTlm.Payload.Message));
+
+            /* The app may have been deleted since, in which case there is no counter to update */
+            AppDataPtr = EVS_GetAppDataByID(Event->AppID);
+            if (!EVS_AppDataIsMatch(AppDataPtr, Event->AppID))
+            {
+                AppDataPtr = NULL;
+            }
+
+            EVS_SendEventTelemetry(Event->AppID, AppDataPtr, &LongEventTlm, &Event->Time);
+
+            ++ReadCount;
+            ++Total;
+        }
+
+        /* the entries can be reused by the writer after this */
+        if (ReadCount != Ring->ReadCount)
+        {
+            OS_MutSemTake(CFE_EVS_Global.AsyncMutexID);
+            Ring->ReadCount = ReadCount;
+            OS_MutSemGive(CFE_EVS_Global.AsyncMutexID);
+        }
+    }
+
+    return Total;
+}
+
+#endif /* CFE_PLATFORM_EVS_ASYNC_RING_SIZE */
+
 /*----------------------------------------------------------------
  *
  * Function: EVS_SendViaPorts
@@ -196,10 +196,28 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
 /**
  * @brief Find the filter record corresponding to the given event ID
  *
- * This routine searches and returns an index to the given Event ID with the
- * given application filter array.
+ * This routine looks up the given Event ID in the filter index of the given
+ * application, and returns its filter record, or NULL if it has none.
  */
-EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray);
+EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_AppData_t *AppDataPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an unused filter record of the given application
+ *
+ * @returns the first unused filter record, or NULL if all are in use
+ */
+EVS_BinFilter_t *EVS_FindFreeFilter(EVS_AppData_t *AppDataPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Rebuild the filter index of the given application
+ *
+ * This must be called after the EventID of any filter record is changed.  It is
+ * only done when filters are registered, added or deleted, so the index is
+ * simply rebuilt from the filter records in order.
+ */
+void EVS_UpdateFilterIndex(EVS_AppData_t *AppDataPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -231,6 +249,101 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask);
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *Time, const char *MsgSpec, va_list ArgPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Format the text of an event message
+ *
+ * This routine expands the event format string into the given buffer.  If the
+ * expanded text does not fit, it is truncated and marked with the truncation
+ * character, and the truncated message counter is incremented.
+ */
+void EVS_FormatMessage(char *Buffer, size_t BufferSize, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send an event whose message text has already been formatted
+ *
+ * This routine completes the long event packet, then writes it to the event
+ * log, the enabled output ports and the software bus.  The application's event
+ * counter is only incremented if AppDataPtr is not NULL.
+ */
+void EVS_SendEventTelemetry(CFE_ES_AppId_t AppID, EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlm,
+                            const CFE_TIME_SysTime_t *TimeStamp);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Increment the event send counters
+ *
+ * The application's event counter is only incremented if AppDataPtr is not NULL.
+ */
+void EVS_IncrementSendCounters(EVS_AppData_t *AppDataPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Compute the identifier of an event format string
+ *
+ * This is the hash described for #CFE_EVS_BinaryEventTlm_Payload_t, which the
+ * ground system uses to find the format string of a binary event.
+ */
+uint32 EVS_GetFormatID(const char *MsgSpec);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Pack the arguments of an event for a binary event message
+ *
+ * The format string is only parsed to find the type of each argument, which is
+ * copied to the buffer as described for #CFE_EVS_BinaryEventTlm_Payload_t.
+ *
+ * @returns true if all the arguments were packed, or false if they do not fit
+ * in the buffer or the format string uses a conversion which is not supported.
+ */
+bool EVS_PackEventArgs(uint8 *Buffer, size_t BufferSize, size_t *PackedSize, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send an event in the binary format
+ *
+ * This routine sends the event with its arguments packed rather than expanded
+ * into text.  The text is still formatted for the event log and the output
+ * ports, so the log entries keep the long format, but only when an output
+ * port is enabled or the log has room for the event.  The format arguments
+ * are only used if the event is sent.
+ *
+ * @returns true if the event was sent, or false if the arguments could not be
+ * packed.  In that case the caller must send the event as text.
+ */
+bool EVS_SendBinaryEvent(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                         const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr);
+
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Queue an event for the EVS async task
+ *
+ * This routine formats the event text into the ring of the calling task, and
+ * wakes the EVS async task to send it.  The format arguments are only used if
+ * the event is queued.
+ *
+ * @returns true if the event was queued, or false if the async task is not
+ * running, the caller is not an OSAL task, or its ring is full.  In that case
+ * the caller must send the event itself.
+ */
+bool EVS_AsyncQueueEvent(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                         const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send the events queued in all of the task rings
+ *
+ * Called by the EVS async task.  Only the events that are in the rings when the
+ * pass starts are sent, so a task that keeps sending events cannot hold the
+ * async task on its ring.
+ *
+ * @returns the number of events sent
+ */
+uint32 EVS_AsyncProcessRings(void);
+#endif
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Internal function to send an event
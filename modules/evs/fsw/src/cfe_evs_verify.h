@@ -47,9 +47,14 @@
 #error CFE_PLATFORM_EVS_DEFAULT_LOG_MODE can only be 0 (Overwrite) or 1 (Discard)!
 #endif
 
-#if (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_LONG) && \
-    (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_SHORT)
-#error CFE_EVS_DEFAULT_MSG_FORMAT can only be CFE_EVS_MsgFormat_LONG or CFE_EVS_MsgFormat_SHORT !
+#if (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_LONG) &&  \
+    (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_SHORT) && \
+    (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_BINARY)
+#error CFE_EVS_DEFAULT_MSG_FORMAT can only be CFE_EVS_MsgFormat_LONG, CFE_EVS_MsgFormat_SHORT or _BINARY !
+#endif
+
+#if CFE_PLATFORM_EVS_MAX_EVENT_FILTERS > 65535
+#error CFE_PLATFORM_EVS_MAX_EVENT_FILTERS cannot be greater than 65535!
 #endif
 
 #if CFE_PLATFORM_EVS_PORT_DEFAULT > 0x0F
@@ -63,4 +68,17 @@
 #error CFE_PLATFORM_EVS_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+#if CFE_PLATFORM_EVS_ASYNC_TASK_STACK_SIZE < 2048
+#error CFE_PLATFORM_EVS_ASYNC_TASK_STACK_SIZE must be greater than or equal to 2048
+#endif
+
+/*
+** Per-task asynchronous event ring size
+*/
+#if CFE_PLATFORM_EVS_ASYNC_RING_SIZE < 0
+#error CFE_PLATFORM_EVS_ASYNC_RING_SIZE cannot be negative!
+#elif (CFE_PLATFORM_EVS_ASYNC_RING_SIZE & (CFE_PLATFORM_EVS_ASYNC_RING_SIZE - 1)) != 0
+#error CFE_PLATFORM_EVS_ASYNC_RING_SIZE must be zero or a power of two!
+#endif
+
 #endif /* CFE_EVS_VERIFY_H */
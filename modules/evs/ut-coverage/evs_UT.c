@@ -114,6 +114,11 @@ static const UT_SoftwareBusSnapshot_Entry_t UT_EVS_SHORTFMT_SNAPSHOTDATA = {
     .SnapshotOffset = offsetof(CFE_EVS_ShortEventTlm_t, Payload.PacketID.EventID),
     .SnapshotSize   = sizeof(uint16)};
 
+static const UT_SoftwareBusSnapshot_Entry_t UT_EVS_BINARYFMT_SNAPSHOTDATA = {
+    .MsgId          = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_BINARY_EVENT_MSG_MID),
+    .SnapshotOffset = offsetof(CFE_EVS_BinaryEventTlm_t, Payload.EventID),
+    .SnapshotSize   = sizeof(uint16)};
+
 typedef struct
 {
     uint16 EventID;
@@ -171,6 +176,12 @@ static void UT_EVS_DoDispatchCheckEventsShort(void *MsgPtr, uint32 MsgSize, UT_T
     UT_EVS_DoDispatchCheckEvents_Impl(MsgPtr, MsgSize, DispatchId, &UT_EVS_SHORTFMT_SNAPSHOTDATA, EventCapture);
 }
 
+static void UT_EVS_DoDispatchCheckEventsBinary(void *MsgPtr, uint32 MsgSize, UT_TaskPipeDispatchId_t DispatchId,
+                                               UT_EVS_EventCapture_t *EventCapture)
+{
+    UT_EVS_DoDispatchCheckEvents_Impl(MsgPtr, MsgSize, DispatchId, &UT_EVS_BINARYFMT_SNAPSHOTDATA, EventCapture);
+}
+
 static void UT_EVS_DoGenericCheckEvents(void (*Func)(void), UT_EVS_EventCapture_t *EventCapture)
 {
     UT_SoftwareBusSnapshot_Entry_t SnapshotData = UT_EVS_LONGFMT_SNAPSHOTDATA;
@@ -202,6 +213,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_FilterRegistration);
     UT_ADD_TEST(Test_FilterReset);
     UT_ADD_TEST(Test_Format);
+    UT_ADD_TEST(Test_BinaryFormat);
     UT_ADD_TEST(Test_Ports);
     UT_ADD_TEST(Test_Logging);
     UT_ADD_TEST(Test_WriteApp);
@@ -210,6 +222,9 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_FilterCmd);
     UT_ADD_TEST(Test_InvalidCmd);
     UT_ADD_TEST(Test_Misc);
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+    UT_ADD_TEST(Test_AsyncEvents);
+#endif
 }
 
 /*
@@ -339,11 +354,38 @@ void Test_Init(void)
     CFE_EVS_TaskInit();
     CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[10]);
 
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+    /* Test task initialization where the async mutex creation fails */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_EVS_TaskInit(), OS_ERROR);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+
+    /* Test task initialization where the async semaphore creation fails */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_EVS_TaskInit(), OS_ERROR);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+
+    /* Test task initialization where the async task creation fails */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_INT32_EQ(CFE_EVS_TaskInit(), CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_BOOL_FALSE(CFE_EVS_Global.AsyncEnabled);
+#endif
+
     /* Test successful task initialization */
     UT_InitData();
     CFE_EVS_TaskInit();
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
 
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+    /* The other tests check events sent directly, only Test_AsyncEvents queues them */
+    UtAssert_BOOL_TRUE(CFE_EVS_Global.AsyncEnabled);
+    CFE_EVS_Global.AsyncEnabled = false;
+#endif
+
     /* Enable DEBUG message output */
     UT_InitData();
     appbitcmd.Payload.BitMask = CFE_EVS_DEBUG_BIT | CFE_EVS_INFORMATION_BIT | CFE_EVS_ERROR_BIT | CFE_EVS_CRITICAL_BIT;
@@ -525,7 +567,7 @@ void Test_FilterRegistration(void)
 
     /* Send last information message, which should cause filtering to lock */
     UT_InitData();
-    FilterPtr        = EVS_FindEventID(0, (EVS_BinFilter_t *)AppDataPtr->BinFilters);
+    FilterPtr        = EVS_FindEventID(0, AppDataPtr);
     FilterPtr->Count = CFE_EVS_MAX_FILTER_COUNT - 1;
     CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
 
@@ -537,6 +579,36 @@ void Test_FilterRegistration(void)
     UT_InitData();
     CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "FAILED"));
 
+    /* Test that event IDs at the same position in the filter index are all found,
+     * including where the search wraps around the end of the index
+     */
+    UT_InitData();
+    filter[0].EventID = 1;
+    filter[1].EventID = 1 + CFE_EVS_FILTER_INDEX_SIZE;
+    filter[2].EventID = CFE_EVS_FILTER_INDEX_SIZE - 1;
+    filter[3].EventID = (2 * CFE_EVS_FILTER_INDEX_SIZE) - 1;
+    for (i = 0; i < 4; i++)
+    {
+        filter[i].Mask = CFE_EVS_NO_MASK;
+    }
+
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(filter, 4, CFE_EVS_EventFilter_BINARY));
+    for (i = 0; i < 4; i++)
+    {
+        UtAssert_ADDRESS_EQ(EVS_FindEventID(filter[i].EventID, AppDataPtr), &AppDataPtr->BinFilters[i]);
+    }
+
+    UtAssert_NULL(EVS_FindEventID(1 + (2 * CFE_EVS_FILTER_INDEX_SIZE), AppDataPtr));
+    UtAssert_NULL(EVS_FindEventID((uint16)CFE_EVS_FREE_SLOT, AppDataPtr));
+
+    /* Test that the other event IDs are still found after one is removed */
+    UT_InitData();
+    AppDataPtr->BinFilters[0].EventID = CFE_EVS_FREE_SLOT;
+    EVS_UpdateFilterIndex(AppDataPtr);
+    UtAssert_NULL(EVS_FindEventID(1, AppDataPtr));
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(filter[1].EventID, AppDataPtr), &AppDataPtr->BinFilters[1]);
+    UtAssert_ADDRESS_EQ(EVS_FindFreeFilter(AppDataPtr), &AppDataPtr->BinFilters[0]);
+
     /* Return application to original state: re-register application */
     UT_InitData();
     CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
@@ -719,6 +791,170 @@ void Test_Format(void)
     CFE_UtAssert_SUCCESS(CFE_EVS_SendTimedEvent(time, 0, CFE_EVS_EventType_INFORMATION, "%s", long_msg));
 }
 
+/*
+** Test binary event format
+*/
+void Test_BinaryFormat(void)
+{
+    int                              i;
+    char                             long_msg[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + 2];
+    uint8                            Expected[64];
+    size_t                           ExpectedSize;
+    int32                            IntVal;
+    int64                            WideVal;
+    double                           DoubleVal;
+    CFE_EVS_SetEventFormatModeCmd_t  modecmd;
+    CFE_EVS_BinaryEventTlm_Payload_t CapturedMsg;
+    UT_SoftwareBusSnapshot_Entry_t   BinaryFmtSnapshotData = {
+        .MsgId          = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_BINARY_EVENT_MSG_MID),
+        .SnapshotBuffer = &CapturedMsg,
+        .SnapshotOffset = offsetof(CFE_EVS_BinaryEventTlm_t, Payload),
+        .SnapshotSize   = sizeof(CapturedMsg)};
+    EVS_AppData_t *        AppDataPtr;
+    CFE_ES_AppId_t         AppID;
+    UT_EVS_MSGInitData_t   MsgData;
+    CFE_EVS_LogMode_Enum_t LogMode;
+
+    /* Get a local ref to the "current" AppData table entry */
+    EVS_GetCurrentContext(&AppDataPtr, &AppID);
+
+    UtPrintf("Begin Test Binary Format");
+
+    /* Test the format identifier against known FNV-1a values */
+    UtAssert_UINT32_EQ(EVS_GetFormatID(""), 0x811C9DC5);
+    UtAssert_UINT32_EQ(EVS_GetFormatID("a"), 0xE40C292C);
+
+    /* Test set event format mode command using a valid command to set binary
+     * format, reports implicitly via event
+     */
+    UT_InitData();
+    memset(&modecmd, 0, sizeof(modecmd));
+    modecmd.Payload.MsgFormat = CFE_EVS_MsgFormat_BINARY;
+    UT_EVS_DoDispatchCheckEventsBinary(&modecmd, sizeof(modecmd), UT_TPID_CFE_EVS_CMD_SET_EVENT_FORMAT_MODE_CC,
+                                       &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_SETEVTFMTMOD_EID);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode, CFE_EVS_MsgFormat_BINARY);
+
+    /* Test that the arguments are packed rather than formatted */
+    UT_InitData();
+    memset(&CapturedMsg, 0xFF, sizeof(CapturedMsg));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &BinaryFmtSnapshotData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(3, CFE_EVS_EventType_INFORMATION, "Binary %d %u %ld %s %c %.3s %*d %f %%",
+                                           -5, 7U, -9L, "str", 'x', "abcdef", 4, 12, 1.5));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_STUB_COUNT(OS_printf, 0);
+    UtAssert_UINT32_EQ(CapturedMsg.FormatID, EVS_GetFormatID("Binary %d %u %ld %s %c %.3s %*d %f %%"));
+    CFE_UtAssert_TRUE(CFE_RESOURCEID_TEST_EQUAL(CapturedMsg.AppID, AppID));
+    UtAssert_UINT32_EQ(CapturedMsg.EventID, 3);
+    UtAssert_UINT32_EQ(CapturedMsg.EventType, CFE_EVS_EventType_INFORMATION);
+
+    ExpectedSize = 0;
+    IntVal       = -5;
+    memcpy(&Expected[ExpectedSize], &IntVal, sizeof(IntVal));
+    ExpectedSize += sizeof(IntVal);
+    IntVal = 7;
+    memcpy(&Expected[ExpectedSize], &IntVal, sizeof(IntVal));
+    ExpectedSize += sizeof(IntVal);
+    WideVal = -9;
+    memcpy(&Expected[ExpectedSize], &WideVal, sizeof(WideVal));
+    ExpectedSize += sizeof(WideVal);
+    memcpy(&Expected[ExpectedSize], "str", 4);
+    ExpectedSize += 4;
+    IntVal = 'x';
+    memcpy(&Expected[ExpectedSize], &IntVal, sizeof(IntVal));
+    ExpectedSize += sizeof(IntVal);
+    memcpy(&Expected[ExpectedSize], "abc", 4);
+    ExpectedSize += 4;
+    IntVal = 4;
+    memcpy(&Expected[ExpectedSize], &IntVal, sizeof(IntVal));
+    ExpectedSize += sizeof(IntVal);
+    IntVal = 12;
+    memcpy(&Expected[ExpectedSize], &IntVal, sizeof(IntVal));
+    ExpectedSize += sizeof(IntVal);
+    DoubleVal = 1.5;
+    memcpy(&Expected[ExpectedSize], &DoubleVal, sizeof(DoubleVal));
+    ExpectedSize += sizeof(DoubleVal);
+    UtAssert_MemCmp(CapturedMsg.ArgData, Expected, ExpectedSize, "Packed arguments");
+
+    /* Test that the text is still formatted for an enabled output port */
+    UT_InitData();
+    CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort = CFE_EVS_PORT1_BIT;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Binary port %d", 1));
+    UtAssert_STUB_COUNT(OS_printf, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort = 0;
+
+    /* Test that the event log still gets a long format entry with the text */
+    UT_InitData();
+    CFE_EVS_Global.EVS_LogPtr->Next        = 0;
+    CFE_EVS_Global.EVS_LogPtr->LogFullFlag = false;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(5, CFE_EVS_EventType_INFORMATION, "Binary log %d", 2));
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_LogPtr->Next, 1);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_LogPtr->LogEntry[0].Payload.PacketID.EventID, 5);
+    UtAssert_StrCmp((char *)CFE_EVS_Global.EVS_LogPtr->LogEntry[0].Payload.Message, "Binary log 2", "Log entry text");
+
+    /* Test that the text is not formatted when no output port is enabled and the log discards the event */
+    UT_InitData();
+    LogMode                                               = CFE_EVS_Global.EVS_LogPtr->LogMode;
+    CFE_EVS_Global.EVS_LogPtr->LogFullFlag                = true;
+    CFE_EVS_Global.EVS_LogPtr->LogMode                    = CFE_EVS_LogMode_DISCARD;
+    CFE_EVS_Global.EVS_LogPtr->LogOverflowCounter         = 0;
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter = 0;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(6, CFE_EVS_EventType_INFORMATION, "Binary discard %0300d", 3));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetAppName, 0);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter, 0);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_LogPtr->LogOverflowCounter, 1);
+
+    /* The same event is formatted (and truncated) once the log has room for it */
+    UT_InitData();
+    CFE_EVS_Global.EVS_LogPtr->LogFullFlag = false;
+    CFE_EVS_Global.EVS_LogPtr->Next        = 0;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(6, CFE_EVS_EventType_INFORMATION, "Binary discard %0300d", 3));
+    UtAssert_STUB_COUNT(CFE_ES_GetAppName, 1);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter, 1);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_LogPtr->Next, 1);
+    CFE_EVS_Global.EVS_LogPtr->LogMode = LogMode;
+
+    /* Test that arguments which do not fit are sent in the long format */
+    UT_InitData();
+    for (i = 0; i <= CFE_MISSION_EVS_MAX_MESSAGE_LENGTH; i++)
+    {
+        long_msg[i] = (char)(i % 10 + 48);
+    }
+
+    long_msg[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + 1] = '\0';
+    UT_SetHookFunction(UT_KEY(CFE_MSG_Init), UT_EVS_MSGInitHook, &MsgData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "%s", long_msg));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    CFE_UtAssert_TRUE(CFE_SB_MsgId_Equal(MsgData.MsgId, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID)));
+
+    /* Test that conversions which cannot be packed are sent in the long format */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_MSG_Init), UT_EVS_MSGInitHook, &MsgData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Binary %ls", L"wide"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    CFE_UtAssert_TRUE(CFE_SB_MsgId_Equal(MsgData.MsgId, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID)));
+
+    /* Test that the other length modifiers and conversions are packed */
+    UT_InitData();
+    memset(&CapturedMsg, 0xFF, sizeof(CapturedMsg));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &BinaryFmtSnapshotData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION,
+                                           "Binary %hhd %hd %lld %jd %zd %td %lu %llx %jo %zu %tX %Lg %p %+#08.*e",
+                                           1, 2, 3LL, (intmax_t)4, (size_t)5, (ptrdiff_t)6, 7UL, 8ULL, (uintmax_t)9,
+                                           (size_t)10, (ptrdiff_t)11, (long double)12, (void *)&IntVal, 2, 13.0));
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    WideVal = 3;
+    UtAssert_MemCmp(&CapturedMsg.ArgData[8], &WideVal, sizeof(WideVal), "Packed long long");
+    DoubleVal = 13.0;
+    UtAssert_MemCmp(&CapturedMsg.ArgData[4 + 4 + (9 * 8) + 8 + 8 + 4], &DoubleVal, sizeof(DoubleVal), "Packed double");
+
+    /* Return to the long format for the other tests */
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+}
+
 /*
 ** Test enable/disable of port outputs
 */
@@ -1878,3 +2114,95 @@ void Test_Misc(void)
     EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, msg);
     UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter, 1);
 }
+
+#if (CFE_PLATFORM_EVS_ASYNC_RING_SIZE > 0)
+void Test_AsyncEvents(void)
+{
+    CFE_ES_AppId_t                 AppID;
+    EVS_AppData_t *                AppDataPtr;
+    EVS_AsyncRing_t *              Ring;
+    osal_index_t                   TaskIndex;
+    uint32                         i;
+    uint32                         EventCount;
+    UT_SoftwareBusSnapshot_Entry_t LocalSnapshotData = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_LONG_EVENT_MSG_MID)};
+
+    UtPrintf("Begin Test Async Events");
+
+    EVS_GetCurrentContext(&AppDataPtr, &AppID);
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+
+    /* Find the ring used by the calling task, in the same way as the implementation */
+    UT_InitData();
+    UtAssert_INT32_EQ(OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId(), &TaskIndex), OS_SUCCESS);
+    Ring = &CFE_EVS_Global.AsyncRing[TaskIndex];
+    memset(CFE_EVS_Global.AsyncRing, 0, sizeof(CFE_EVS_Global.AsyncRing));
+    CFE_EVS_Global.AsyncEnabled = true;
+
+    /* Test that an event is queued to the ring of the calling task, rather than sent */
+    UT_InitData();
+    EventCount = AppDataPtr->EventCount;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Test async %d", 1));
+    UtAssert_UINT32_EQ(Ring->WriteCount, 1);
+    UtAssert_UINT32_EQ(Ring->ReadCount, 0);
+    UtAssert_StrCmp(Ring->Event[0].Message, "Test async 1", "Queued message text");
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Only the async mutex is taken, to get the read count and to update the write count */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+    UtAssert_UINT32_EQ(AppDataPtr->EventCount, EventCount);
+
+    /* Test that the async task sends the queued event */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &LocalSnapshotData);
+    UtAssert_UINT32_EQ(EVS_AsyncProcessRings(), 1);
+    UtAssert_UINT32_EQ(LocalSnapshotData.Count, 1);
+    UtAssert_UINT32_EQ(Ring->ReadCount, 1);
+    UtAssert_UINT32_EQ(AppDataPtr->EventCount, EventCount + 1);
+
+    /* With nothing queued, the async mutex is only taken once to get the write counts */
+    UT_ResetState(UT_KEY(OS_MutSemGive));
+    UtAssert_UINT32_EQ(EVS_AsyncProcessRings(), 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* Test that an event is sent directly when the ring is full */
+    UT_InitData();
+    for (i = 0; i < CFE_PLATFORM_EVS_ASYNC_RING_SIZE; ++i)
+    {
+        CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Test async fill");
+    }
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Test async full");
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(Ring->WriteCount - Ring->ReadCount, CFE_PLATFORM_EVS_ASYNC_RING_SIZE);
+    UtAssert_UINT32_EQ(EVS_AsyncProcessRings(), CFE_PLATFORM_EVS_ASYNC_RING_SIZE);
+
+    /* Test that an event from a caller which is not an OSAL task is sent directly */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERR_INVALID_ID);
+    CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Test async no task");
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+
+    /* Test that an event queued by an app which has since been deleted is still sent */
+    UT_InitData();
+    CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Test async deleted");
+    EventCount        = AppDataPtr->EventCount;
+    AppDataPtr->AppID = CFE_ES_APPID_UNDEFINED;
+    UtAssert_UINT32_EQ(EVS_AsyncProcessRings(), 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(AppDataPtr->EventCount, EventCount);
+    AppDataPtr->AppID = AppID;
+
+    /* Test that the async task stops queueing events if the semaphore fails */
+    UT_InitData();
+    CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Test async task");
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+    CFE_EVS_AsyncTask();
+    UtAssert_STUB_COUNT(OS_BinSemTake, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_BOOL_FALSE(CFE_EVS_Global.AsyncEnabled);
+}
+#endif
@@ -141,6 +141,22 @@ void Test_FilterReset(void);
 ******************************************************************************/
 void Test_Format(void);
 
+/*****************************************************************************/
+/**
+** \brief Test binary format events
+**
+** \par Description
+**        This function tests packing of event arguments for binary format
+**        events, and falling back to the long format.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_BinaryFormat(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test enable/disable of port outputs
@@ -265,4 +281,20 @@ void Test_InvalidCmd(void);
 ******************************************************************************/
 void Test_Misc(void);
 
+/*****************************************************************************/
+/**
+** \brief Test asynchronous event sending
+**
+** \par Description
+**        This function tests queueing events to the per-task rings and
+**        sending them from the async task.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only built when CFE_PLATFORM_EVS_ASYNC_RING_SIZE is nonzero.
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_AsyncEvents(void);
+
 #endif /* EVS_UT_H */
@@ -667,35 +667,192 @@ CFE_Status_t CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *File
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_FS_RunBackgroundFileDump
+ * Function: CFE_FS_BackgroundFileWrite
  *
- * Implemented per public API
+ * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+bool CFE_FS_BackgroundFileWrite(CFE_FS_FileWriteMetaData_t *Meta, const void *DataPtr, size_t DataSize,
+                                size_t SourceSize)
 {
-    CFE_FS_CurrentFileState_t *       State;
-    CFE_FS_BackgroundFileDumpEntry_t *Curr;
-    CFE_FS_FileWriteMetaData_t *      Meta;
-    int32                             Status;
-    CFE_FS_Header_t                   FileHdr;
-    void *                            RecordPtr;
-    size_t                            RecordSize;
-    bool                              IsEOF;
+    CFE_FS_CurrentFileState_t *State;
+    int32                      Status;
+    OS_time_t                  StartTime;
+    OS_time_t                  EndTime;
+    int64                      ElapsedUsec;
+    uint64                     MeasuredRate;
+    uint64                     NewRate;
 
-    State      = &CFE_FS_Global.FileDump.Current;
-    Curr       = NULL;
-    IsEOF      = false;
-    RecordPtr  = NULL;
-    RecordSize = 0;
+    State = &CFE_FS_Global.FileDump.Current;
 
-    State->Credit += (ElapsedTime * CFE_FS_BACKGROUND_CREDIT_PER_SECOND) / 1000;
-    if (State->Credit > CFE_FS_BACKGROUND_MAX_CREDIT)
+    CFE_PSP_GetTime(&StartTime);
+    Status = OS_write(State->Fd, DataPtr, DataSize);
+    CFE_PSP_GetTime(&EndTime);
+
+    if (Status != DataSize)
+    {
+        /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
+        OS_close(State->Fd);
+        State->Fd = OS_OBJECT_ID_UNDEFINED;
+
+        /* generate write error event */
+        Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, Status, State->RecordNum, DataSize,
+                      State->FileSize);
+        return false;
+    }
+
+    State->FileSize += DataSize;
+
+    /*
+     * Adjust the credit rate toward the configured share of the measured throughput.
+     * This is measured in source bytes, the same unit the credit is charged in.
+     * A write that completed too quickly to be measured says nothing about the
+     * device throughput, so it leaves the current rate unchanged.
+     */
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    if (ElapsedUsec <= 0)
     {
-        State->Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+        return true;
+    }
+
+    MeasuredRate = ((uint64)SourceSize * 1000000 * CFE_FS_BACKGROUND_WRITE_DUTY_PERCENT) / (100 * ElapsedUsec);
+    if (MeasuredRate > CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND)
+    {
+        MeasuredRate = CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND;
+    }
+
+    NewRate = State->CreditRate;
+    if (NewRate < CFE_FS_BACKGROUND_CREDIT_PER_SECOND)
+    {
+        NewRate = CFE_FS_BACKGROUND_CREDIT_PER_SECOND;
+    }
+
+    /* smooth out the variation between individual writes */
+    NewRate = ((NewRate * 3) + MeasuredRate) / 4;
+    if (NewRate < CFE_FS_BACKGROUND_CREDIT_PER_SECOND)
+    {
+        NewRate = CFE_FS_BACKGROUND_CREDIT_PER_SECOND;
+    }
+
+    State->CreditRate = (uint32)NewRate;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_StageBackgroundFileData
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_StageBackgroundFileData(CFE_FS_FileWriteMetaData_t *Meta, const void *DataPtr, size_t DataSize)
+{
+    CFE_FS_CurrentFileState_t *State;
+    const uint8 *              SrcPtr;
+    size_t                     ChunkSize;
+    bool                       Result;
+
+    State  = &CFE_FS_Global.FileDump.Current;
+    SrcPtr = DataPtr;
+    Result = true;
+
+    while (DataSize > 0 && Result)
+    {
+        if (State->BufferUsed >= sizeof(State->Buffer))
+        {
+            Result = CFE_FS_FlushBackgroundFileBuffer(Meta);
+        }
+        else
+        {
+            ChunkSize = sizeof(State->Buffer) - State->BufferUsed;
+            if (ChunkSize > DataSize)
+            {
+                ChunkSize = DataSize;
+            }
+
+            memcpy(&State->Buffer[State->BufferUsed], SrcPtr, ChunkSize);
+            State->BufferUsed += ChunkSize;
+            SrcPtr += ChunkSize;
+            DataSize -= ChunkSize;
+        }
+    }
+
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_FlushBackgroundFileBuffer
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_FlushBackgroundFileBuffer(CFE_FS_FileWriteMetaData_t *Meta)
+{
+    CFE_FS_CurrentFileState_t *State;
+    CFE_FS_CompressedBlock_t * Block;
+    size_t                     CompressedSize;
+    int32                      EndianCheck = 0x01020304;
+    bool                       Result;
+
+    State  = &CFE_FS_Global.FileDump.Current;
+    Result = true;
+
+    if (State->BufferUsed > 0)
+    {
+        if (Meta->Compress)
+        {
+            Block = &State->CompressedBlock;
+
+            /* Only keep the compressed data if it is actually smaller */
+            CompressedSize = CFE_FS_CompressBlock(Block->Data, State->BufferUsed - 1, State->Buffer, State->BufferUsed);
+            if (CompressedSize == 0)
+            {
+                memcpy(Block->Data, State->Buffer, State->BufferUsed);
+                CompressedSize = State->BufferUsed;
+            }
+
+            Block->Hdr.CompressedSize   = CompressedSize;
+            Block->Hdr.UncompressedSize = State->BufferUsed;
+
+            /* The block header is big endian, like the FS header */
+            if ((*(char *)(&EndianCheck)) == 0x04)
+            {
+                CFE_FS_ByteSwapUint32(&Block->Hdr.CompressedSize);
+                CFE_FS_ByteSwapUint32(&Block->Hdr.UncompressedSize);
+            }
+
+            Result = CFE_FS_BackgroundFileWrite(Meta, Block, sizeof(Block->Hdr) + CompressedSize, State->BufferUsed);
+        }
+        else
+        {
+            Result = CFE_FS_BackgroundFileWrite(Meta, State->Buffer, State->BufferUsed, State->BufferUsed);
+        }
+
+        State->BufferUsed = 0;
     }
 
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_GetPendingBackgroundFileDump
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_FS_BackgroundFileDumpEntry_t *CFE_FS_GetPendingBackgroundFileDump(void)
+{
+    CFE_FS_BackgroundFileDumpEntry_t *Curr;
+
+    Curr = NULL;
+
     /*
      * Lock shared data.
      * Not strictly necessary as the "CompleteCount" is only updated
@@ -711,12 +868,32 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
 
     CFE_FS_UnlockSharedData(__func__);
 
-    if (Curr == NULL)
-    {
-        return false;
-    }
+    return Curr;
+}
 
-    Meta = Curr->Meta;
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_ProcessBackgroundFileDump
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_ProcessBackgroundFileDump(CFE_FS_BackgroundFileDumpEntry_t *Curr)
+{
+    CFE_FS_CurrentFileState_t * State;
+    CFE_FS_FileWriteMetaData_t *Meta;
+    int32                       Status;
+    CFE_FS_Header_t             FileHdr;
+    void *                      RecordPtr;
+    size_t                      RecordSize;
+    bool                        IsEOF;
+
+    State      = &CFE_FS_Global.FileDump.Current;
+    Meta       = Curr->Meta;
+    IsEOF      = false;
+    RecordPtr  = NULL;
+    RecordSize = 0;
 
     if (!OS_ObjectIdDefined(State->Fd) && Meta->IsPending)
     {
@@ -730,6 +907,10 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
         else
         {
             CFE_FS_InitHeader(&FileHdr, Meta->Description, Meta->FileSubType);
+            if (Meta->Compress)
+            {
+                FileHdr.SubType |= CFE_FS_SUBTYPE_COMPRESSED_FLAG;
+            }
 
             /* write the cFE header to the file */
             Status = CFE_FS_WriteHeader(State->Fd, &FileHdr);
@@ -744,7 +925,8 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
             {
                 State->FileSize = sizeof(CFE_FS_Header_t);
                 State->Credit -= sizeof(CFE_FS_Header_t);
-                State->RecordNum = 0;
+                State->RecordNum  = 0;
+                State->BufferUsed = 0;
             }
         }
     }
@@ -766,30 +948,35 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
             State->Credit -= RecordSize;
 
             /*
-             * Now write to file
+             * Records are staged in the buffer and written out together.  Records too large
+             * to stage are written directly, unless compressing, which works on whole buffers.
              */
-            Status = OS_write(State->Fd, RecordPtr, RecordSize);
-
-            if (Status != RecordSize)
+            if (RecordSize > sizeof(State->Buffer) && !Meta->Compress)
             {
-                /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
-                OS_close(State->Fd);
-                State->Fd = OS_OBJECT_ID_UNDEFINED;
-
-                /* generate write error event */
-                Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, Status, State->RecordNum, RecordSize,
-                              State->FileSize);
-                break;
+                if (!CFE_FS_FlushBackgroundFileBuffer(Meta) ||
+                    !CFE_FS_BackgroundFileWrite(Meta, RecordPtr, RecordSize, RecordSize))
+                {
+                    break;
+                }
             }
-            else
+            else if (!CFE_FS_StageBackgroundFileData(Meta, RecordPtr, RecordSize))
             {
-                State->FileSize += RecordSize;
+                break;
             }
         }
 
         ++State->RecordNum;
 
-    } /* end if */
+    } /* end while */
+
+    /*
+     * Write out anything still staged, so the file holds every record consumed so far.
+     * If this fails the file is closed early and it is not a normal EOF.
+     */
+    if (OS_ObjectIdDefined(State->Fd) && !CFE_FS_FlushBackgroundFileBuffer(Meta))
+    {
+        IsEOF = false;
+    }
 
     /* On normal EOF close the file and generate the complete event */
     if (IsEOF)
@@ -820,7 +1007,68 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
 
     } /* end if */
 
-    return !IsEOF;
+    return IsEOF;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_RunBackgroundFileDump
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+{
+    CFE_FS_CurrentFileState_t *       State;
+    CFE_FS_BackgroundFileDumpEntry_t *Curr;
+    uint32                            CreditRate;
+    int64                             Credit;
+    int64                             MaxCredit;
+
+    State = &CFE_FS_Global.FileDump.Current;
+
+    /*
+     * Accumulate credit at the current rate, which is never less than the minimum.
+     * The cap represents a fixed amount of time at the current rate.
+     */
+    CreditRate = State->CreditRate;
+    if (CreditRate < CFE_FS_BACKGROUND_CREDIT_PER_SECOND)
+    {
+        CreditRate = CFE_FS_BACKGROUND_CREDIT_PER_SECOND;
+    }
+
+    MaxCredit = ((int64)CFE_FS_BACKGROUND_MAX_CREDIT * CreditRate) / CFE_FS_BACKGROUND_CREDIT_PER_SECOND;
+    Credit    = State->Credit + (((int64)ElapsedTime * CreditRate) / 1000);
+    if (Credit > MaxCredit)
+    {
+        Credit = MaxCredit;
+    }
+
+    State->Credit = (int32)Credit;
+
+    /*
+     * Keep going through the queue as long as files finish normally and credit remains,
+     * so several small requests can be completed in a single cycle.
+     */
+    Curr = CFE_FS_GetPendingBackgroundFileDump();
+    while (Curr != NULL)
+    {
+        if (!CFE_FS_ProcessBackgroundFileDump(Curr))
+        {
+            /* file is still in progress, or it ended early (which is reported via event) */
+            break;
+        }
+
+        Curr = CFE_FS_GetPendingBackgroundFileDump();
+        if (State->Credit <= 0)
+        {
+            break;
+        }
+    }
+
+    /* report whether there is still work to do */
+    return (Curr != NULL);
 }
 
 /*----------------------------------------------------------------
@@ -0,0 +1,253 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: cfe_fs_compress.c
+**
+** Purpose:  cFE File Services (FS) block compression for background file writes
+**
+** Notes:
+**   The output is in the LZ4 block format, so it can be decoded on the
+**   ground with any standard LZ4 implementation (e.g. LZ4_decompress_safe).
+**   Only the compressor is implemented here; a simple greedy match search
+**   is used, which favors speed and a small memory footprint over ratio.
+**
+*/
+
+/*
+** Required header files
+*/
+#include "cfe_fs_module_all.h"
+
+#include <string.h>
+
+/*
+** Local Macro Definitions
+*/
+
+/*
+ * Constants defined by the LZ4 block format
+ */
+#define CFE_FS_COMPRESS_MIN_MATCH     4     /* Shortest match that can be encoded */
+#define CFE_FS_COMPRESS_LAST_LITERALS 5     /* The last 5 bytes of a block are always literals */
+#define CFE_FS_COMPRESS_MATCH_LIMIT   12    /* The last match must start at least 12 bytes before the end */
+#define CFE_FS_COMPRESS_MAX_OFFSET    65535 /* Largest distance back to the start of a match */
+#define CFE_FS_COMPRESS_RUN_MASK      15    /* Largest length that fits in the token nibble */
+
+/* Multiplier for the hash of the next 4 input bytes (Knuth's multiplicative hash) */
+#define CFE_FS_COMPRESS_HASH_PRIME 2654435761U
+
+/*
+** Local Function Prototypes
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Outputs the extra bytes of a literal or match length, if needed
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * @param OutPtr Output position
+ * @param Length The length value, less any minimum implied by the format
+ * @returns Updated output position
+ */
+static uint8 *CFE_FS_CompressPutLength(uint8 *OutPtr, size_t Length);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Outputs a single sequence of literals followed by an optional match
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * @param OutPtr   Output position
+ * @param OutEnd   End of the output buffer
+ * @param Literals Literal data to output
+ * @param LitLen   Number of literal bytes
+ * @param Offset   Distance back to the start of the match
+ * @param MatchLen Length of the match, or 0 for the final sequence of the block
+ * @returns Updated output position, or NULL if the output buffer is too small
+ */
+static uint8 *CFE_FS_CompressPutSequence(uint8 *OutPtr, const uint8 *OutEnd, const uint8 *Literals, size_t LitLen,
+                                         size_t Offset, size_t MatchLen);
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_CompressPutLength
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint8 *CFE_FS_CompressPutLength(uint8 *OutPtr, size_t Length)
+{
+    if (Length >= CFE_FS_COMPRESS_RUN_MASK)
+    {
+        Length -= CFE_FS_COMPRESS_RUN_MASK;
+        while (Length >= 255)
+        {
+            *OutPtr = 255;
+            ++OutPtr;
+            Length -= 255;
+        }
+
+        *OutPtr = Length;
+        ++OutPtr;
+    }
+
+    return OutPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_CompressPutSequence
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint8 *CFE_FS_CompressPutSequence(uint8 *OutPtr, const uint8 *OutEnd, const uint8 *Literals, size_t LitLen,
+                                         size_t Offset, size_t MatchLen)
+{
+    uint8 *TokenPtr;
+    size_t MaxSize;
+
+    /* Worst case size: token, literal length bytes, literals, offset, match length bytes */
+    MaxSize = 1 + (LitLen / 255) + 1 + LitLen + 2 + (MatchLen / 255) + 1;
+    if (MaxSize > (size_t)(OutEnd - OutPtr))
+    {
+        return NULL;
+    }
+
+    TokenPtr = OutPtr;
+    ++OutPtr;
+
+    if (LitLen >= CFE_FS_COMPRESS_RUN_MASK)
+    {
+        *TokenPtr = CFE_FS_COMPRESS_RUN_MASK << 4;
+    }
+    else
+    {
+        *TokenPtr = LitLen << 4;
+    }
+
+    OutPtr = CFE_FS_CompressPutLength(OutPtr, LitLen);
+    memcpy(OutPtr, Literals, LitLen);
+    OutPtr += LitLen;
+
+    if (MatchLen > 0)
+    {
+        /* Offset is always little endian in the LZ4 format */
+        OutPtr[0] = Offset & 0xFF;
+        OutPtr[1] = (Offset >> 8) & 0xFF;
+        OutPtr += 2;
+
+        MatchLen -= CFE_FS_COMPRESS_MIN_MATCH;
+        if (MatchLen >= CFE_FS_COMPRESS_RUN_MASK)
+        {
+            *TokenPtr |= CFE_FS_COMPRESS_RUN_MASK;
+        }
+        else
+        {
+            *TokenPtr |= MatchLen;
+        }
+
+        OutPtr = CFE_FS_CompressPutLength(OutPtr, MatchLen);
+    }
+
+    return OutPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_FS_CompressBlock
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_FS_CompressBlock(void *DestPtr, size_t DestSize, const void *SrcPtr, size_t SrcSize)
+{
+    const uint8 *Src;
+    uint8 *      OutPtr;
+    uint8 *      OutEnd;
+    uint16 *     HashTable;
+    size_t       Pos;
+    size_t       Anchor;
+    size_t       Candidate;
+    size_t       MatchLen;
+    size_t       MatchEnd;
+    uint32       Sequence;
+    uint32       Hash;
+
+    /* Positions are stored as uint16 in the hash table, which also limits the match offset */
+    if (SrcSize > CFE_FS_COMPRESS_MAX_OFFSET)
+    {
+        return 0;
+    }
+
+    Src       = SrcPtr;
+    OutPtr    = DestPtr;
+    OutEnd    = OutPtr + DestSize;
+    HashTable = CFE_FS_Global.CompressHashTable;
+    Pos       = 0;
+    Anchor    = 0;
+
+    memset(CFE_FS_Global.CompressHashTable, 0, sizeof(CFE_FS_Global.CompressHashTable));
+
+    while ((Pos + CFE_FS_COMPRESS_MATCH_LIMIT) < SrcSize)
+    {
+        memcpy(&Sequence, &Src[Pos], sizeof(Sequence));
+        Hash = (Sequence * CFE_FS_COMPRESS_HASH_PRIME) >> (32 - CFE_FS_COMPRESS_HASH_BITS);
+
+        Candidate       = HashTable[Hash];
+        HashTable[Hash] = Pos;
+
+        if (Candidate < Pos && memcmp(&Src[Candidate], &Src[Pos], CFE_FS_COMPRESS_MIN_MATCH) == 0)
+        {
+            /* Extend the match as far as possible, but leave the final literals */
+            MatchEnd = SrcSize - CFE_FS_COMPRESS_LAST_LITERALS;
+            MatchLen = CFE_FS_COMPRESS_MIN_MATCH;
+            while ((Pos + MatchLen) < MatchEnd && Src[Candidate + MatchLen] == Src[Pos + MatchLen])
+            {
+                ++MatchLen;
+            }
+
+            OutPtr = CFE_FS_CompressPutSequence(OutPtr, OutEnd, &Src[Anchor], Pos - Anchor, Pos - Candidate, MatchLen);
+            if (OutPtr == NULL)
+            {
+                return 0;
+            }
+
+            Pos += MatchLen;
+            Anchor = Pos;
+        }
+        else
+        {
+            ++Pos;
+        }
+    }
+
+    /* The block always ends with a sequence of literals only */
+    OutPtr = CFE_FS_CompressPutSequence(OutPtr, OutEnd, &Src[Anchor], SrcSize - Anchor, 0, 0);
+    if (OutPtr == NULL)
+    {
+        return 0;
+    }
+
+    return OutPtr - (uint8 *)DestPtr;
+}
@@ -74,6 +74,43 @@
  */
 #define CFE_FS_BACKGROUND_MAX_CREDIT 10000
 
+/*
+ * Upper limit on the adaptive background file credit rate
+ *
+ * The rate above (CFE_FS_BACKGROUND_CREDIT_PER_SECOND) is the minimum.  The
+ * actual rate is adjusted according to the measured throughput of the file
+ * writes, so a fast device is not held to the rate of the slowest one.  The
+ * credit cap scales along with the rate, such that it always represents the
+ * same amount of time as CFE_FS_BACKGROUND_MAX_CREDIT does at the minimum rate.
+ */
+#define CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND 1000000
+
+/*
+ * Share of the measured device throughput used by the background file writer
+ *
+ * The credit rate will converge on this percentage of the measured write
+ * throughput, which leaves the remainder of the device bandwidth available
+ * to other tasks.
+ */
+#define CFE_FS_BACKGROUND_WRITE_DUTY_PERCENT 10
+
+/*
+ * Size of the background file write staging buffer
+ *
+ * Records from the getter are copied into this buffer and written to the
+ * file in a single call once it fills up, rather than one write per record.
+ * Records larger than this are written directly.
+ */
+#define CFE_FS_BACKGROUND_BUFFER_SIZE 4096
+
+/*
+ * Size of the hash table used to find matches when compressing, as a power of two
+ *
+ * Each entry holds a position within the block being compressed, so the table
+ * takes (2 << CFE_FS_COMPRESS_HASH_BITS) bytes.
+ */
+#define CFE_FS_COMPRESS_HASH_BITS 12
+
 /*
 ** Type Definitions
 */
@@ -90,12 +127,26 @@ typedef struct
     CFE_FS_FileWriteMetaData_t *Meta;
 } CFE_FS_BackgroundFileDumpEntry_t;
 
+/*
+ * A block of compressed file data, with its header, as written to the file
+ */
+typedef struct
+{
+    CFE_FS_CompressedBlockHeader_t Hdr;
+    uint8                          Data[CFE_FS_BACKGROUND_BUFFER_SIZE];
+} CFE_FS_CompressedBlock_t;
+
 typedef struct
 {
     osal_id_t Fd;
     int32     Credit;
+    uint32    CreditRate; /* Current credit accumulation rate, bytes per second (0 = minimum) */
     uint32    RecordNum;
     size_t    FileSize;
+    size_t    BufferUsed; /* Number of bytes staged in Buffer but not yet written */
+    uint8     Buffer[CFE_FS_BACKGROUND_BUFFER_SIZE];
+
+    CFE_FS_CompressedBlock_t CompressedBlock; /* Output of the compressor, if enabled for the file */
 } CFE_FS_CurrentFileState_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -140,6 +191,9 @@ typedef struct
 
     CFE_FS_BackgroundFileDumpState_t FileDump;
 
+    /* Scratch memory for CFE_FS_CompressBlock(), only used from the background file writer */
+    uint16 CompressHashTable[1 << CFE_FS_COMPRESS_HASH_BITS];
+
 } CFE_FS_Global_t;
 
 extern CFE_FS_Global_t CFE_FS_Global;
@@ -180,4 +234,84 @@ extern void CFE_FS_ByteSwapCFEHeader(CFE_FS_Header_t *Hdr);
  */
 extern void CFE_FS_ByteSwapUint32(uint32 *Uint32ToSwapPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the background file dump request at the head of the queue
+ *
+ * @returns Pointer to the queue entry, or NULL if no requests are pending
+ */
+extern CFE_FS_BackgroundFileDumpEntry_t *CFE_FS_GetPendingBackgroundFileDump(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Process a single background file dump request
+ *
+ * Opens the file on the first call for the entry, then writes records until the
+ * write credit runs out or the getter indicates EOF.  Once the file is closed,
+ * for any reason, the entry is marked complete and removed from the queue.
+ *
+ * @param Curr The queue entry to process
+ * @returns true if the file reached a normal EOF and is now complete, false otherwise
+ */
+extern bool CFE_FS_ProcessBackgroundFileDump(CFE_FS_BackgroundFileDumpEntry_t *Curr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Write a block of data to the background dump file
+ *
+ * The write is timed and the result is used to adjust the credit rate.  On
+ * error the file is closed and a record write error event is generated.
+ *
+ * @param Meta       The file write request being processed
+ * @param DataPtr    The data to write
+ * @param DataSize   The number of bytes to write
+ * @param SourceSize The number of record bytes the data holds before compression,
+ *                   which is the unit the write credit is charged in
+ * @returns true if all the data was written, false on error
+ */
+extern bool CFE_FS_BackgroundFileWrite(CFE_FS_FileWriteMetaData_t *Meta, const void *DataPtr, size_t DataSize,
+                                       size_t SourceSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Copy data into the background file dump staging buffer
+ *
+ * The buffer is written out each time it fills up, so the data may be split
+ * across more than one buffer.
+ *
+ * @param Meta     The file write request being processed
+ * @param DataPtr  The data to stage
+ * @param DataSize The number of bytes to stage
+ * @returns true if successful, false if writing out the buffer failed
+ */
+extern bool CFE_FS_StageBackgroundFileData(CFE_FS_FileWriteMetaData_t *Meta, const void *DataPtr, size_t DataSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Write out any data in the background file dump staging buffer
+ *
+ * If compression is enabled for the file, the data is compressed and
+ * written as a single block, with a CFE_FS_CompressedBlockHeader_t.
+ *
+ * @param Meta The file write request being processed
+ * @returns true if the buffer was empty or was written successfully, false on error
+ */
+extern bool CFE_FS_FlushBackgroundFileBuffer(CFE_FS_FileWriteMetaData_t *Meta);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Compress a block of data
+ *
+ * The output is in the LZ4 block format.  This uses a shared hash table in
+ * the FS global data and is therefore not reentrant; it must only be called
+ * from the background file writer.
+ *
+ * @param DestPtr  Buffer to hold the compressed data
+ * @param DestSize Size of the output buffer
+ * @param SrcPtr   Data to compress
+ * @param SrcSize  Number of bytes to compress, up to 65535
+ * @returns Size of the compressed data, or 0 if it does not fit in the output buffer
+ */
+extern size_t CFE_FS_CompressBlock(void *DestPtr, size_t DestSize, const void *SrcPtr, size_t SrcSize);
+
 #endif /* CFE_FS_PRIV_H */
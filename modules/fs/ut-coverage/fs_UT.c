@@ -63,6 +63,81 @@ void UT_FS_OnEvent(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint
     UT_DEFAULT_IMPL(UT_FS_OnEvent);
 }
 
+/* advances the PSP time by the given number of microseconds on every call */
+int32 UT_FS_GetTimeHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    OS_time_t *LocalTime = UT_Hook_GetArgValueByName(Context, "LocalTime", OS_time_t *);
+    uint32 *   StepUsec  = UserObj;
+    uint64     TotalUsec = (uint64)CallCount * *StepUsec;
+
+    *LocalTime = OS_TimeAssembleFromNanoseconds(TotalUsec / 1000000, (TotalUsec % 1000000) * 1000);
+
+    return StubRetcode;
+}
+
+/* Minimal LZ4 block decoder, to confirm the output of CFE_FS_CompressBlock() */
+size_t UT_FS_DecompressBlock(uint8 *Dest, size_t DestSize, const uint8 *Src, size_t SrcSize)
+{
+    size_t InPos  = 0;
+    size_t OutPos = 0;
+    size_t Length;
+    size_t Offset;
+    uint8  Token;
+
+    while (InPos < SrcSize)
+    {
+        Token  = Src[InPos++];
+        Length = Token >> 4;
+        if (Length == 15)
+        {
+            do
+            {
+                Length += Src[InPos];
+            } while (Src[InPos++] == 255);
+        }
+
+        if ((OutPos + Length) > DestSize || (InPos + Length) > SrcSize)
+        {
+            return 0;
+        }
+
+        memcpy(&Dest[OutPos], &Src[InPos], Length);
+        InPos += Length;
+        OutPos += Length;
+
+        if (InPos >= SrcSize)
+        {
+            break;
+        }
+
+        Offset = Src[InPos] | (Src[InPos + 1] << 8);
+        InPos += 2;
+        Length = Token & 0x0F;
+        if (Length == 15)
+        {
+            do
+            {
+                Length += Src[InPos];
+            } while (Src[InPos++] == 255);
+        }
+
+        Length += 4;
+        if (Offset == 0 || Offset > OutPos || (OutPos + Length) > DestSize)
+        {
+            return 0;
+        }
+
+        while (Length > 0)
+        {
+            Dest[OutPos] = Dest[OutPos - Offset];
+            ++OutPos;
+            --Length;
+        }
+    }
+
+    return OutPos;
+}
+
 /*
 ** Functions
 */
@@ -85,6 +160,9 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_Private);
 
     UT_ADD_TEST(Test_CFE_FS_BackgroundFileDump);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileBuffering);
+    UT_ADD_TEST(Test_CFE_FS_CompressBlock);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileCompression);
 }
 
 /*
@@ -654,3 +732,271 @@ void Test_CFE_FS_BackgroundFileDump(void)
     UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* avoid infinite loop */
     CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
 }
+
+void Test_CFE_FS_BackgroundFileBuffering(void)
+{
+    /*
+     * Test routine for the staging buffer, adaptive credit rate, and
+     * completion of multiple requests within CFE_FS_RunBackgroundFileDump()
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    CFE_FS_FileWriteMetaData_t State2;
+    uint32                     MyBuffer[2];
+    static uint8               LargeBuffer[CFE_FS_BACKGROUND_BUFFER_SIZE + 8];
+    uint32                     StepUsec;
+
+    UT_InitData();
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+
+    State.GetData = UT_FS_DataGetter;
+    State.OnEvent = UT_FS_OnEvent;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    strncpy(State.Description, "UT", sizeof(State.Description));
+    State2 = State;
+    strncpy(State2.FileName, "/ram/UT2.bin", sizeof(State2.FileName));
+
+    /* Each write appears to take 1ms */
+    StepUsec = 1000;
+    UT_SetHookFunction(UT_KEY(CFE_PSP_GetTime), UT_FS_GetTimeHook, &StepUsec);
+
+    /* Small records should be coalesced - 600 records fit in two buffer writes plus the header */
+    MyBuffer[0] = 10;
+    MyBuffer[1] = 20;
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 600, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_STUB_COUNT(UT_FS_DataGetter, 600);
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.RecordNum, 600);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize, sizeof(CFE_FS_Header_t) + (600 * sizeof(MyBuffer)));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+
+    /* The measured rate of those writes is faster than the minimum */
+    CFE_UtAssert_ATLEAST(CFE_FS_Global.FileDump.Current.CreditRate, CFE_FS_BACKGROUND_CREDIT_PER_SECOND + 1);
+    CFE_UtAssert_ATMOST(CFE_FS_Global.FileDump.Current.CreditRate, CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND);
+
+    /* Records larger than the staging buffer are written directly */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_ResetState(UT_KEY(OS_write));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize, sizeof(CFE_FS_Header_t) + (2 * sizeof(LargeBuffer)));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+
+    /* Error writing a large record directly */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_TRUE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    CFE_UtAssert_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    /* Error writing the final partial buffer at EOF - must not generate the complete event */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_TRUE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+    CFE_UtAssert_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    /* A slow device (1 second per write) brings the rate down to the minimum */
+    StepUsec                                  = 1000000;
+    CFE_FS_Global.FileDump.Current.CreditRate = CFE_FS_BACKGROUND_CREDIT_PER_SECOND;
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.CreditRate, CFE_FS_BACKGROUND_CREDIT_PER_SECOND);
+
+    /* A write too fast to measure leaves the rate unchanged */
+    StepUsec = 0;
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.CreditRate, CFE_FS_BACKGROUND_CREDIT_PER_SECOND);
+
+    /* Credit accumulates at the current rate, and the cap scales with it */
+    CFE_FS_Global.FileDump.Current.CreditRate = CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND;
+    CFE_FS_Global.FileDump.Current.Credit = 0;
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1, NULL));
+    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Current.Credit, CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND / 1000);
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Current.Credit,
+                      (CFE_FS_BACKGROUND_MAX_CREDIT / CFE_FS_BACKGROUND_CREDIT_PER_SECOND) *
+                          CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND);
+
+    /* Multiple requests can be completed in a single cycle */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_ResetState(UT_KEY(OS_OpenCreate));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDefaultReturnValue(UT_KEY(UT_FS_DataGetter), true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State2));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 6);
+    CFE_UtAssert_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+    CFE_UtAssert_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State2));
+
+    /* Running out of credit after the first file leaves the second for the next cycle */
+    CFE_FS_Global.FileDump.Current.CreditRate = 0;
+    CFE_FS_Global.FileDump.Current.Credit     = (int32)(sizeof(CFE_FS_Header_t) + sizeof(MyBuffer)) - 1000;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State2));
+    CFE_UtAssert_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    CFE_UtAssert_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+    CFE_UtAssert_TRUE(CFE_FS_BackgroundFileDumpIsPending(&State2));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    CFE_UtAssert_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State2));
+}
+
+void Test_CFE_FS_CompressBlock(void)
+{
+    /*
+     * Test routine for:
+     * size_t CFE_FS_CompressBlock(void *DestPtr, size_t DestSize, const void *SrcPtr, size_t SrcSize)
+     */
+    static uint8 Input[CFE_FS_BACKGROUND_BUFFER_SIZE];
+    static uint8 Output[CFE_FS_BACKGROUND_BUFFER_SIZE * 2];
+    static uint8 Decoded[CFE_FS_BACKGROUND_BUFFER_SIZE];
+    uint32       Seed;
+    size_t       i;
+    size_t       CompressedSize;
+
+    UtPrintf("Begin Test Compress Block");
+
+    /*
+     * Build a block with a long run (length extension bytes for the match),
+     * a long stretch of pseudo-random data (length extension bytes for the literals),
+     * and repeated text.
+     */
+    memset(Input, 0, 1000);
+    Seed = 1;
+    for (i = 1000; i < 1600; ++i)
+    {
+        Seed     = (Seed * 1103515245) + 12345;
+        Input[i] = (Seed >> 16) & 0xFF;
+    }
+    for (i = 1600; i < sizeof(Input); ++i)
+    {
+        Input[i] = "cFE background file "[i % 20];
+    }
+
+    CompressedSize = CFE_FS_CompressBlock(Output, sizeof(Output), Input, sizeof(Input));
+    CFE_UtAssert_ATLEAST(CompressedSize, 1);
+    CFE_UtAssert_ATMOST(CompressedSize, sizeof(Input) / 2);
+    UtAssert_UINT32_EQ(UT_FS_DecompressBlock(Decoded, sizeof(Decoded), Output, CompressedSize), sizeof(Input));
+    UtAssert_MemCmp(Decoded, Input, sizeof(Input), "Decompressed data matches");
+
+    /* Pseudo-random data alone does not compress, and does not fit in a buffer of the same size */
+    UtAssert_ZERO(CFE_FS_CompressBlock(Output, 600, &Input[1000], 600));
+    CompressedSize = CFE_FS_CompressBlock(Output, sizeof(Output), &Input[1000], 600);
+    UtAssert_UINT32_EQ(UT_FS_DecompressBlock(Decoded, sizeof(Decoded), Output, CompressedSize), 600);
+    UtAssert_MemCmp(Decoded, &Input[1000], 600, "Decompressed data matches");
+
+    /* Output buffer runs out part way through */
+    UtAssert_ZERO(CFE_FS_CompressBlock(Output, 8, Input, sizeof(Input)));
+
+    /* Small blocks are all literals */
+    CompressedSize = CFE_FS_CompressBlock(Output, sizeof(Output), Input, 12);
+    UtAssert_UINT32_EQ(CompressedSize, 13);
+    UtAssert_UINT32_EQ(UT_FS_DecompressBlock(Decoded, sizeof(Decoded), Output, CompressedSize), 12);
+
+    /* Input larger than the format allows for a single block */
+    UtAssert_ZERO(CFE_FS_CompressBlock(Output, sizeof(Output), Input, 65536));
+
+    UtPrintf("End Test Compress Block\n");
+}
+
+void Test_CFE_FS_BackgroundFileCompression(void)
+{
+    /*
+     * Test routine for the optional compression of background file writes
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    uint32                     MyBuffer[2];
+    static uint8               LargeBuffer[CFE_FS_BACKGROUND_BUFFER_SIZE + 8];
+    uint32                     StepUsec;
+
+    UT_InitData();
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+
+    State.GetData  = UT_FS_DataGetter;
+    State.OnEvent  = UT_FS_OnEvent;
+    State.Compress = true;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    strncpy(State.Description, "UT", sizeof(State.Description));
+
+    /* Repetitive records compress well - one block per staging buffer */
+    MyBuffer[0] = 10;
+    MyBuffer[1] = 20;
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 600, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_STUB_COUNT(OS_write, 3);
+    CFE_UtAssert_ATMOST(CFE_FS_Global.FileDump.Current.FileSize,
+                        sizeof(CFE_FS_Header_t) + ((600 * sizeof(MyBuffer)) / 10));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+
+    /* A single short record does not compress, and is stored as-is */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize,
+                       sizeof(CFE_FS_Header_t) + sizeof(CFE_FS_CompressedBlockHeader_t) + sizeof(MyBuffer));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+
+    /* Records larger than the staging buffer are split across blocks rather than written directly */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_ResetState(UT_KEY(OS_write));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_STUB_COUNT(OS_write, 3);
+    CFE_UtAssert_ATMOST(CFE_FS_Global.FileDump.Current.FileSize, sizeof(CFE_FS_Header_t) + 200);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 3);
+
+    /* Error writing a block part way through a large record */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_TRUE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 3);
+    CFE_UtAssert_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    /*
+     * The rate is measured on the uncompressed size, as that is what the credit is charged on.
+     * At 10ms per write only the uncompressed size of a full block is above the minimum rate.
+     */
+    StepUsec = 10000;
+    UT_SetHookFunction(UT_KEY(CFE_PSP_GetTime), UT_FS_GetTimeHook, &StepUsec);
+    CFE_FS_Global.FileDump.Current.CreditRate = CFE_FS_BACKGROUND_CREDIT_PER_SECOND;
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_UtAssert_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    CFE_UtAssert_ATMOST(CFE_FS_Global.FileDump.Current.FileSize, sizeof(CFE_FS_Header_t) + 200);
+    CFE_UtAssert_ATLEAST(CFE_FS_Global.FileDump.Current.CreditRate, CFE_FS_BACKGROUND_CREDIT_PER_SECOND + 1);
+}
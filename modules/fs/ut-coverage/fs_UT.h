@@ -314,4 +314,43 @@ void Test_CFE_FS_GetUncompressedFile(void);
 ******************************************************************************/
 void Test_CFE_FS_BackgroundFileDump(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for FS background file dump buffering and rate adjustment
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileBuffering(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for FS block compression (cfe_fs_compress.c)
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_CompressBlock(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for FS background file dump compression
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileCompression(void);
+
 #endif /* FS_UT_H */
@@ -677,6 +677,10 @@ typedef struct CFE_SB_StatsTlm_Payload
                                     \brief Number of SB message buffers currently in use */
     uint32 PeakSBBuffersInUse; /**< \cfetlmmnemonic \SB_SMPSBBIU
                                     \brief Max number of SB message buffers in use */
+    uint32 BufferCacheHits;    /**< \cfetlmmnemonic \SB_SMBCHITS
+                                    \brief Number of SB message buffers reused from the buffer caches */
+    uint32 BufferCacheMisses;  /**< \cfetlmmnemonic \SB_SMBCMISS
+                                    \brief Number of SB message buffers allocated from the memory pool */
 
     uint32 MaxPipeDepthAllowed; /**< \cfetlmmnemonic \SB_SMMPDALW
                                      \brief Maximum allowed pipe depth */
@@ -713,8 +717,9 @@ typedef struct CFE_SB_RoutingFileEntry
 */
 typedef struct CFE_SB_MsgMapFileEntry
 {
-    CFE_SB_MsgId_t        MsgId; /**< \brief Message Id which has been subscribed to */
-    CFE_SB_RouteId_Atom_t Index; /**< \brief Routing raw index value (0 based, not Route ID) */
+    CFE_SB_MsgId_t        MsgId;       /**< \brief Message Id which has been subscribed to */
+    CFE_SB_RouteId_Atom_t Index;       /**< \brief Routing raw index value (0 based, not Route ID) */
+    uint16                ProbeLength; /**< \brief Map slots probed past the hashed slot to find MsgId */
 } CFE_SB_MsgMapFileEntry_t;
 
 /**
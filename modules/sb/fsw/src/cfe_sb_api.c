@@ -396,6 +396,10 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
         SysQueueId = PipeDscPtr->SysQueueId;
         BufDscPtr  = PipeDscPtr->LastBuffer;
 
+        /* The buffers from a batch receive can be released now, as this is already locked */
+        PipeDscPtr->LastBuffer = NULL;
+        CFE_SB_PipeReleaseBuffers_Unsync(PipeDscPtr);
+
         /*
          * Mark entry as "reserved" so other resources can be deleted
          * while the SB global is unlocked.  This prevents other tasks
@@ -410,6 +414,13 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     /* remove any messages that might be on the pipe */
     if (Status == CFE_SUCCESS)
     {
+        /*
+         * A transmit that found this pipe on a route before it was removed may
+         * still be writing to its queue, without the SB lock.  Wait for those
+         * writes to finish, so nothing is written to the queue after it is drained.
+         */
+        CFE_SB_RouteLockBarrier();
+
         while (true)
         {
             /* decrement refcount of any previous buffer */
@@ -902,17 +913,18 @@ CFE_Status_t CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
 int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim,
                            uint8 Scope)
 {
-    CFE_SBR_RouteId_t      RouteId;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    int32                  Status;
-    CFE_ES_TaskId_t        TskId;
-    CFE_ES_AppId_t         AppId;
-    CFE_SB_DestinationD_t *DestPtr;
-    uint32                 DestCount;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
-    uint32                 Collisions;
-    uint16                 PendingEventID;
+    CFE_SBR_RouteId_t         RouteId;
+    CFE_SB_PipeD_t *          PipeDscPtr;
+    int32                     Status;
+    CFE_ES_TaskId_t           TskId;
+    CFE_ES_AppId_t            AppId;
+    CFE_SB_DestinationD_t *   DestPtr;
+    CFE_SB_DestinationD_t     NewDest;
+    CFE_SB_DestinationList_t *DestList;
+    char                      FullName[(OS_MAX_API_NAME * 2)];
+    char                      PipeName[OS_MAX_API_NAME];
+    uint32                    Collisions;
+    uint16                    PendingEventID;
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
@@ -978,51 +990,39 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
     /* If successful up to this point, check if new dest should be added to this route */
     if (Status == CFE_SUCCESS)
     {
-        DestCount = 0;
-        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
-        {
-            ++DestCount;
-
-            /* Check if duplicate (status stays as CFE_SUCCESS) */
-            if (CFE_RESOURCEID_TEST_EQUAL(DestPtr->PipeId, PipeId))
-            {
-                PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
-                break;
-            }
+        DestList = CFE_SBR_GetDestList(RouteId);
+        DestPtr  = CFE_SB_GetDestPtr(RouteId, PipeId);
 
-            /* Check if limit reached */
-            if (DestCount >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
-            {
-                PendingEventID = CFE_SB_MAX_DESTS_MET_EID;
-                Status         = CFE_SB_MAX_DESTS_MET;
-                break;
-            }
+        /* Check if duplicate (status stays as CFE_SUCCESS) */
+        if (DestPtr != NULL)
+        {
+            PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+        }
+        /* Check if limit reached */
+        else if (DestList != NULL && DestList->Count >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+        {
+            PendingEventID = CFE_SB_MAX_DESTS_MET_EID;
+            Status         = CFE_SB_MAX_DESTS_MET;
         }
-
         /* If no existing dest found, add one now */
-        if (DestPtr == NULL)
+        else
         {
-            DestPtr = CFE_SB_GetDestinationBlk();
-            if (DestPtr == NULL)
+            /* initialize destination, which is copied into the list of the route */
+            memset(&NewDest, 0, sizeof(NewDest));
+            NewDest.PipeId        = PipeId;
+            NewDest.PipeIdx       = PipeDscPtr - CFE_SB_Global.PipeTbl;
+            NewDest.MsgId2PipeLim = MsgLim;
+            NewDest.Active        = CFE_SB_ACTIVE;
+            NewDest.Scope         = Scope;
+
+            /* add destination node */
+            Status = CFE_SB_AddDestNode(RouteId, &NewDest);
+            if (Status != CFE_SUCCESS)
             {
                 PendingEventID = CFE_SB_DEST_BLK_ERR_EID;
-                Status         = CFE_SB_BUF_ALOC_ERR;
             }
             else
             {
-                /* initialize destination block */
-                DestPtr->PipeId        = PipeId;
-                DestPtr->MsgId2PipeLim = MsgLim;
-                DestPtr->Active        = CFE_SB_ACTIVE;
-                DestPtr->BuffCount     = 0;
-                DestPtr->DestCnt       = 0;
-                DestPtr->Scope         = Scope;
-                DestPtr->Prev          = NULL;
-                DestPtr->Next          = NULL;
-
-                /* add destination node */
-                CFE_SB_AddDestNode(RouteId, DestPtr);
-
                 CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse++;
                 if (CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse >
                     CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse)
@@ -1325,33 +1325,42 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount)
 {
-    int32             Status;
-    CFE_MSG_Size_t    Size  = 0;
-    CFE_SB_MsgId_t    MsgId = CFE_SB_INVALID_MSG_ID;
-    CFE_ES_TaskId_t   TskId;
-    char              FullName[(OS_MAX_API_NAME * 2)];
-    CFE_SB_BufferD_t *BufDscPtr;
-    CFE_SBR_RouteId_t RouteId;
-    uint16            PendingEventID;
+    int32                 Status;
+    CFE_MSG_Size_t        Size  = 0;
+    CFE_SB_MsgId_t        MsgId = CFE_SB_INVALID_MSG_ID;
+    CFE_ES_AppId_t        AppId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
+    uint16                PendingEventID;
+
+    PendingEventID          = 0;
+    AppId                   = CFE_ES_APPID_UNDEFINED;
+    SBSndErr.EvtsToSnd      = 0;
+    Delivery.Count          = 0;
+    Delivery.RouteLocksHeld = 0;
+
+    /* Message header checks do not involve any SB shared data, so they are done before locking */
+    Status = CFE_SB_TransmitMsgValidate(MsgPtr, &MsgId, &Size);
 
-    PendingEventID = 0;
-    BufDscPtr      = NULL;
-    RouteId        = CFE_SBR_INVALID_ROUTE_ID;
+    if (Status == CFE_SUCCESS)
+    {
+        /* get app id for loopback testing (this must not be done while holding the SB lock) */
+        CFE_ES_GetAppID(&AppId);
 
-    Status = CFE_SB_TransmitMsgValidate(MsgPtr, &MsgId, &Size, &RouteId);
+        /* The route lock is taken before the SB lock, see CFE_SB_LockRoutes() */
+        CFE_SB_LockRoutes(&Delivery, CFE_SB_RouteLockMask(MsgId));
+    }
 
+    /*
+     * The route lookup, buffer allocation and broadcast are all done within
+     * a single critical section, so the SB lock is only taken once per message.
+     */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
-    if (Status == CFE_SUCCESS && CFE_SBR_IsValidRouteId(RouteId))
+    if (Status == CFE_SUCCESS)
     {
-        /* Get buffer - note this pre-initializes the returned buffer with
-         * a use count of 1, which refers to this task as it fills the buffer. */
-        BufDscPtr = CFE_SB_GetBufferFromPool(Size);
-        if (BufDscPtr == NULL)
-        {
-            PendingEventID = CFE_SB_GET_BUF_ERR_EID;
-            Status         = CFE_SB_BUF_ALOC_ERR;
-        }
+        Status = CFE_SB_TransmitMsgCopy_Unsync(MsgPtr, MsgId, Size, IncrementSequenceCount, AppId, &SBSndErr,
+                                               &Delivery, &PendingEventID);
     }
 
     /*
@@ -1367,61 +1376,208 @@ CFE_Status_t CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenc
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
-    /*
-     * If a buffer was obtained above, then copy the content into it
-     * and broadcast it to all subscribers in the route.
-     *
-     * Note - if there is no route / no subscribers, the "Status" will
-     * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
-     * but there will be no buffer because CFE_SBR_IsValidRouteId() returned
-     * false.
-     *
-     * But if the desciptor is non-null it means the message is valid and
-     * there is a route to send it to.
-     */
-    if (BufDscPtr != NULL)
-    {
-        /* Copy actual message content into buffer and set its metadata */
-        memcpy(&BufDscPtr->Content, MsgPtr, Size);
-        BufDscPtr->MsgId        = MsgId;
-        BufDscPtr->ContentSize  = Size;
-        BufDscPtr->AutoSequence = IncrementSequenceCount;
-        CFE_MSG_GetType(MsgPtr, &BufDscPtr->ContentType);
+    /* Write to the pipe queues, after unlocking */
+    CFE_SB_DeliveryComplete(&Delivery, &SBSndErr);
 
-        /*
-         * This routine will use best-effort to send to all subscribers,
-         * increment the buffer use count for every successful delivery,
-         * and send an event/increment counter for any unsucessful delivery.
-         */
-        CFE_SB_BroadcastBufferToRoute(BufDscPtr, RouteId);
+    /* Now actually send the events, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        CFE_SB_TransmitMsgReportEvent(PendingEventID, MsgId, Size);
+    }
 
-        /*
-         * The broadcast function consumes the buffer, so it should not be
-         * accessed in this function anymore
-         */
-        BufDscPtr = NULL;
+    if (SBSndErr.EvtsToSnd > 0)
+    {
+        CFE_SB_BroadcastReportErrors(&SBSndErr);
     }
 
-    if (PendingEventID == CFE_SB_GET_BUF_ERR_EID)
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitMsgBatch
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitMsgBatch(CFE_MSG_Message_t *MsgPtrs[], uint32 Count, bool IncrementSequenceCount)
+{
+    int32                 Status;
+    int32                 MsgStatus;
+    uint32                i;
+    CFE_MSG_Size_t        Size;
+    CFE_SB_MsgId_t        MsgId;
+    CFE_MSG_Size_t        EventSize;
+    CFE_SB_MsgId_t        EventMsgId;
+    CFE_ES_AppId_t        AppId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
+    uint16                MsgEventID;
+    uint16                PendingEventID;
+    uint32                LockMask;
+    CFE_ES_TaskId_t       TskId;
+    char                  FullName[(OS_MAX_API_NAME * 2)];
+
+    PendingEventID          = 0;
+    LockMask                = 0;
+    EventSize               = 0;
+    EventMsgId              = CFE_SB_INVALID_MSG_ID;
+    SBSndErr.EvtsToSnd      = 0;
+    Delivery.Count          = 0;
+    Delivery.RouteLocksHeld = 0;
+    Status                  = CFE_SUCCESS;
+
+    if (MsgPtrs == NULL || Count == 0 || Count > CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH)
     {
-        /* Get task id for events and Sender Info*/
         CFE_ES_GetTaskID(&TskId);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                   "Send Err:Bad input argument,Arg 0x%lx,Count %lu,App %s", (unsigned long)MsgPtrs,
+                                   (unsigned long)Count, CFE_SB_GetAppTskName(TskId, FullName));
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+
+    /*
+     * Validate the entire batch before sending any of it, so a
+     * validation failure does not leave the batch partially sent.
+     */
+    for (i = 0; Status == CFE_SUCCESS && i < Count; ++i)
+    {
+        Status = CFE_SB_TransmitMsgValidate(MsgPtrs[i], &MsgId, &Size);
+        if (Status == CFE_SUCCESS)
+        {
+            LockMask |= CFE_SB_RouteLockMask(MsgId);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* get app id for loopback testing (this must not be done while holding the SB lock) */
+        CFE_ES_GetAppID(&AppId);
+
+        /* The route locks of the whole batch are taken before the SB lock, see CFE_SB_LockRoutes() */
+        CFE_SB_LockRoutes(&Delivery, LockMask);
+
+        CFE_SB_LockSharedData(__func__, __LINE__);
 
-        if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)
+        for (i = 0; i < Count; ++i)
         {
-            CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                       "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
-                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), CFE_SB_GetAppTskName(TskId, FullName),
-                                       (int)Size);
+            /* The header was already validated above, so this just re-reads the fields */
+            CFE_MSG_GetMsgId(MsgPtrs[i], &MsgId);
+            CFE_MSG_GetSize(MsgPtrs[i], &Size);
+
+            MsgEventID = 0;
+            MsgStatus  = CFE_SB_TransmitMsgCopy_Unsync(MsgPtrs[i], MsgId, Size, IncrementSequenceCount, AppId,
+                                                      &SBSndErr, &Delivery, &MsgEventID);
+
+            if (MsgStatus != CFE_SUCCESS)
+            {
+                CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+
+                /* keep going with the rest of the batch, but report the first error */
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = MsgStatus;
+                }
+            }
 
-            /* clear the bit so the task may send this event again */
-            CFE_SB_FinishSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT);
+            /* Only the first such event in the batch is reported, the counters reflect all of them */
+            if (MsgEventID != 0 && PendingEventID == 0)
+            {
+                PendingEventID = MsgEventID;
+                EventMsgId     = MsgId;
+                EventSize      = Size;
+            }
         }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+        /* Write to the pipe queues, after unlocking */
+        CFE_SB_DeliveryComplete(&Delivery, &SBSndErr);
+    }
+    else
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /* Now actually send the events, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        CFE_SB_TransmitMsgReportEvent(PendingEventID, EventMsgId, EventSize);
+    }
+
+    if (SBSndErr.EvtsToSnd > 0)
+    {
+        CFE_SB_BroadcastReportErrors(&SBSndErr);
     }
 
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitMsgCopy_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_TransmitMsgCopy_Unsync(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size,
+                                    bool IncrementSequenceCount, CFE_ES_AppId_t AppId, CFE_SB_EventBuf_t *SBSndErr,
+                                    CFE_SB_DeliveryList_t *Delivery, uint16 *PendingEventIdPtr)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_SBR_RouteId_t RouteId;
+
+    RouteId = CFE_SB_TransmitMsgGetRoute_Unsync(MsgId);
+
+    /*
+     * Note - if there is no route / no subscribers, this is not an error,
+     * the message is just dropped after counting it.
+     */
+    if (!CFE_SBR_IsValidRouteId(RouteId))
+    {
+        *PendingEventIdPtr = CFE_SB_SEND_NO_SUBS_EID;
+        return CFE_SUCCESS;
+    }
+
+    /* Get buffer - note this pre-initializes the returned buffer with
+     * a use count of 1, which refers to this task as it fills the buffer. */
+    BufDscPtr = CFE_SB_GetBufferFromPool(Size);
+    if (BufDscPtr == NULL)
+    {
+        *PendingEventIdPtr = CFE_SB_GET_BUF_ERR_EID;
+        return CFE_SB_BUF_ALOC_ERR;
+    }
+
+    /*
+     * Copy actual message content into buffer and set its metadata.
+     *
+     * This copy is done while locked, which is cheaper than releasing and
+     * re-acquiring the lock around it for typical message sizes.  Apps sending
+     * very large messages should use CFE_SB_TransmitBuffer() to avoid the copy.
+     */
+    memcpy(&BufDscPtr->Content, MsgPtr, Size);
+    BufDscPtr->MsgId        = MsgId;
+    BufDscPtr->ContentSize  = Size;
+    BufDscPtr->AutoSequence = IncrementSequenceCount;
+    CFE_MSG_GetType(MsgPtr, &BufDscPtr->ContentType);
+
+    /*
+     * This routine will use best-effort to send to all subscribers,
+     * increment the buffer use count for every successful delivery,
+     * and record an event/increment counter for any unsucessful delivery.
+     *
+     * The broadcast function consumes the buffer, so it should not be
+     * accessed in this function anymore
+     */
+    CFE_SB_BroadcastBufferToRoute_Unsync(BufDscPtr, RouteId, AppId, SBSndErr, Delivery);
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_TransmitMsgValidate
@@ -1430,8 +1586,7 @@ CFE_Status_t CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenc
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr,
-                                 CFE_SBR_RouteId_t *RouteIdPtr)
+int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr)
 {
     CFE_ES_TaskId_t TskId;
     char            FullName[(OS_MAX_API_NAME * 2)];
@@ -1472,25 +1627,6 @@ int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgI
         } /* end if */
     }
 
-    if (Status == CFE_SUCCESS)
-    {
-        /* check the route, which should be done while locked */
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
-        /* Get the routing id */
-        *RouteIdPtr = CFE_SBR_GetRouteId(*MsgIdPtr);
-
-        /* if there have been no subscriptions for this pkt, */
-        /* increment the dropped pkt cnt, send event and return success */
-        if (!CFE_SBR_IsValidRouteId(*RouteIdPtr))
-        {
-            CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
-            PendingEventID = CFE_SB_SEND_NO_SUBS_EID;
-        }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
-    }
-
     if (PendingEventID != 0)
     {
         /* get task id for events */
@@ -1518,20 +1654,6 @@ int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgI
                                            CFE_SB_GetAppTskName(TskId, FullName), (int)*SizePtr,
                                            CFE_MISSION_SB_MAX_SB_MSG_SIZE);
                 break;
-
-            case CFE_SB_SEND_NO_SUBS_EID:
-                /* Determine if event can be sent without causing recursive event problem */
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID, CFE_EVS_EventType_INFORMATION,
-                                               CFE_SB_Global.AppId, "No subscribers for MsgId 0x%x,sender %s",
-                                               (unsigned int)CFE_SB_MsgIdToValue(*MsgIdPtr),
-                                               CFE_SB_GetAppTskName(TskId, FullName));
-
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT);
-                } /* end if */
-                break;
         }
 
     } /* end if */
@@ -1541,38 +1663,106 @@ int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgI
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_SB_BroadcastBufferToRoute
+ * Function: CFE_SB_TransmitMsgGetRoute_Unsync
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId)
+CFE_SBR_RouteId_t CFE_SB_TransmitMsgGetRoute_Unsync(CFE_SB_MsgId_t MsgId)
 {
-    CFE_ES_AppId_t         AppId;
-    CFE_ES_TaskId_t        TskId;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_EventBuf_t      SBSndErr;
-    int32                  Status;
-    uint32                 i;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
+    CFE_SBR_RouteId_t RouteId;
 
-    SBSndErr.EvtsToSnd = 0;
+    /* Get the routing id */
+    RouteId = CFE_SBR_GetRouteId(MsgId);
 
-    /* get app id for loopback testing */
-    CFE_ES_GetAppID(&AppId);
+    /* if there have been no subscriptions for this pkt, increment the dropped pkt cnt */
+    if (!CFE_SBR_IsValidRouteId(RouteId))
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
+    }
 
-    /* get task id for events and Sender Info*/
+    return RouteId;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitMsgReportEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitMsgReportEvent(uint16 EventId, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    CFE_ES_TaskId_t TskId;
+    char            FullName[(OS_MAX_API_NAME * 2)];
+
+    /* get task id for events */
     CFE_ES_GetTaskID(&TskId);
 
-    /* take semaphore to prevent a task switch during processing */
-    CFE_SB_LockSharedData(__func__, __LINE__);
+    switch (EventId)
+    {
+        case CFE_SB_SEND_NO_SUBS_EID:
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID, CFE_EVS_EventType_INFORMATION, CFE_SB_Global.AppId,
+                                           "No subscribers for MsgId 0x%x,sender %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT);
+            } /* end if */
+            break;
+
+        case CFE_SB_GET_BUF_ERR_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (int)Size);
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT);
+            }
+            break;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BroadcastBufferToRoute_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BroadcastBufferToRoute_Unsync(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId,
+                                          CFE_ES_AppId_t AppId, CFE_SB_EventBuf_t *SBSndErr,
+                                          CFE_SB_DeliveryList_t *Delivery)
+{
+    CFE_SB_DestinationList_t *DestList;
+    CFE_SB_DestinationD_t *   DestPtr;
+    CFE_SB_PipeD_t *          PipeDscPtr;
+    CFE_SB_DeliveryEntry_t *  EntryPtr;
+    bool                      SendError;
+    uint16                    DestCount;
+    uint16                    DestIdx;
+
+    SendError = false;
 
     /* For an invalid route / no subsribers this whole logic can be skipped */
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
+        /*
+         * The caller holds the route lock, taken before the SB lock.  Another
+         * send on this route will not get its sequence count until this one
+         * has been written to all pipes, so the messages stay in order.
+         */
+
         /* Set the seq count if requested (while locked) before actually sending */
         /* For some reason this is only done for TLM types (historical, TBD) */
         if (BufDscPtr->AutoSequence && BufDscPtr->ContentType == CFE_MSG_Type_Tlm)
@@ -1583,12 +1773,16 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(RouteId));
         }
 
-        /* Send the packet to all destinations  */
-        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
+        /* Send the packet to all destinations, which are contiguous in the list of the route */
+        DestList  = CFE_SBR_GetDestList(RouteId);
+        DestCount = (DestList != NULL) ? DestList->Count : 0;
+        for (DestIdx = 0; DestIdx < DestCount; ++DestIdx)
         {
+            DestPtr = &DestList->Dest[DestIdx];
             if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
             {
-                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+                /* the pipe index is kept with the destination, avoiding a lookup by ID */
+                PipeDscPtr = &CFE_SB_Global.PipeTbl[DestPtr->PipeIdx];
             }
             else
             {
@@ -1610,52 +1804,50 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             /* and go to next destination */
             if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
-                SBSndErr.EvtsToSnd++;
+                CFE_SB_BroadcastRecordError(SBSndErr, BufDscPtr->MsgId, DestPtr->PipeId, CFE_SB_MSGID_LIM_ERR_EID, 0);
                 CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter++;
                 PipeDscPtr->SendErrors++;
+                SendError = true;
 
                 continue;
             } /* end if */
 
             /*
-            ** Write the buffer descriptor to the queue of the pipe.  If the write
-            ** failed, log info and increment the pipe's error counter.
-            */
-            Status = OS_QueuePut(PipeDscPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
-
-            if (Status == OS_SUCCESS)
+             * The list is only full when several messages are sent under one lock.
+             * Write the earlier messages now, still locked, then carry on.  The
+             * revert counts its own send errors, so they are not counted below.
+             */
+            if (Delivery->Count >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
             {
-                /* The queue now holds a ref to the buffer, so increment its ref count. */
-                CFE_SB_IncrBufUseCnt(BufDscPtr);
-
-                DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
-                DestPtr->DestCnt++;   /* used for statistics */
-                ++PipeDscPtr->CurrentQueueDepth;
-                if (PipeDscPtr->CurrentQueueDepth >= PipeDscPtr->PeakQueueDepth)
-                {
-                    PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
-                }
+                CFE_SB_DeliveryWrite(Delivery);
+                CFE_SB_DeliveryRevert_Unsync(Delivery, SBSndErr);
             }
-            else if (Status == OS_QUEUE_FULL)
+
+            /*
+            ** Account for the write of the buffer descriptor to the queue of the pipe
+            ** now, as the pipe may read it as soon as it is written.  The write itself
+            ** is done after the SB lock is released, and undone if it fails.
+            */
+            EntryPtr                     = &Delivery->Entry[Delivery->Count];
+            EntryPtr->BufDscPtr          = BufDscPtr;
+            EntryPtr->PipeDscPtr         = PipeDscPtr;
+            EntryPtr->RouteId            = RouteId;
+            EntryPtr->PipeId             = DestPtr->PipeId;
+            EntryPtr->SysQueueId         = PipeDscPtr->SysQueueId;
+            EntryPtr->Status             = OS_SUCCESS;
+            EntryPtr->PrevPeakQueueDepth = PipeDscPtr->PeakQueueDepth;
+            ++Delivery->Count;
+
+            /* The queue will hold a ref to the buffer, so increment its ref count. */
+            CFE_SB_IncrBufUseCnt(BufDscPtr);
+
+            DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
+            DestPtr->DestCnt++;   /* used for statistics */
+            ++PipeDscPtr->CurrentQueueDepth;
+            if (PipeDscPtr->CurrentQueueDepth >= PipeDscPtr->PeakQueueDepth)
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
-                PipeDscPtr->SendErrors++;
+                PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
             }
-            else
-            {
-                /* Unexpected error while writing to queue. */
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_WR_ERR_EID;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].ErrStat = Status;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
-                PipeDscPtr->SendErrors++;
-            } /*end if */
 
         } /* end loop over destinations */
     }
@@ -1664,7 +1856,7 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
      * If any specific delivery issues occured, also increment the
      * general error count before releasing the lock.
      */
-    if (SBSndErr.EvtsToSnd > 0)
+    if (SendError)
     {
         CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
     }
@@ -1692,49 +1884,243 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
     ** been disabled via ground command.
     */
     CFE_SB_DecrBufUseCnt(BufDscPtr);
+}
 
-    /* release the semaphore */
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_DeliveryWrite
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_DeliveryWrite(CFE_SB_DeliveryList_t *Delivery)
+{
+    CFE_SB_DeliveryEntry_t *EntryPtr;
+    uint32                  i;
+    uint32                  FailCount;
 
-    /* send an event for each pipe write error that may have occurred */
-    for (i = 0; i < SBSndErr.EvtsToSnd; i++)
+    FailCount = 0;
+
+    for (i = 0; i < Delivery->Count; ++i)
     {
-        if (SBSndErr.EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
-        {
+        EntryPtr = &Delivery->Entry[i];
 
-            /* Determine if event can be sent without causing recursive event problem */
-            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED)
-            {
+        /*
+        ** Write the buffer descriptor to the queue of the pipe.  The pipe cannot be
+        ** deleted while this is in progress, see CFE_SB_RouteLockBarrier().
+        */
+        EntryPtr->Status = OS_QueuePut(EntryPtr->SysQueueId, &EntryPtr->BufDscPtr, sizeof(EntryPtr->BufDscPtr), 0);
+        if (EntryPtr->Status != OS_SUCCESS)
+        {
+            ++FailCount;
+        }
+    }
 
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+    /* Only the failed entries need to be kept */
+    if (FailCount == 0)
+    {
+        Delivery->Count = 0;
+    }
 
-                CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
-                CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+    return FailCount;
+}
 
-                CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_DeliveryRevert_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DeliveryRevert_Unsync(CFE_SB_DeliveryList_t *Delivery, CFE_SB_EventBuf_t *SBSndErr)
+{
+    CFE_SB_DeliveryEntry_t *EntryPtr;
+    CFE_SB_DestinationD_t * DestPtr;
+    CFE_SB_PipeD_t *        PipeDscPtr;
+    CFE_SB_BufferD_t *      PrevBufDscPtr;
+    uint32                  i;
+
+    PrevBufDscPtr = NULL;
+
+    for (i = 0; i < Delivery->Count; ++i)
+    {
+        EntryPtr = &Delivery->Entry[i];
+
+        if (EntryPtr->Status == OS_SUCCESS)
+        {
+            continue;
+        }
+
+        /* The destination may have been unsubscribed while the SB lock was released */
+        DestPtr = CFE_SB_GetDestPtr(EntryPtr->RouteId, EntryPtr->PipeId);
+        if (DestPtr != NULL)
+        {
+            if (DestPtr->BuffCount > 0)
+            {
+                DestPtr->BuffCount--;
+            }
+            if (DestPtr->DestCnt > 0)
+            {
+                DestPtr->DestCnt--;
+            }
+        }
+
+        /* Likewise the pipe may have been deleted, and its descriptor reused */
+        PipeDscPtr = EntryPtr->PipeDscPtr;
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, EntryPtr->PipeId))
+        {
+            if (PipeDscPtr->CurrentQueueDepth > 0)
+            {
+                --PipeDscPtr->CurrentQueueDepth;
+
+                /* Do not leave a peak that was only reached by this failed write */
+                if (PipeDscPtr->PeakQueueDepth > PipeDscPtr->CurrentQueueDepth &&
+                    PipeDscPtr->PeakQueueDepth > EntryPtr->PrevPeakQueueDepth)
+                {
+                    PipeDscPtr->PeakQueueDepth = (PipeDscPtr->CurrentQueueDepth > EntryPtr->PrevPeakQueueDepth)
+                                                     ? PipeDscPtr->CurrentQueueDepth
+                                                     : EntryPtr->PrevPeakQueueDepth;
+                }
+            }
+            PipeDscPtr->SendErrors++;
+        }
+
+        if (EntryPtr->Status == OS_QUEUE_FULL)
+        {
+            CFE_SB_BroadcastRecordError(SBSndErr, EntryPtr->BufDscPtr->MsgId, EntryPtr->PipeId,
+                                        CFE_SB_Q_FULL_ERR_EID, 0);
+            CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
+        }
+        else
+        {
+            /* Unexpected error while writing to queue. */
+            CFE_SB_BroadcastRecordError(SBSndErr, EntryPtr->BufDscPtr->MsgId, EntryPtr->PipeId,
+                                        CFE_SB_Q_WR_ERR_EID, EntryPtr->Status);
+            CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
+        }
+
+        /* The general error count is incremented once per message, as for other delivery errors */
+        if (EntryPtr->BufDscPtr != PrevBufDscPtr)
+        {
+            CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+            PrevBufDscPtr = EntryPtr->BufDscPtr;
+        }
+
+        /* The queue does not hold the ref after all, this may free the buffer */
+        CFE_SB_DecrBufUseCnt(EntryPtr->BufDscPtr);
+    }
+
+    Delivery->Count = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_DeliveryComplete
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DeliveryComplete(CFE_SB_DeliveryList_t *Delivery, CFE_SB_EventBuf_t *SBSndErr)
+{
+    uint32 FailCount;
+
+    FailCount = CFE_SB_DeliveryWrite(Delivery);
+    CFE_SB_UnlockRoutes(Delivery);
+
+    /* In the nominal case all writes succeed and the SB lock is not needed again */
+    if (FailCount != 0)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_DeliveryRevert_Unsync(Delivery, SBSndErr);
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BroadcastRecordError
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BroadcastRecordError(CFE_SB_EventBuf_t *SBSndErr, CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                                 uint32 EventId, int32 ErrStat)
+{
+    CFE_SB_SendErrEventBuf_t *EvtPtr;
+
+    /* The associated counters are always incremented, but event details beyond the buffer capacity are dropped */
+    if (SBSndErr->EvtsToSnd < CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+    {
+        EvtPtr          = &SBSndErr->EvtBuf[SBSndErr->EvtsToSnd];
+        EvtPtr->MsgId   = MsgId;
+        EvtPtr->PipeId  = PipeId;
+        EvtPtr->EventId = EventId;
+        EvtPtr->ErrStat = ErrStat;
+        SBSndErr->EvtsToSnd++;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BroadcastReportErrors
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BroadcastReportErrors(const CFE_SB_EventBuf_t *SBSndErr)
+{
+    CFE_ES_TaskId_t TskId;
+    uint32          i;
+    char            FullName[(OS_MAX_API_NAME * 2)];
+    char            PipeName[OS_MAX_API_NAME];
+
+    /* get task id for events and Sender Info*/
+    CFE_ES_GetTaskID(&TskId);
+
+    /* send an event for each pipe write error that may have occurred */
+    for (i = 0; i < SBSndErr->EvtsToSnd; i++)
+    {
+        if (SBSndErr->EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
+        {
+
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
+
+                CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+                CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(SBSndErr->EvtBuf[i].MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName));
 
                 /* clear the bit so the task may send this event again */
                 CFE_SB_FinishSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT);
             } /* end if */
         }
-        else if (SBSndErr.EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
+        else if (SBSndErr->EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
         {
 
             /* Determine if event can be sent without causing recursive event problem */
             if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED)
             {
 
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
 
                 CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
                 CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(SBSndErr->EvtBuf[i].MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName));
 
                 /* clear the bit so the task may send this event again */
@@ -1748,13 +2134,13 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT) == CFE_SB_GRANTED)
             {
 
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat 0x%x",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(SBSndErr->EvtBuf[i].MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName),
-                                           (unsigned int)SBSndErr.EvtBuf[i].ErrStat);
+                                           (unsigned int)SBSndErr->EvtBuf[i].ErrStat);
 
                 /* clear the bit so the task may send this event again */
                 CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT);
@@ -1779,8 +2165,6 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     CFE_SB_BufferD_t *     BufDscPtr;
     size_t                 BufDscSize;
     CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SBR_RouteId_t      RouteId;
     CFE_ES_TaskId_t        TskId;
     uint16                 PendingEventID;
     osal_id_t              SysQueueId;
@@ -1793,7 +2177,6 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
     PipeDscPtr     = NULL;
     BufDscPtr      = NULL;
-    DestPtr        = NULL;
     BufDscSize     = 0;
     RcvStatus      = OS_SUCCESS;
 
@@ -1862,12 +2245,7 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
              * in a future version of CFE to decouple these actions, to allow for
              * multiple workers to service the same pipe.
              */
-            if (PipeDscPtr->LastBuffer != NULL)
-            {
-                /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
-                CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
-                PipeDscPtr->LastBuffer = NULL;
-            }
+            CFE_SB_PipeReleaseBuffers_Unsync(PipeDscPtr);
         }
 
         CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1938,25 +2316,8 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
              */
             *BufPtr = &BufDscPtr->Content;
 
-            /* get pointer to destination to be used in decrementing msg limit cnt*/
-            RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
-            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
-
-            /*
-            ** DestPtr would be NULL if the msg is unsubscribed to while it is on
-            ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
-            ** then resubscribed to while it is on the pipe. Both of these cases are
-            ** considered nominal and are handled by the code below.
-            */
-            if (DestPtr != NULL && DestPtr->BuffCount > 0)
-            {
-                DestPtr->BuffCount--;
-            }
-
-            if (PipeDscPtr->CurrentQueueDepth > 0)
-            {
-                --PipeDscPtr->CurrentQueueDepth;
-            }
+            /* decrement the msg limit count and queue depth */
+            CFE_SB_PipeDequeueUpdate_Unsync(PipeDscPtr, BufDscPtr);
         }
         else
         {
@@ -2021,6 +2382,241 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReceiveBuffers
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t *BufPtrs[], uint32 MaxCount, uint32 *CountPtr,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    int32             Status;
+    int32             RcvStatus;
+    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_SB_BufferD_t *BufDscList[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
+    size_t            BufDscSize;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_ES_TaskId_t   TskId;
+    uint16            PendingEventID;
+    osal_id_t         SysQueueId;
+    int32             SysTimeout;
+    uint32            BufCount;
+    uint32            i;
+    char              FullName[(OS_MAX_API_NAME * 2)];
+
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
+    SysTimeout     = OS_PEND;
+    SysQueueId     = OS_OBJECT_ID_UNDEFINED;
+    PipeDscPtr     = NULL;
+    BufDscPtr      = NULL;
+    BufDscSize     = 0;
+    BufCount       = 0;
+    RcvStatus      = OS_SUCCESS;
+
+    /*
+     * Check input args and translate the timeout, same as CFE_SB_ReceiveBuffer()
+     */
+    if (BufPtrs == NULL || CountPtr == NULL || MaxCount == 0)
+    {
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else if (TimeOut > 0)
+    {
+        /* time outs greater than 0 can be passed to OSAL directly */
+        SysTimeout = TimeOut;
+    }
+    else if (TimeOut == CFE_SB_POLL)
+    {
+        SysTimeout = OS_CHECK;
+    }
+    else if (TimeOut != CFE_SB_PEND_FOREVER)
+    {
+        /* any other timeout value is invalid */
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+
+    /* The number of references a pipe can hold on to is limited */
+    if (MaxCount > CFE_PLATFORM_SB_MAX_RECEIVE_BATCH)
+    {
+        MaxCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+    }
+
+    /* If OK, then lock and pull relevent info from Pipe Descriptor */
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+        /* If the pipe does not exist or PipeId is out of range... */
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
+        }
+        else
+        {
+            /* Grab the queue ID */
+            SysQueueId = PipeDscPtr->SysQueueId;
+
+            /* Un-reference all buffers from the last call, in a single pass */
+            CFE_SB_PipeReleaseBuffers_Unsync(PipeDscPtr);
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /*
+     * If everything validated, then proceed to get buffers from the queue.
+     * This must be done OUTSIDE the SB lock, as this call likely blocks.
+     *
+     * Only the first read waits according to the timeout, the rest of the
+     * batch is whatever is already pending on the pipe.
+     */
+    if (Status == CFE_SUCCESS)
+    {
+        while (BufCount < MaxCount)
+        {
+            RcvStatus = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, SysTimeout);
+            if (RcvStatus != OS_SUCCESS || BufDscPtr == NULL || BufDscSize != sizeof(BufDscPtr))
+            {
+                break;
+            }
+
+            BufDscList[BufCount] = BufDscPtr;
+            ++BufCount;
+            SysTimeout = OS_CHECK;
+        }
+
+        /*
+         * translate the return value of the first read, any failure after
+         * that simply ends the batch.
+         */
+        if (BufCount > 0)
+        {
+            /* Pass through */
+        }
+        else if (RcvStatus == OS_QUEUE_EMPTY)
+        {
+            /* normal if using CFE_SB_POLL */
+            Status = CFE_SB_NO_MESSAGE;
+        }
+        else if (RcvStatus == OS_QUEUE_TIMEOUT)
+        {
+            /* normal if using a nonzero timeout */
+            Status = CFE_SB_TIME_OUT;
+        }
+        else
+        {
+            /* off-nominal condition, report an error event */
+            PendingEventID = CFE_SB_Q_RD_ERR_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
+    }
+
+    /* Now re-lock to store the buffers in the pipe descriptor */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /*
+         * NOTE: This uses the same PipeDscPtr that was found earlier,
+         * see the same check in CFE_SB_ReceiveBuffer().
+         */
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
+
+        for (i = 0; i < BufCount; ++i)
+        {
+            BufDscPtr = BufDscList[i];
+
+            if (Status == CFE_SUCCESS)
+            {
+                /*
+                 * Store the buffer in the pipe descriptor so it is released on the
+                 * next receive call for this pipe.  This counts as a new reference.
+                 */
+                CFE_SB_IncrBufUseCnt(BufDscPtr);
+                PipeDscPtr->LastBatch[i] = BufDscPtr;
+                BufPtrs[i]               = &BufDscPtr->Content;
+
+                /* decrement the msg limit count and queue depth */
+                CFE_SB_PipeDequeueUpdate_Unsync(PipeDscPtr, BufDscPtr);
+            }
+
+            /* Always decrement the use count, for the ref that was in the queue */
+            CFE_SB_DecrBufUseCnt(BufDscPtr);
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            PipeDscPtr->LastBatchCount = BufCount;
+        }
+    }
+
+    /* Before unlocking, check the PendingEventID and increment relevant error counter */
+    if (Status != CFE_SUCCESS)
+    {
+        BufCount = 0;
+
+        if (PendingEventID == CFE_SB_RCV_BAD_ARG_EID || PendingEventID == CFE_SB_BAD_PIPEID_EID)
+        {
+            ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+        }
+        else if (PendingEventID != 0)
+        {
+            /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
+            ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Now actually send the event, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        /* get task id for events */
+        CFE_ES_GetTaskID(&TskId);
+
+        switch (PendingEventID)
+        {
+            case CFE_SB_Q_RD_ERR_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_Q_RD_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Pipe Read Err,pipe %lu,app %s,stat 0x%x", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (unsigned int)RcvStatus);
+                break;
+            case CFE_SB_RCV_BAD_ARG_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Rcv Err:Bad Input Arg:BufPtrs 0x%lx,max %lu,pipe %lu,t/o %d,app %s",
+                                           (unsigned long)BufPtrs, (unsigned long)MaxCount,
+                                           CFE_RESOURCEID_TO_ULONG(PipeId), (int)TimeOut,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+            case CFE_SB_BAD_PIPEID_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_BAD_PIPEID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Rcv Err:PipeId %lu does not exist,app %s", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+        }
+    }
+
+    if (CountPtr != NULL)
+    {
+        *CountPtr = BufCount;
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_AllocateMessageBuffer
@@ -2105,7 +2701,7 @@ int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **
      * Calculate descriptor pointer from buffer pointer -
      * The buffer is just a member (offset) in the descriptor
      */
-    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
+    BufDscAddr = (cpuaddr)BufPtr - CFE_SB_BUFFERD_CONTENT_OFFSET;
     *BufDscPtr = (CFE_SB_BufferD_t *)BufDscAddr;
 
     /*
@@ -2159,50 +2755,367 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount)
 {
-    int32             Status;
-    CFE_SB_BufferD_t *BufDscPtr;
-    CFE_SBR_RouteId_t RouteId;
+    int32                 Status;
+    CFE_SB_BufferD_t *    BufDscPtr;
+    CFE_SBR_RouteId_t     RouteId;
+    CFE_SB_MsgId_t        MsgId;
+    CFE_ES_AppId_t        AppId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
+    uint16                PendingEventID;
+
+    PendingEventID          = 0;
+    MsgId                   = CFE_SB_INVALID_MSG_ID;
+    AppId                   = CFE_ES_APPID_UNDEFINED;
+    SBSndErr.EvtsToSnd      = 0;
+    Delivery.Count          = 0;
+    Delivery.RouteLocksHeld = 0;
 
     Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
 
     if (Status == CFE_SUCCESS)
     {
         /* Validate the content and get the MsgId, store it in the descriptor */
-        Status = CFE_SB_TransmitMsgValidate(&BufPtr->Msg, &BufDscPtr->MsgId, &BufDscPtr->ContentSize, &RouteId);
+        Status = CFE_SB_TransmitMsgValidate(&BufPtr->Msg, &BufDscPtr->MsgId, &BufDscPtr->ContentSize);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        MsgId                   = BufDscPtr->MsgId;
+        BufDscPtr->AutoSequence = IncrementSequenceCount;
+        CFE_MSG_GetType(&BufPtr->Msg, &BufDscPtr->ContentType);
+
+        /* get app id for loopback testing (this must not be done while holding the SB lock) */
+        CFE_ES_GetAppID(&AppId);
+
+        /* The route lock is taken before the SB lock, see CFE_SB_LockRoutes() */
+        CFE_SB_LockRoutes(&Delivery, CFE_SB_RouteLockMask(MsgId));
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /*
+     * Broadcast the message if validation succeeded.
+     *
+     * Note that for the case of no subscribers, the route ID will be invalid.
+     * This is OK and considered normal - the route lookup will increment the
+     * NoSubscribers count, but we should NOT increment the MsgSendErrorCounter
+     * here - it is not really a sending error to have no subscribers.
+     * CFE_SB_BroadcastBufferToRoute_Unsync() will not send to anything if the
+     * route is not valid (benign), but it still consumes the buffer.
+     */
+    if (Status == CFE_SUCCESS)
+    {
+        RouteId = CFE_SB_TransmitMsgGetRoute_Unsync(MsgId);
+        if (!CFE_SBR_IsValidRouteId(RouteId))
+        {
+            PendingEventID = CFE_SB_SEND_NO_SUBS_EID;
+        }
+
+        /* Now broadcast the message, which consumes the buffer */
+        CFE_SB_BroadcastBufferToRoute_Unsync(BufDscPtr, RouteId, AppId, &SBSndErr, &Delivery);
 
         /*
-         * Broadcast the message if validation succeeded.
-         *
-         * Note that for the case of no subscribers, the validation returns CFE_SUCCESS
-         * but the actual route ID may be invalid.  This is OK and considered normal-
-         * the validation will increment the NoSubscribers count, but we should NOT
-         * increment the MsgSendErrorCounter here - it is not really a sending error to
-         * have no subscribers.  CFE_SB_BroadcastBufferToRoute() will not send to
-         * anything if the route is not valid (benign).
+         * IMPORTANT - the descriptor might be freed at any time after this,
+         * so the descriptor should not be accessed again after this point.
          */
+        BufDscPtr = NULL;
+    }
+    else
+    {
+        /* Increment send error counter for validation failure */
+        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Write to the pipe queues, after unlocking */
+    CFE_SB_DeliveryComplete(&Delivery, &SBSndErr);
+
+    /* Now actually send the events, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        CFE_SB_TransmitMsgReportEvent(PendingEventID, MsgId, 0);
+    }
+
+    if (SBSndErr.EvtsToSnd > 0)
+    {
+        CFE_SB_BroadcastReportErrors(&SBSndErr);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitBufferBatch
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *BufPtrs[], uint32 Count, bool IncrementSequenceCount)
+{
+    int32                 Status;
+    uint32                i;
+    uint32                j;
+    CFE_SB_BufferD_t *    BufDscPtrs[CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH];
+    CFE_SBR_RouteId_t     RouteId;
+    CFE_SB_MsgId_t        EventMsgId;
+    CFE_ES_AppId_t        AppId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
+    uint16                PendingEventID;
+    uint32                LockMask;
+    CFE_ES_TaskId_t       TskId;
+    char                  FullName[(OS_MAX_API_NAME * 2)];
+
+    PendingEventID          = 0;
+    LockMask                = 0;
+    EventMsgId              = CFE_SB_INVALID_MSG_ID;
+    SBSndErr.EvtsToSnd      = 0;
+    Delivery.Count          = 0;
+    Delivery.RouteLocksHeld = 0;
+    Status                  = CFE_SUCCESS;
+
+    if (BufPtrs == NULL || Count == 0 || Count > CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH)
+    {
+        CFE_ES_GetTaskID(&TskId);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                   "Send Err:Bad input argument,Arg 0x%lx,Count %lu,App %s", (unsigned long)BufPtrs,
+                                   (unsigned long)Count, CFE_SB_GetAppTskName(TskId, FullName));
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+
+    /*
+     * Validate the entire batch before sending any of it.  If any buffer
+     * is invalid, none of the buffers are consumed, so the calling
+     * application still owns all of them, same as CFE_SB_TransmitBuffer().
+     *
+     * A buffer listed twice would be consumed (and possibly freed) by the
+     * first broadcast, so that is rejected here as well.
+     */
+    for (i = 0; Status == CFE_SUCCESS && i < Count; ++i)
+    {
+        Status = CFE_SB_ZeroCopyBufferValidate(BufPtrs[i], &BufDscPtrs[i]);
+
+        for (j = 0; Status == CFE_SUCCESS && j < i; ++j)
+        {
+            if (BufDscPtrs[j] == BufDscPtrs[i])
+            {
+                Status = CFE_SB_BAD_ARGUMENT;
+            }
+        }
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_GetTaskID(&TskId);
+            CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Send Err:Bad input argument,Arg 0x%lx,Entry %lu,App %s",
+                                       (unsigned long)BufPtrs[i], (unsigned long)i,
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+        }
+        else
+        {
+            /* Validate the content and get the MsgId, store it in the descriptor */
+            Status = CFE_SB_TransmitMsgValidate(&BufPtrs[i]->Msg, &BufDscPtrs[i]->MsgId, &BufDscPtrs[i]->ContentSize);
+        }
+
         if (Status == CFE_SUCCESS)
         {
-            BufDscPtr->AutoSequence = IncrementSequenceCount;
-            CFE_MSG_GetType(&BufPtr->Msg, &BufDscPtr->ContentType);
+            BufDscPtrs[i]->AutoSequence = IncrementSequenceCount;
+            CFE_MSG_GetType(&BufPtrs[i]->Msg, &BufDscPtrs[i]->ContentType);
+            LockMask |= CFE_SB_RouteLockMask(BufDscPtrs[i]->MsgId);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* get app id for loopback testing (this must not be done while holding the SB lock) */
+        CFE_ES_GetAppID(&AppId);
+
+        /* The route locks of the whole batch are taken before the SB lock, see CFE_SB_LockRoutes() */
+        CFE_SB_LockRoutes(&Delivery, LockMask);
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
 
-            /* Now broadcast the message, which consumes the buffer */
-            CFE_SB_BroadcastBufferToRoute(BufDscPtr, RouteId);
+    if (Status == CFE_SUCCESS)
+    {
+        for (i = 0; i < Count; ++i)
+        {
+            RouteId = CFE_SB_TransmitMsgGetRoute_Unsync(BufDscPtrs[i]->MsgId);
+
+            /* Only the first no subscriber event in the batch is reported, the counter reflects all of them */
+            if (!CFE_SBR_IsValidRouteId(RouteId) && PendingEventID == 0)
+            {
+                PendingEventID = CFE_SB_SEND_NO_SUBS_EID;
+                EventMsgId     = BufDscPtrs[i]->MsgId;
+            }
 
             /*
-             * IMPORTANT - the descriptor might be freed at any time after this,
-             * so the descriptor should not be accessed again after this point.
+             * Now broadcast the message, which consumes the buffer.  The descriptor
+             * might be freed at any time after this, so it is not accessed again.
              */
-            BufDscPtr = NULL;
+            CFE_SB_BroadcastBufferToRoute_Unsync(BufDscPtrs[i], RouteId, AppId, &SBSndErr, &Delivery);
+            BufDscPtrs[i] = NULL;
         }
     }
+    else
+    {
+        /* Increment send error counter for validation failure */
+        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Write to the pipe queues, after unlocking */
+    CFE_SB_DeliveryComplete(&Delivery, &SBSndErr);
+
+    /* Now actually send the events, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        CFE_SB_TransmitMsgReportEvent(PendingEventID, EventMsgId, 0);
+    }
+
+    if (SBSndErr.EvtsToSnd > 0)
+    {
+        CFE_SB_BroadcastReportErrors(&SBSndErr);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransferBuffer
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransferBuffer(CFE_SB_Buffer_t *BufPtr, CFE_SB_MsgId_t MsgId, size_t Size,
+                                   bool IncrementSequenceCount)
+{
+    int32             Status;
+    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_MSG_Type_t    MsgType;
+    size_t            HdrSize;
+    size_t            MaxSize;
+    uint16            PendingEventID;
+    CFE_ES_TaskId_t   TskId;
+    char              FullName[(OS_MAX_API_NAME * 2)];
+
+    PendingEventID = 0;
+    MsgType        = CFE_MSG_Type_Invalid;
+    HdrSize        = 0;
+    MaxSize        = 0;
+
+    Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
 
     if (Status != CFE_SUCCESS)
     {
-        /* Increment send error counter for validation failure */
+        PendingEventID = CFE_SB_SEND_BAD_ARG_EID;
+    }
+    else
+    {
+        MaxSize = BufDscPtr->AllocatedSize - CFE_SB_BUFFERD_CONTENT_OFFSET;
+
+        if (!CFE_SB_IsValidMsgId(MsgId) || CFE_MSG_GetTypeFromMsgId(MsgId, &MsgType) != CFE_SUCCESS)
+        {
+            PendingEventID = CFE_SB_SEND_INV_MSGID_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
+        }
+        else if (Size > MaxSize)
+        {
+            /* The message would not fit in what was allocated */
+            PendingEventID = CFE_SB_MSG_TOO_BIG_EID;
+            Status         = CFE_SB_MSG_TOO_BIG;
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        if (MsgType == CFE_MSG_Type_Cmd)
+        {
+            HdrSize = sizeof(CFE_MSG_CommandHeader_t);
+        }
+        else
+        {
+            HdrSize = sizeof(CFE_MSG_TelemetryHeader_t);
+        }
+
+        if (Size < HdrSize)
+        {
+            PendingEventID = CFE_SB_SEND_BAD_ARG_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /*
+         * Compose the header in place.  Only the header portion of the buffer is
+         * initialized, the application already put the payload in the buffer.
+         */
+        Status = CFE_MSG_Init(&BufPtr->Msg, MsgId, HdrSize);
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_MSG_SetSize(&BufPtr->Msg, Size);
+        }
+
+        if (Status != CFE_SUCCESS)
+        {
+            PendingEventID = CFE_SB_SEND_BAD_ARG_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
+        }
+        else if (MsgType == CFE_MSG_Type_Tlm)
+        {
+            CFE_SB_TimeStampMsg(&BufPtr->Msg);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* From here it is the same as a buffer with an application-built header */
+        Status = CFE_SB_TransmitBuffer(BufPtr, IncrementSequenceCount);
+    }
+    else
+    {
         CFE_SB_LockSharedData(__func__, __LINE__);
         CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
         CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
+    /* Send the events after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        CFE_ES_GetTaskID(&TskId);
+
+        switch (PendingEventID)
+        {
+            case CFE_SB_SEND_BAD_ARG_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Bad input argument,Arg 0x%lx,Size %lu,App %s",
+                                           (unsigned long)BufPtr, (unsigned long)Size,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+
+            case CFE_SB_SEND_INV_MSGID_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_INV_MSGID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Invalid MsgId(0x%x)in msg,App %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+
+            case CFE_SB_MSG_TOO_BIG_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_MSG_TOO_BIG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (int)Size, (int)MaxSize);
+                break;
+        }
+    }
+
     return Status;
 }
@@ -35,13 +35,6 @@
 
 #include "cfe_sb_module_all.h"
 
-/*
- * The actual message content of a SB Buffer Descriptor is the
- * offset of the content member.  This will be auto-aligned by
- * the compiler according to the requirements of the machine.
- */
-#define CFE_SB_BUFFERD_CONTENT_OFFSET (offsetof(CFE_SB_BufferD_t, Content))
-
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_TrackingListReset
@@ -104,18 +97,57 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  *-----------------------------------------------------------------*/
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 {
-    int32             stat1;
-    size_t            AllocSize;
-    CFE_SB_BufferD_t *bd = NULL;
+    int32                 stat1;
+    size_t                AllocSize;
+    size_t                BlockSize;
+    CFE_SB_BufferCache_t *CachePtr;
+    CFE_SB_BufferD_t *    bd = NULL;
 
     /* The allocation needs to include enough space for the descriptor object */
     AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
 
-    /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&bd, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    /*
+     * If this is a cached size, first try to reuse a previously released buffer.
+     * Otherwise the pool block is requested at the full block size of the cache, so
+     * it can hold any message of this size class when it is reused later.
+     */
+    CachePtr = CFE_SB_BufferCacheLookup(AllocSize);
+    if (CachePtr != NULL)
     {
-        return NULL;
+        BlockSize = CachePtr->BlockSize;
+
+        if (CachePtr->Count > 0)
+        {
+            --CachePtr->Count;
+            bd = CachePtr->Blocks[CachePtr->Count];
+            ++CachePtr->HitsSinceTrim;
+        }
+    }
+    else
+    {
+        BlockSize = AllocSize;
+    }
+
+    if (bd != NULL)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.BufferCacheHits++;
+    }
+    else
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.BufferCacheMisses++;
+
+        /* Allocate a new buffer descriptor from the SB memory pool.*/
+        stat1 = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&bd, CFE_SB_Global.Mem.PoolHdl, BlockSize);
+        if (stat1 < 0 && CFE_SB_BufferCacheFlush(false) > 0)
+        {
+            /* Memory held in the caches was given back to the pool, so try again */
+            stat1 = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&bd, CFE_SB_Global.Mem.PoolHdl, BlockSize);
+        }
+
+        if (stat1 < 0)
+        {
+            return NULL;
+        }
     }
 
     /* increment the number of buffers in use and adjust the high water mark if needed */
@@ -165,6 +197,145 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
     CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufferCacheInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BufferCacheInit(const size_t *BlockSizes, uint16 NumBlockSizes)
+{
+    CFE_SB_BufferCache_t *CachePtr;
+    uint16                Idx;
+
+    CFE_SB_Global.Mem.NumCaches = 0;
+
+    /*
+     * The block sizes are in decreasing order, and the pool uses the smallest block
+     * that fits.  So the caches must cover every block size starting at the smallest,
+     * in order for CFE_SB_BufferCacheLookup() to select the same one as the pool.
+     */
+    Idx = NumBlockSizes;
+    while (Idx > 0 && BlockSizes[Idx - 1] <= CFE_PLATFORM_SB_BUFFER_CACHE_MAX_BLOCK_SIZE)
+    {
+        --Idx;
+
+        /* skip any zero or repeated sizes, these are unused buckets */
+        if (BlockSizes[Idx] == 0 ||
+            (CFE_SB_Global.Mem.NumCaches > 0 &&
+             BlockSizes[Idx] <= CFE_SB_Global.Mem.Cache[CFE_SB_Global.Mem.NumCaches - 1].BlockSize))
+        {
+            continue;
+        }
+
+        CachePtr = &CFE_SB_Global.Mem.Cache[CFE_SB_Global.Mem.NumCaches];
+        memset(CachePtr, 0, sizeof(*CachePtr));
+        CachePtr->BlockSize = BlockSizes[Idx];
+
+        ++CFE_SB_Global.Mem.NumCaches;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufferCacheLookup
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferCache_t *CFE_SB_BufferCacheLookup(size_t AllocSize)
+{
+    uint16 Idx;
+
+    for (Idx = 0; Idx < CFE_SB_Global.Mem.NumCaches; ++Idx)
+    {
+        if (AllocSize <= CFE_SB_Global.Mem.Cache[Idx].BlockSize)
+        {
+            return &CFE_SB_Global.Mem.Cache[Idx];
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufferCachePut
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_BufferCachePut(CFE_SB_BufferD_t *bd)
+{
+    CFE_SB_BufferCache_t *CachePtr;
+
+    /* Buffers reclaimed from an application that is going away go back to the pool */
+    if (CFE_RESOURCEID_TEST_DEFINED(bd->AppId))
+    {
+        return false;
+    }
+
+    CachePtr = CFE_SB_BufferCacheLookup(bd->AllocatedSize);
+    if (CachePtr == NULL || CachePtr->Count >= CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH)
+    {
+        return false;
+    }
+
+    /* Remove from any tracking list (no effect if not in a list) */
+    CFE_SB_TrackingListRemove(&bd->Link);
+
+    /* A cached buffer is accounted for the same as if it was returned to the pool */
+    --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
+
+    CachePtr->Blocks[CachePtr->Count] = bd;
+    ++CachePtr->Count;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufferCacheFlush
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_BufferCacheFlush(bool TrimOnly)
+{
+    CFE_SB_BufferCache_t *CachePtr;
+    uint16                Idx;
+    uint32                Released;
+
+    Released = 0;
+
+    for (Idx = 0; Idx < CFE_SB_Global.Mem.NumCaches; ++Idx)
+    {
+        CachePtr = &CFE_SB_Global.Mem.Cache[Idx];
+
+        if (!TrimOnly || CachePtr->HitsSinceTrim == 0)
+        {
+            while (CachePtr->Count > 0)
+            {
+                --CachePtr->Count;
+
+                /* Already accounted as not in use when it was cached */
+                CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, CachePtr->Blocks[CachePtr->Count]);
+                ++Released;
+            }
+        }
+
+        CachePtr->HitsSinceTrim = 0;
+    }
+
+    return Released;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_IncrBufUseCnt
@@ -197,7 +368,7 @@ void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
     {
         --bd->UseCount;
 
-        if (bd->UseCount == 0)
+        if (bd->UseCount == 0 && !CFE_SB_BufferCachePut(bd))
         {
             CFE_SB_ReturnBufferToPool(bd);
         }
@@ -212,19 +383,26 @@ void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
+CFE_SB_DestinationList_t *CFE_SB_GetDestinationBlk(uint16 Capacity)
 {
-    int32                  Stat;
-    CFE_SB_DestinationD_t *Dest = NULL;
+    int32                     Stat;
+    CFE_SB_DestinationList_t *DestList = NULL;
+    size_t                    AllocSize;
+
+    /* Only the header and the requested number of destinations are allocated */
+    AllocSize = offsetof(CFE_SB_DestinationList_t, Dest) + (Capacity * sizeof(CFE_SB_DestinationD_t));
 
-    /* Allocate a new destination descriptor from the SB memory pool.*/
-    Stat = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&Dest, CFE_SB_Global.Mem.PoolHdl, sizeof(CFE_SB_DestinationD_t));
+    /* Allocate a new destination list from the SB memory pool.*/
+    Stat = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&DestList, CFE_SB_Global.Mem.PoolHdl, AllocSize);
     if (Stat < 0)
     {
         return NULL;
     }
 
-    /* Add the size of a destination descriptor to the memory-in-use ctr and */
+    DestList->Count    = 0;
+    DestList->Capacity = Capacity;
+
+    /* Add the size of the destination list to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
     if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
@@ -232,7 +410,7 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
         CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
     } /* end if */
 
-    return Dest;
+    return DestList;
 }
 
 /*----------------------------------------------------------------
@@ -243,17 +421,17 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
+int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationList_t *DestList)
 {
     int32 Stat;
 
-    if (Dest == NULL)
+    if (DestList == NULL)
     {
         return CFE_SB_BAD_ARGUMENT;
     } /* end if */
 
-    /* give the destination block back to the SB memory pool */
-    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, Dest);
+    /* give the destination list back to the SB memory pool */
+    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, DestList);
     if (Stat > 0)
     {
         /* Substract the size of the destination block from the Memory in use ctr */
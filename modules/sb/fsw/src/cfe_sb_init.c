@@ -34,6 +34,7 @@
 
 #include "cfe_sb_module_all.h"
 
+#include <stdio.h>
 #include <string.h>
 
 /*
@@ -59,7 +60,9 @@ const size_t CFE_SB_MemPoolDefSize[CFE_PLATFORM_ES_POOL_MAX_BUCKETS] = {
 int32 CFE_SB_EarlyInit(void)
 {
 
-    int32 Stat;
+    int32  Stat;
+    uint32 i;
+    char   LockName[OS_MAX_API_NAME];
 
     /* Clear task global */
     memset(&CFE_SB_Global, 0, sizeof(CFE_SB_Global));
@@ -71,6 +74,20 @@ int32 CFE_SB_EarlyInit(void)
         return Stat;
     } /* end if */
 
+    /* Create the route locks, these are taken before the shared data mutex */
+    for (i = 0; i < CFE_PLATFORM_SB_ROUTE_LOCKS; ++i)
+    {
+        snprintf(LockName, sizeof(LockName), "CFE_SB_RtMutex%u", (unsigned int)i);
+
+        Stat = OS_MutSemCreate(&CFE_SB_Global.RouteMutexId[i], LockName, 0);
+        if (Stat != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Route mutex %u creation failed! RC=0x%08x\n", __func__, (unsigned int)i,
+                                 (unsigned int)Stat);
+            return Stat;
+        } /* end if */
+    }
+
     /* Initialize the state of susbcription reporting */
     CFE_SB_Global.SubscriptionReporting = CFE_SB_DISABLE;
 
@@ -126,6 +143,11 @@ int32 CFE_SB_InitBuffers(void)
     CFE_SB_TrackingListReset(&CFE_SB_Global.InTransitList);
     CFE_SB_TrackingListReset(&CFE_SB_Global.ZeroCopyList);
 
+    /*
+     * Initialize the buffer caches to be empty
+     */
+    CFE_SB_BufferCacheInit(&CFE_SB_MemPoolDefSize[0], CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+
     return CFE_SUCCESS;
 }
 
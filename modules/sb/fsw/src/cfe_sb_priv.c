@@ -180,6 +180,108 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
     return;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_RouteLockMask
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_RouteLockMask(CFE_SB_MsgId_t MsgId)
+{
+    /* There is one route per message ID, so this maps each route to one lock */
+    return ((uint32)1 << (CFE_SB_MsgIdToValue(MsgId) % CFE_PLATFORM_SB_ROUTE_LOCKS));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_LockRoutes
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_LockRoutes(CFE_SB_DeliveryList_t *Delivery, uint32 LockMask)
+{
+    int32          Status;
+    uint32         LockIdx;
+    CFE_ES_AppId_t AppId;
+
+    /* Locks are taken in index order, so tasks taking several locks cannot deadlock */
+    for (LockIdx = 0; LockIdx < CFE_PLATFORM_SB_ROUTE_LOCKS; ++LockIdx)
+    {
+        /* Routes that share a lock only take it once, as the list releases it once */
+        if ((LockMask & ((uint32)1 << LockIdx)) != 0 && (Delivery->RouteLocksHeld & ((uint32)1 << LockIdx)) == 0)
+        {
+            Status = OS_MutSemTake(CFE_SB_Global.RouteMutexId[LockIdx]);
+            if (Status != OS_SUCCESS)
+            {
+                CFE_ES_GetAppID(&AppId);
+
+                CFE_ES_WriteToSysLog("%s: Route Mutex %u Take Err Stat=0x%x,App=%lu\n", __func__,
+                                     (unsigned int)LockIdx, (unsigned int)Status, CFE_RESOURCEID_TO_ULONG(AppId));
+            }
+
+            Delivery->RouteLocksHeld |= ((uint32)1 << LockIdx);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_UnlockRoutes
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_UnlockRoutes(CFE_SB_DeliveryList_t *Delivery)
+{
+    int32          Status;
+    uint32         LockIdx;
+    CFE_ES_AppId_t AppId;
+
+    for (LockIdx = 0; Delivery->RouteLocksHeld != 0; ++LockIdx)
+    {
+        if ((Delivery->RouteLocksHeld & ((uint32)1 << LockIdx)) != 0)
+        {
+            Delivery->RouteLocksHeld &= ~((uint32)1 << LockIdx);
+
+            Status = OS_MutSemGive(CFE_SB_Global.RouteMutexId[LockIdx]);
+            if (Status != OS_SUCCESS)
+            {
+                CFE_ES_GetAppID(&AppId);
+
+                CFE_ES_WriteToSysLog("%s: Route Mutex %u Give Err Stat=0x%x,App=%lu\n", __func__,
+                                     (unsigned int)LockIdx, (unsigned int)Status, CFE_RESOURCEID_TO_ULONG(AppId));
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_RouteLockBarrier
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RouteLockBarrier(void)
+{
+    CFE_SB_DeliveryList_t Barrier;
+    uint32                LockIdx;
+
+    /* Only one lock is held at a time, and never with the SB lock */
+    for (LockIdx = 0; LockIdx < CFE_PLATFORM_SB_ROUTE_LOCKS; ++LockIdx)
+    {
+        Barrier.RouteLocksHeld = 0;
+        CFE_SB_LockRoutes(&Barrier, (uint32)1 << LockIdx);
+        CFE_SB_UnlockRoutes(&Barrier);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_GetDestPtr
@@ -190,21 +292,87 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
  *-----------------------------------------------------------------*/
 CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId)
 {
-    CFE_SB_DestinationD_t *destptr;
+    CFE_SB_DestinationList_t *destlist;
+    uint16                    i;
 
-    destptr = CFE_SBR_GetDestListHeadPtr(RouteId);
+    destlist = CFE_SBR_GetDestList(RouteId);
 
     /* Check all destinations */
-    while (destptr != NULL)
+    if (destlist != NULL)
     {
-        if (CFE_RESOURCEID_TEST_EQUAL(destptr->PipeId, PipeId))
+        for (i = 0; i < destlist->Count; i++)
         {
-            break;
+            if (CFE_RESOURCEID_TEST_EQUAL(destlist->Dest[i].PipeId, PipeId))
+            {
+                return &destlist->Dest[i];
+            }
         }
-        destptr = destptr->Next;
     }
 
-    return destptr;
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_PipeReleaseBuffers_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeReleaseBuffers_Unsync(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    uint32 i;
+
+    if (PipeDscPtr->LastBuffer != NULL)
+    {
+        /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
+        PipeDscPtr->LastBuffer = NULL;
+    }
+
+    /* Likewise for all the buffers from the last batch receive */
+    for (i = 0; i < PipeDscPtr->LastBatchCount; ++i)
+    {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBatch[i]);
+        PipeDscPtr->LastBatch[i] = NULL;
+    }
+
+    PipeDscPtr->LastBatchCount = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_PipeDequeueUpdate_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeDequeueUpdate_Unsync(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_SB_DestinationD_t *DestPtr;
+
+    /* get pointer to destination to be used in decrementing msg limit cnt*/
+    RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
+    DestPtr = CFE_SB_GetDestPtr(RouteId, PipeDscPtr->PipeId);
+
+    /*
+    ** DestPtr would be NULL if the msg is unsubscribed to while it is on
+    ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
+    ** then resubscribed to while it is on the pipe. Both of these cases are
+    ** considered nominal and are handled by the code below.
+    */
+    if (DestPtr != NULL && DestPtr->BuffCount > 0)
+    {
+        DestPtr->BuffCount--;
+    }
+
+    if (PipeDscPtr->CurrentQueueDepth > 0)
+    {
+        --PipeDscPtr->CurrentQueueDepth;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -384,35 +552,51 @@ void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, uint32 Bit)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNode)
+int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, const CFE_SB_DestinationD_t *NewNode)
 {
+    CFE_SB_DestinationList_t *OldList;
+    CFE_SB_DestinationList_t *NewList;
+    uint16                    Capacity;
 
-    CFE_SB_DestinationD_t *WBS; /* Will Be Second (WBS) node */
-    CFE_SB_DestinationD_t *listheadptr;
-
-    listheadptr = CFE_SBR_GetDestListHeadPtr(RouteId);
+    OldList = CFE_SBR_GetDestList(RouteId);
+    NewList = OldList;
 
-    /* if first node in list */
-    if (listheadptr == NULL)
+    /* Grow the list by doubling when full, so adding N destinations costs O(log N) copies */
+    if (OldList == NULL || OldList->Count >= OldList->Capacity)
     {
-        /* initialize the new node */
-        NewNode->Next = NULL;
-        NewNode->Prev = NULL;
-    }
-    else
-    {
-        WBS = listheadptr;
+        if (OldList == NULL)
+        {
+            Capacity = CFE_SB_MIN_DEST_LIST_CAPACITY;
+        }
+        else
+        {
+            Capacity = OldList->Capacity * 2;
+        }
 
-        /* initialize the new node */
-        NewNode->Next = WBS;
-        NewNode->Prev = NULL;
+        if (Capacity > CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+        {
+            Capacity = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+        }
+
+        NewList = CFE_SB_GetDestinationBlk(Capacity);
+        if (NewList == NULL)
+        {
+            return CFE_SB_BUF_ALOC_ERR;
+        }
 
-        /* insert the new node */
-        WBS->Prev = NewNode;
+        if (OldList != NULL)
+        {
+            NewList->Count = OldList->Count;
+            memcpy(NewList->Dest, OldList->Dest, OldList->Count * sizeof(CFE_SB_DestinationD_t));
+            CFE_SB_PutDestinationBlk(OldList);
+        }
+
+        CFE_SBR_SetDestList(RouteId, NewList);
     }
 
-    /* Update Head */
-    CFE_SBR_SetDestListHeadPtr(RouteId, NewNode);
+    /* Append, so destinations are delivered in the order they subscribed */
+    NewList->Dest[NewList->Count] = *NewNode;
+    ++NewList->Count;
 
     return CFE_SUCCESS;
 }
@@ -428,7 +612,6 @@ int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNo
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
 {
     CFE_SB_RemoveDestNode(RouteId, DestPtr);
-    CFE_SB_PutDestinationBlk(DestPtr);
     CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse--;
 }
 
@@ -442,40 +625,25 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
  *-----------------------------------------------------------------*/
 void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove)
 {
-    CFE_SB_DestinationD_t *PrevNode;
-    CFE_SB_DestinationD_t *NextNode;
+    CFE_SB_DestinationList_t *DestList;
+    uint16                    Idx;
 
-    if ((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL))
-    {
-        /* Clear destinations if this is the only node in the list */
-        CFE_SBR_SetDestListHeadPtr(RouteId, NULL);
-    }
-    else if (NodeToRemove->Prev == NULL)
-    {
-        /* First in the list, set the next node to list head */
-        NextNode       = NodeToRemove->Next;
-        NextNode->Prev = NULL;
-        CFE_SBR_SetDestListHeadPtr(RouteId, NextNode);
-    }
-    else if (NodeToRemove->Next == NULL)
-    {
+    DestList = CFE_SBR_GetDestList(RouteId);
+    Idx      = NodeToRemove - DestList->Dest;
 
-        /* Last in the list, remove previous pointer */
-        PrevNode       = NodeToRemove->Prev;
-        PrevNode->Next = NULL;
+    --DestList->Count;
+    if (DestList->Count == 0)
+    {
+        /* Clear destinations if this was the only one in the list */
+        CFE_SBR_SetDestList(RouteId, NULL);
+        CFE_SB_PutDestinationBlk(DestList);
     }
-    else
+    else if (Idx < DestList->Count)
     {
-        /* Middle of list, remove */
-        PrevNode       = NodeToRemove->Prev;
-        NextNode       = NodeToRemove->Next;
-        PrevNode->Next = NextNode;
-        NextNode->Prev = PrevNode;
+        /* Close the gap, keeping the remaining destinations in order */
+        memmove(&DestList->Dest[Idx], &DestList->Dest[Idx + 1],
+                (DestList->Count - Idx) * sizeof(CFE_SB_DestinationD_t));
     }
-
-    /* initialize the node before returning it to the heap */
-    NodeToRemove->Next = NULL;
-    NodeToRemove->Prev = NULL;
 }
 
 /*----------------------------------------------------------------
@@ -84,6 +84,9 @@
 #define CFE_SB_CMD_PIPE_NAME                 "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER 8
 
+/* Initial number of destinations allocated for a route, doubled as needed */
+#define CFE_SB_MIN_DEST_LIST_CAPACITY 4
+
 #define CFE_SB_PIPE_OVERFLOW (-1)
 #define CFE_SB_PIPE_WR_ERR   (-2)
 #define CFE_SB_USECNT_ERR    (-3)
@@ -159,6 +162,13 @@ typedef struct CFE_SB_BufferD
 
 } CFE_SB_BufferD_t;
 
+/*
+ * The actual message content of a SB Buffer Descriptor is the
+ * offset of the content member.  This will be auto-aligned by
+ * the compiler according to the requirements of the machine.
+ */
+#define CFE_SB_BUFFERD_CONTENT_OFFSET (offsetof(CFE_SB_BufferD_t, Content))
+
 /******************************************************************************
 **  Typedef:  CFE_SB_PipeD_t
 **
@@ -178,9 +188,26 @@ typedef struct
     uint16            MaxQueueDepth;
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
+    uint16            LastBatchCount;
     CFE_SB_BufferD_t *LastBuffer;
+    CFE_SB_BufferD_t *LastBatch[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
 } CFE_SB_PipeD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_BufferCache_t
+**
+**  Purpose:
+**     This structure holds released message buffers of a single memory pool
+**     block size, which are kept for reuse rather than returned to the pool.
+*/
+typedef struct
+{
+    size_t            BlockSize;     /**< Pool block size of all buffers in this cache */
+    uint16            Count;         /**< Number of buffers currently in the cache */
+    uint16            HitsSinceTrim; /**< Number of reuses since the last trim */
+    CFE_SB_BufferD_t *Blocks[CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH]; /**< Cached buffers, used as a stack */
+} CFE_SB_BufferCache_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
@@ -193,6 +220,13 @@ typedef struct
     CFE_ES_MemHandle_t PoolHdl;
     CFE_ES_STATIC_POOL_TYPE(CFE_PLATFORM_SB_BUF_MEMORY_BYTES) Partition;
 
+    /*
+     * Buffer caches, one per pool block size that is eligible for caching,
+     * in order of increasing block size.
+     */
+    uint16               NumCaches;
+    CFE_SB_BufferCache_t Cache[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+
 } CFE_SB_MemParams_t;
 
 /*******************************************************************************/
@@ -240,6 +274,7 @@ typedef struct
 typedef struct
 {
     osal_id_t                    SharedDataMutexId;
+    osal_id_t                    RouteMutexId[CFE_PLATFORM_SB_ROUTE_LOCKS];
     uint32                       SubscriptionReporting;
     CFE_ES_AppId_t               AppId;
     uint32                       StopRecurseFlags[OS_MAX_TASKS];
@@ -274,6 +309,7 @@ typedef struct
     uint32          EventId;
     int32           ErrStat;
     CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId;
 } CFE_SB_SendErrEventBuf_t;
 
 /******************************************************************************
@@ -288,6 +324,38 @@ typedef struct
     CFE_SB_SendErrEventBuf_t EvtBuf[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
 } CFE_SB_EventBuf_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_DeliveryEntry_t
+**
+**  Purpose:
+**     This structure holds a single write of a buffer to a pipe queue, which
+**     is accounted for with the SB lock held and written after it is released.
+*/
+typedef struct
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SBR_RouteId_t RouteId;
+    CFE_SB_PipeId_t   PipeId;
+    osal_id_t         SysQueueId;
+    int32             Status;
+    uint16            PrevPeakQueueDepth;
+} CFE_SB_DeliveryEntry_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_DeliveryList_t
+**
+**  Purpose:
+**     This structure holds the pipe queue writes of a send, along with the
+**     route locks that are held until the writes are done.
+*/
+typedef struct
+{
+    uint32                 Count;
+    uint32                 RouteLocksHeld; /**< Bit mask of the route locks held */
+    CFE_SB_DeliveryEntry_t Entry[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+} CFE_SB_DeliveryList_t;
+
 /*
 ** Software Bus Function Prototypes
 */
@@ -336,6 +404,60 @@ void CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber);
  */
 void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * SB internal function to get the route lock of a message ID
+ *
+ * Each route (message ID) maps to one of the CFE_PLATFORM_SB_ROUTE_LOCKS route
+ * locks.  The masks of several message IDs may be combined and passed to
+ * CFE_SB_LockRoutes().
+ *
+ * @param MsgId       the message ID being sent
+ *
+ * \returns Bit mask with the bit of the route lock set
+ */
+uint32 CFE_SB_RouteLockMask(CFE_SB_MsgId_t MsgId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * SB internal function to get exclusive access to the pipe queue writes of routes
+ *
+ * The locks are recorded in the delivery list, and are held until the list is
+ * written by CFE_SB_DeliveryComplete().  Several routes may share the same lock,
+ * which is only taken once per list.
+ *
+ * Locking order: the route locks are taken in index order before the SB lock,
+ * and never while the SB lock is held.  So a task waiting on a route lock does
+ * not stall other SB callers.
+ *
+ * \note This must NOT be invoked with the SB lock held.
+ *
+ * @param Delivery    the delivery list that will hold the locks
+ * @param LockMask    the route locks to take, see CFE_SB_RouteLockMask()
+ */
+void CFE_SB_LockRoutes(CFE_SB_DeliveryList_t *Delivery, uint32 LockMask);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * SB internal function to release all route locks held by a delivery list
+ *
+ * @param Delivery    the delivery list holding the locks
+ */
+void CFE_SB_UnlockRoutes(CFE_SB_DeliveryList_t *Delivery);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * SB internal function to wait for all pipe queue writes in progress
+ *
+ * Takes and releases every route lock in turn.  Any write to a pipe queue which
+ * was set up before this is called is complete when it returns.  This is used
+ * before draining and deleting the queue of a pipe which was just removed from
+ * all routes.
+ *
+ * \note This must NOT be invoked with the SB lock held.
+ */
+void CFE_SB_RouteLockBarrier(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Processes a single message buffer that has been received from the command pipe
@@ -427,15 +549,72 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
 /**
  * \brief Internal routine to validate a transmit message before sending
  *
+ * Checks the message header only and does not access any SB shared data,
+ * so this is invoked without holding the SB lock.  An event is generated
+ * for any validation failure.
+ *
  * \param[in]  MsgPtr     Pointer to the message to validate
  * \param[out] MsgIdPtr   Message Id of message
  * \param[out] SizePtr    Size of message
- * \param[out] RouteIdPtr Route ID of the message (invalid if none)
  *
  * \return Execution status, see \ref CFEReturnCodes
  */
-int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr,
-                                 CFE_SBR_RouteId_t *RouteIdPtr);
+int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to get the route for a transmitted message
+ *
+ * If the message has no subscribers, the NoSubscribersCounter is incremented
+ * and an invalid route ID is returned.
+ *
+ * \note This must be invoked with the SB lock held.
+ *
+ * \param[in]  MsgId      Message Id of message
+ *
+ * \return Route ID of the message (invalid if none)
+ */
+CFE_SBR_RouteId_t CFE_SB_TransmitMsgGetRoute_Unsync(CFE_SB_MsgId_t MsgId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to copy a validated message into a buffer and broadcast it
+ *
+ * Looks up the route for the message, and if there are any subscribers, allocates
+ * a buffer from the pool, copies the message into it and broadcasts it.
+ *
+ * \note This must be invoked with the SB lock held.  Any event to be sent is
+ *       returned via PendingEventIdPtr and must be reported after unlock.
+ *
+ * \param[in]    MsgPtr                 Pointer to the validated message
+ * \param[in]    MsgId                  Message Id of message
+ * \param[in]    Size                   Size of message
+ * \param[in]    IncrementSequenceCount Whether to apply the route sequence counter
+ * \param[in]    AppId                  Sending application (for CFE_SB_PIPEOPTS_IGNOREMINE)
+ * \param[inout] SBSndErr               Buffer for delivery errors to be reported after unlock
+ * \param[inout] Delivery               Pipe queue writes to be completed after unlock
+ * \param[out]   PendingEventIdPtr      Set to the event to report after unlock, if any
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_TransmitMsgCopy_Unsync(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size,
+                                    bool IncrementSequenceCount, CFE_ES_AppId_t AppId, CFE_SB_EventBuf_t *SBSndErr,
+                                    CFE_SB_DeliveryList_t *Delivery, uint16 *PendingEventIdPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to report a transmit event deferred until after unlock
+ *
+ * Sends the CFE_SB_SEND_NO_SUBS_EID or CFE_SB_GET_BUF_ERR_EID event on behalf
+ * of the calling task, subject to the recursive event protection.
+ *
+ * \note This must NOT be invoked with the SB lock held.
+ *
+ * \param[in]  EventId    Event to report
+ * \param[in]  MsgId      Message Id of message
+ * \param[in]  Size       Size of message
+ */
+void CFE_SB_TransmitMsgReportEvent(uint16 EventId, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -542,23 +721,27 @@ void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, uint32 Bit);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * This function gets a destination descriptor from the SB memory pool.
+ * This function gets an empty destination list from the SB memory pool,
+ * with room for the given number of destinations.
  *
  * @note This must only be invoked while holding the SB global lock
- * @return Pointer to the destination descriptor
+ *
+ * @param Capacity Number of destinations to allocate, at most #CFE_PLATFORM_SB_MAX_DEST_PER_PKT
+ *
+ * @return Pointer to the destination list, or NULL if the pool is exhausted
  */
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
+CFE_SB_DestinationList_t *CFE_SB_GetDestinationBlk(uint16 Capacity);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * This function returns a destination descriptor to the SB memory pool.
+ * This function returns a destination list to the SB memory pool.
  * @note This must only be invoked while holding the SB global lock
  *
- * @param Dest Pointer to the destination descriptor
+ * @param DestList Pointer to the destination list
  *
  * \return Execution status, see \ref CFEReturnCodes
  */
-int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
+int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationList_t *DestList);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -636,6 +819,59 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
  */
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Initializes the SB buffer caches
+ *
+ * Sets up an empty cache for each SB memory pool block size which is not
+ * larger than #CFE_PLATFORM_SB_BUFFER_CACHE_MAX_BLOCK_SIZE.
+ *
+ * \param[in] BlockSizes Array of the SB memory pool block sizes, in decreasing order
+ * \param[in] NumBlockSizes Number of entries in the BlockSizes array
+ */
+void CFE_SB_BufferCacheInit(const size_t *BlockSizes, uint16 NumBlockSizes);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Finds the buffer cache for a given allocation size
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] AllocSize Size of the allocation, including the buffer descriptor
+ * \returns Pointer to the cache that holds blocks of the matching size, or NULL if not cached
+ */
+CFE_SB_BufferCache_t *CFE_SB_BufferCacheLookup(size_t AllocSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Puts a released buffer into the matching buffer cache
+ *
+ * The buffer is removed from any tracking list and is no longer counted as in use.
+ * Buffers that are still owned by an application (i.e. being cleaned up) are not
+ * cached, nor are buffers of an uncached size or when the cache is already full.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] bd Pointer to descriptor to cache
+ * \returns true if the buffer was cached, false if it must be returned to the pool
+ */
+bool CFE_SB_BufferCachePut(CFE_SB_BufferD_t *bd);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Returns all buffers held in the buffer caches to the SB memory pool
+ *
+ * If TrimOnly is set, only the caches which were not used since the previous
+ * call are emptied.  This is done periodically so a burst of messages of one
+ * size does not hold on to pool memory indefinitely.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] TrimOnly Only empty the caches which have not been used since the last call
+ * \returns The number of buffers returned to the pool
+ */
+uint32 CFE_SB_BufferCacheFlush(bool TrimOnly);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Broadcast a SB buffer descriptor to all destinations in route
@@ -653,7 +889,7 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  * not know (or care) what entities are subscribed to the data being generated.
  *
  *  - For any undeliverable destination (limit, OSAL error, etc), a proper event is generated.
- *  - For any successful queueing, the buffer use count is incremented
+ *  - For any queueing, the buffer use count is incremented
  *
  * The caller is expected to hold a reference (use count) of the buffer prior to invoking
  * this routine, representing itself, which is then consumed by this routine.
@@ -666,10 +902,99 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  * it should explicitly increment the use count before calling this, which will prevent
  * deallocation.
  *
- * \param[in] BufDscPtr Pointer to the buffer descriptor to broadcast
- * \param[in] RouteId   Route to send to
+ * \note This must be invoked with the SB lock held, so that the route lookup,
+ *       buffer allocation and broadcast of a message all occur within a single
+ *       critical section.  Delivery errors are recorded in SBSndErr rather than
+ *       reported directly; the caller should pass it to CFE_SB_BroadcastReportErrors()
+ *       after releasing the lock.
+ *
+ * The pipe queue writes themselves are not done here.  Each destination is fully
+ * accounted for (use count, message limit count, queue depth) and added to the
+ * delivery list.  The caller must have taken the lock of the route into the list
+ * with CFE_SB_LockRoutes() before taking the SB lock, and must pass the list to
+ * CFE_SB_DeliveryComplete() after releasing the SB lock, which does the writes
+ * and releases the route lock.  So the SB lock is not held during the queue
+ * writes, while the route lock keeps the messages of the route in order.
+ *
+ * \param[in]    BufDscPtr Pointer to the buffer descriptor to broadcast
+ * \param[in]    RouteId   Route to send to
+ * \param[in]    AppId     Sending application (for CFE_SB_PIPEOPTS_IGNOREMINE)
+ * \param[inout] SBSndErr  Buffer for delivery errors to be reported after unlock
+ * \param[inout] Delivery  Pipe queue writes to be completed after unlock
+ */
+void CFE_SB_BroadcastBufferToRoute_Unsync(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId,
+                                          CFE_ES_AppId_t AppId, CFE_SB_EventBuf_t *SBSndErr,
+                                          CFE_SB_DeliveryList_t *Delivery);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Write the buffers of a delivery list to the pipe queues
+ *
+ * Writes every entry in the list to its pipe queue and records the status of
+ * each write.  The route locks held by the list are kept.  Entries which could
+ * not be written remain in the list for CFE_SB_DeliveryRevert_Unsync().
+ *
+ * This may be invoked with or without the SB lock held.
+ *
+ * \param[inout] Delivery The delivery list to write
+ *
+ * \returns The number of entries that could not be written
  */
-void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId);
+uint32 CFE_SB_DeliveryWrite(CFE_SB_DeliveryList_t *Delivery);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Undo the accounting of the delivery list entries which could not be written
+ *
+ * Reverses the buffer use count, destination and pipe accounting that was done
+ * when each failed entry was added to the list, and records the delivery
+ * errors for later reporting.  The list is empty afterwards.
+ *
+ * \note This must be invoked with the SB lock held.
+ *
+ * \param[inout] Delivery The delivery list, after CFE_SB_DeliveryWrite()
+ * \param[inout] SBSndErr Buffer for delivery errors to be reported after unlock
+ */
+void CFE_SB_DeliveryRevert_Unsync(CFE_SB_DeliveryList_t *Delivery, CFE_SB_EventBuf_t *SBSndErr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Complete the pipe queue writes of a send
+ *
+ * Writes the delivery list, releases its route locks and, only if any write
+ * failed, takes the SB lock again to undo the accounting of the failed entries.
+ *
+ * \note This must be invoked after releasing the SB lock.
+ *
+ * \param[inout] Delivery The delivery list filled by CFE_SB_BroadcastBufferToRoute_Unsync()
+ * \param[inout] SBSndErr Buffer for delivery errors to be reported
+ */
+void CFE_SB_DeliveryComplete(CFE_SB_DeliveryList_t *Delivery, CFE_SB_EventBuf_t *SBSndErr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Record a delivery error for later reporting
+ *
+ * Entries beyond the capacity of the event buffer are dropped.
+ *
+ * \param[inout] SBSndErr Buffer for delivery errors
+ * \param[in]    MsgId    Message Id of the message being delivered
+ * \param[in]    PipeId   Pipe that could not be delivered to
+ * \param[in]    EventId  Event to report
+ * \param[in]    ErrStat  Underlying error status, if applicable
+ */
+void CFE_SB_BroadcastRecordError(CFE_SB_EventBuf_t *SBSndErr, CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                                 uint32 EventId, int32 ErrStat);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Send events for delivery errors recorded during a broadcast
+ *
+ * \note This must NOT be invoked with the SB lock held.
+ *
+ * \param[in] SBSndErr Delivery errors recorded by CFE_SB_BroadcastBufferToRoute_Unsync()
+ */
+void CFE_SB_BroadcastReportErrors(const CFE_SB_EventBuf_t *SBSndErr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -686,25 +1011,33 @@ int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **
 /**
  * \brief Add a destination node
  *
- * Private function that will add a destination node to the linked list
+ * Private function that will append a copy of the destination to the end of
+ * the destination list of the route.  The list is allocated or grown as needed,
+ * which moves all existing destinations of the route.
  *
- * \note Assumes destination pointer is valid
+ * \note Any destination pointer previously obtained for this route is invalid after this call
  *
  * \param[in] RouteId The route ID to add destination node to
- * \param[in] DestPtr Pointer to the destination to add
+ * \param[in] NewNode Pointer to the destination to add
+ *
+ * \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+ * \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
  */
-int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNode);
+int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, const CFE_SB_DestinationD_t *NewNode);
 
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Remove a destination node
  *
- * Private function that will remove a destination node from the linked list
+ * Private function that will remove a destination from the destination list
+ * of the route, moving the destinations after it down to keep the list in order.
+ * The list is returned to the pool once it is empty.
  *
- * \note Assumes destination pointer is valid and in route
+ * \note Assumes destination pointer is valid and in route.  Any destination pointer
+ *       previously obtained for this route is invalid after this call.
  *
- * \param[in] RouteId The route ID to remove destination node from
- * \param[in] DestPtr Pointer to the destination to remove
+ * \param[in] RouteId      The route ID to remove destination node from
+ * \param[in] NodeToRemove Pointer to the destination to remove
  */
 void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove);
 
@@ -712,8 +1045,8 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
 /**
  * \brief Remove a destination
  *
- * Private function that will remove a destination by removing the node,
- * returning the block, and decrementing counters
+ * Private function that will remove a destination by removing the node
+ * and decrementing counters
  *
  * \note Assumes destination pointer is valid and in route
  *
@@ -732,10 +1065,41 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
  * \param[in] RouteId The route ID to search
  * \param[in] PipeId  The pipe ID to search for
  *
+ * \note The pointer is into the destination list of the route, and is only valid
+ *       until the next subscription change on that route
+ *
  * \returns Then destination pointer for a match, NULL otherwise
  */
 CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Release the buffers retained by a pipe from the last receive
+ *
+ * Each pipe keeps a reference to the buffer(s) returned by the last call to
+ * CFE_SB_ReceiveBuffer() or CFE_SB_ReceiveBuffers(), so the application can
+ * access them until the next receive on that pipe.  This releases all of them.
+ *
+ * \note This must be invoked with the SB lock held.
+ *
+ * \param[in] PipeDscPtr Pointer to the pipe descriptor
+ */
+void CFE_SB_PipeReleaseBuffers_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Update the pipe and destination accounting for a buffer read from a pipe
+ *
+ * Decrements the destination message limit count and the pipe queue depth
+ * for a buffer which was just read from the pipe's underlying queue.
+ *
+ * \note This must be invoked with the SB lock held.
+ *
+ * \param[in] PipeDscPtr Pointer to the pipe descriptor
+ * \param[in] BufDscPtr  Pointer to the buffer descriptor that was read
+ */
+void CFE_SB_PipeDequeueUpdate_Unsync(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Get the size of a message header.
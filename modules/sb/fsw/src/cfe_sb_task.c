@@ -533,6 +533,9 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_MSG_CommandHeader_t *data)
     CFE_SB_Global.HKTlmMsg.Payload.UnmarkedMem =
         CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse;
 
+    /* Give back any cached buffers of a size that has not been used since the last HK cycle */
+    CFE_SB_BufferCacheFlush(true);
+
     CFE_SB_UnlockSharedData(__FILE__, __LINE__);
 
     CFE_SB_TimeStampMsg(&CFE_SB_Global.HKTlmMsg.Hdr.Msg);
@@ -777,6 +780,7 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
  *-----------------------------------------------------------------*/
 void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 {
+    CFE_SB_DestinationList_t *          DestList;
     CFE_SB_DestinationD_t *             DestPtr;
     CFE_SB_PipeD_t *                    PipeDscPtr;
     CFE_SB_MsgId_t                      RouteMsgId;
@@ -784,6 +788,8 @@ void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
     CFE_SB_RoutingFileEntry_t *         FileEntryPtr;
     CFE_ES_AppId_t                      DestAppId[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
     uint32                              i;
+    uint16                              DestCount;
+    uint16                              DestIdx;
 
     /* Cast arguments for local use */
     RouteBufferPtr = (CFE_SB_BackgroundRouteInfoBuffer_t *)ArgPtr;
@@ -798,11 +804,13 @@ void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
     /* If this is a valid route, get the destinations */
     if (CFE_SB_IsValidMsgId(RouteMsgId))
     {
-        DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId);
+        DestList  = CFE_SBR_GetDestList(RouteId);
+        DestCount = (DestList != NULL) ? DestList->Count : 0;
 
         /* copy relevant data from the destination list into the temp buffer */
-        while (DestPtr != NULL && RouteBufferPtr->NumDestinations < CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+        for (DestIdx = 0; DestIdx < DestCount; ++DestIdx)
         {
+            DestPtr    = &DestList->Dest[DestIdx];
             PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
 
             /* If invalid id, continue on to next entry */
@@ -822,8 +830,6 @@ void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 
                 ++RouteBufferPtr->NumDestinations;
             }
-
-            DestPtr = DestPtr->Next;
         }
     }
 
@@ -1189,8 +1195,9 @@ void CFE_SB_CollectMsgMapInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
     /* Data must be locked to snapshot the route info */
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
-    BufferPtr->MsgId = CFE_SBR_GetMsgId(RouteId);
-    BufferPtr->Index = CFE_SBR_RouteIdToValue(RouteId);
+    BufferPtr->MsgId       = CFE_SBR_GetMsgId(RouteId);
+    BufferPtr->Index       = CFE_SBR_RouteIdToValue(RouteId);
+    BufferPtr->ProbeLength = CFE_SBR_GetProbeLength(BufferPtr->MsgId);
 
     CFE_SB_UnlockSharedData(__FILE__, __LINE__);
 }
@@ -1311,14 +1318,19 @@ int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data)
  *-----------------------------------------------------------------*/
 void CFE_SB_SendRouteSub(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 {
-    CFE_SB_DestinationD_t *destptr;
-    int32                  status;
+    CFE_SB_DestinationList_t *destlist;
+    CFE_SB_DestinationD_t *   destptr;
+    uint16                    destcount;
+    uint16                    i;
+    int32                     status;
 
-    destptr = CFE_SBR_GetDestListHeadPtr(RouteId);
+    destlist  = CFE_SBR_GetDestList(RouteId);
+    destcount = (destlist != NULL) ? destlist->Count : 0;
 
     /* Loop through destinations */
-    while (destptr != NULL)
+    for (i = 0; i < destcount; ++i)
     {
+        destptr = &destlist->Dest[i];
 
         if (destptr->Scope == CFE_SB_MSG_GLOBAL)
         {
@@ -1352,9 +1364,6 @@ void CFE_SB_SendRouteSub(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
              */
             break;
         }
-
-        /* Advance to next destination */
-        destptr = destptr->Next;
     }
 }
 
@@ -172,6 +172,35 @@ void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr)
     CFE_MSG_SetMsgTime(MsgPtr, CFE_TIME_GetTime());
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TimeStampMsgs
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TimeStampMsgs(CFE_MSG_Message_t *MsgPtrs[], uint32 Count)
+{
+    CFE_TIME_SysTime_t CurrentTime;
+    uint32             i;
+
+    if (MsgPtrs == NULL || Count == 0)
+    {
+        return;
+    }
+
+    CurrentTime = CFE_TIME_GetTime();
+
+    for (i = 0; i < Count; ++i)
+    {
+        if (MsgPtrs[i] != NULL)
+        {
+            CFE_MSG_SetMsgTime(MsgPtrs[i], CurrentTime);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_MessageStringGet
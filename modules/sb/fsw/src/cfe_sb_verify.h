@@ -50,6 +50,14 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH < 1
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH < 1
+#error CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH cannot be less than 1!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -66,6 +74,22 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH < 1
+#error CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH > 0xFFFF
+#error CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_SB_ROUTE_LOCKS < 1
+#error CFE_PLATFORM_SB_ROUTE_LOCKS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_ROUTE_LOCKS > 32
+#error CFE_PLATFORM_SB_ROUTE_LOCKS cannot be greater than 32!
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
@@ -792,6 +792,7 @@ void Test_SB_Cmds_MapInfoDataGetter(void)
     CFE_UtAssert_FALSE(CFE_SB_WriteMsgMapInfoDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
     UtAssert_NOT_NULL(LocalBuffer);
     UtAssert_NONZERO(LocalBufSize);
+    UtAssert_UINT32_EQ(((CFE_SB_MsgMapFileEntry_t *)LocalBuffer)->ProbeLength, CFE_SBR_GetProbeLength(MsgId0));
 
     CFE_UtAssert_TRUE(
         CFE_SB_WriteMsgMapInfoDataGetter(&State, CFE_PLATFORM_SB_MAX_MSG_IDS, &LocalBuffer, &LocalBufSize));
@@ -1511,6 +1512,7 @@ void Test_SB_Cmds_UnexpMsgId(void)
 void Test_SB_EarlyInit(void)
 {
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_SemCreateError);
+    SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_RouteLockCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_PoolCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_NoErrors);
 } /* end Test_SB_EarlyInit */
@@ -1524,6 +1526,15 @@ void Test_SB_EarlyInit_SemCreateError(void)
     UtAssert_INT32_EQ(CFE_SB_EarlyInit(), OS_ERR_NO_FREE_IDS);
 } /* end Test_SB_EarlyInit_SemCreateError */
 
+/*
+** Test early initialization response to a route lock create failure
+*/
+void Test_SB_EarlyInit_RouteLockCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERR_NO_FREE_IDS);
+    UtAssert_INT32_EQ(CFE_SB_EarlyInit(), OS_ERR_NO_FREE_IDS);
+} /* end Test_SB_EarlyInit_RouteLockCreateError */
+
 /*
 ** Test early initialization response to a pool create ex failure
 */
@@ -2071,6 +2082,8 @@ void Test_Subscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Subscribe_DuplicateSubscription);
     SB_UT_ADD_SUBTEST(Test_Subscribe_LocalSubscription);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxDestCount);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_DestListGrowth);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_DestListGrowthErr);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxMsgIdCount);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SendPrevSubs);
     SB_UT_ADD_SUBTEST(Test_Subscribe_PipeNonexistent);
@@ -2253,6 +2266,110 @@ void Test_Subscribe_MaxDestCount(void)
 
 } /* end Test_Subscribe_MaxDestCount */
 
+/*
+** Test growing the destination list of a route, and compacting it on unsubscribe
+*/
+void Test_Subscribe_DestListGrowth(void)
+{
+    CFE_SB_PipeId_t           PipeId[CFE_SB_MIN_DEST_LIST_CAPACITY + 2];
+    CFE_SB_MsgId_t            MsgId = SB_UT_TLM_MID;
+    CFE_SBR_RouteId_t         RouteId;
+    CFE_SB_DestinationList_t *DestList;
+    char                      PipeName[OS_MAX_API_NAME];
+    uint16                    PipeDepth = 10;
+    uint32                    PipeIdx;
+    int32                     i;
+
+    for (i = 0; i < CFE_SB_MIN_DEST_LIST_CAPACITY + 2; i++)
+    {
+        snprintf(PipeName, sizeof(PipeName), "TestPipe%ld", (long)i);
+        CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId[i], PipeDepth, PipeName));
+        CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId[i]));
+    }
+
+    /* The list grew past its initial capacity, and keeps the subscription order */
+    RouteId  = CFE_SBR_GetRouteId(MsgId);
+    DestList = CFE_SBR_GetDestList(RouteId);
+    UtAssert_NOT_NULL(DestList);
+    UtAssert_UINT32_EQ(DestList->Count, CFE_SB_MIN_DEST_LIST_CAPACITY + 2);
+    UtAssert_True(DestList->Capacity >= DestList->Count, "Capacity (%u) >= Count (%u)",
+                  (unsigned int)DestList->Capacity, (unsigned int)DestList->Count);
+    for (i = 0; i < CFE_SB_MIN_DEST_LIST_CAPACITY + 2; i++)
+    {
+        CFE_UtAssert_RESOURCEID_EQ(DestList->Dest[i].PipeId, PipeId[i]);
+        CFE_UtAssert_SETUP(CFE_SB_PipeId_ToIndex(PipeId[i], &PipeIdx));
+        UtAssert_UINT32_EQ(DestList->Dest[i].PipeIdx, PipeIdx);
+    }
+
+    /* Removing from the middle moves the following destinations down */
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId[2]));
+    DestList = CFE_SBR_GetDestList(RouteId);
+    UtAssert_UINT32_EQ(DestList->Count, CFE_SB_MIN_DEST_LIST_CAPACITY + 1);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dest[1].PipeId, PipeId[1]);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dest[2].PipeId, PipeId[3]);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dest[CFE_SB_MIN_DEST_LIST_CAPACITY].PipeId,
+                               PipeId[CFE_SB_MIN_DEST_LIST_CAPACITY + 1]);
+    UtAssert_NULL(CFE_SB_GetDestPtr(RouteId, PipeId[2]));
+
+    /* Removing the last destination releases the list */
+    for (i = 0; i < CFE_SB_MIN_DEST_LIST_CAPACITY + 2; i++)
+    {
+        if (i != 2)
+        {
+            CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId[i]));
+        }
+    }
+    UtAssert_NULL(CFE_SBR_GetDestList(RouteId));
+
+    for (i = 0; i < CFE_SB_MIN_DEST_LIST_CAPACITY + 2; i++)
+    {
+        CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId[i]));
+    }
+
+} /* end Test_Subscribe_DestListGrowth */
+
+/*
+** Test failure to grow the destination list of a route
+*/
+void Test_Subscribe_DestListGrowthErr(void)
+{
+    CFE_SB_PipeId_t           PipeId[CFE_SB_MIN_DEST_LIST_CAPACITY + 1];
+    CFE_SB_MsgId_t            MsgId = SB_UT_TLM_MID;
+    CFE_SB_DestinationList_t *DestList;
+    char                      PipeName[OS_MAX_API_NAME];
+    uint16                    PipeDepth = 10;
+    int32                     i;
+
+    for (i = 0; i < CFE_SB_MIN_DEST_LIST_CAPACITY + 1; i++)
+    {
+        snprintf(PipeName, sizeof(PipeName), "TestPipe%ld", (long)i);
+        CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId[i], PipeDepth, PipeName));
+    }
+
+    for (i = 0; i < CFE_SB_MIN_DEST_LIST_CAPACITY; i++)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId[i]));
+    }
+
+    /* The list is full, so the next subscription needs a new block */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    UtAssert_INT32_EQ(CFE_SB_Subscribe(MsgId, PipeId[CFE_SB_MIN_DEST_LIST_CAPACITY]), CFE_SB_BUF_ALOC_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_DEST_BLK_ERR_EID);
+
+    /* The existing destinations are unaffected */
+    DestList = CFE_SBR_GetDestList(CFE_SBR_GetRouteId(MsgId));
+    UtAssert_UINT32_EQ(DestList->Count, CFE_SB_MIN_DEST_LIST_CAPACITY);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dest[CFE_SB_MIN_DEST_LIST_CAPACITY - 1].PipeId,
+                               PipeId[CFE_SB_MIN_DEST_LIST_CAPACITY - 1]);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse, CFE_SB_MIN_DEST_LIST_CAPACITY);
+
+    for (i = 0; i < CFE_SB_MIN_DEST_LIST_CAPACITY + 1; i++)
+    {
+        CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId[i]));
+    }
+
+} /* end Test_Subscribe_DestListGrowthErr */
+
 /*
 ** Test message subscription response to reaching the maximum message ID count
 */
@@ -2737,8 +2854,21 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_ZeroCopyBufferValidate);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_DisabledDestination);
     SB_UT_ADD_SUBTEST(Test_BroadcastBufferToRoute);
+    SB_UT_ADD_SUBTEST(Test_BroadcastRecordError_Overflow);
+    SB_UT_ADD_SUBTEST(Test_DeliveryList_Full);
+    SB_UT_ADD_SUBTEST(Test_DeliveryList_Full_WriteErr);
+    SB_UT_ADD_SUBTEST(Test_DeliveryRevert_DeletedPipe);
+    SB_UT_ADD_SUBTEST(Test_RouteLockBarrier);
+    SB_UT_ADD_SUBTEST(Test_LockRoutes);
     SB_UT_ADD_SUBTEST(Test_TransmitMsgValidate_MaxMsgSizePlusOne);
     SB_UT_ADD_SUBTEST(Test_TransmitMsgValidate_NoSubscribers);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_BasicSend);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_BadArgs);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_NoSubscribers);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_GetPoolBufErr);
+    SB_UT_ADD_SUBTEST(Test_TransmitBufferBatch);
+    SB_UT_ADD_SUBTEST(Test_TransferBuffer);
+    SB_UT_ADD_SUBTEST(Test_TransferBuffer_Errors);
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
 } /* end Test_TransmitMsg_API */
@@ -3295,7 +3425,7 @@ void Test_TransmitMsg_DisabledDestination(void)
 } /* end Test_TransmitMsg_DisabledDestination */
 
 /*
-** Test successful CFE_SB_BroadcastBufferToRoute
+** Test successful CFE_SB_BroadcastBufferToRoute_Unsync
 */
 void Test_BroadcastBufferToRoute(void)
 {
@@ -3303,7 +3433,9 @@ void Test_BroadcastBufferToRoute(void)
     CFE_SB_MsgId_t    MsgId = SB_UT_TLM_MID;
     CFE_SB_BufferD_t  SBBufD;
     int32             PipeDepth;
-    CFE_SBR_RouteId_t RouteId;
+    CFE_SBR_RouteId_t     RouteId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
 
     memset(&SBBufD, 0, sizeof(SBBufD));
     SBBufD.MsgId = MsgId;
@@ -3315,8 +3447,28 @@ void Test_BroadcastBufferToRoute(void)
 
     RouteId = CFE_SBR_GetRouteId(MsgId);
 
-    /* No return from this function - it handles all errors */
-    CFE_SB_BroadcastBufferToRoute(&SBBufD, RouteId);
+    /* The route lock is taken by the caller, before the SB lock */
+    SBSndErr.EvtsToSnd      = 0;
+    Delivery.Count          = 0;
+    Delivery.RouteLocksHeld = 0;
+    CFE_SB_LockRoutes(&Delivery, CFE_SB_RouteLockMask(MsgId));
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, CFE_SB_RouteLockMask(MsgId));
+
+    /* No return from this function - errors are recorded for later reporting */
+    CFE_SB_BroadcastBufferToRoute_Unsync(&SBBufD, RouteId, CFE_ES_APPID_UNDEFINED, &SBSndErr, &Delivery);
+    UtAssert_UINT32_EQ(SBSndErr.EvtsToSnd, 0);
+
+    /* The queue write is only set up, and the route lock held, until the delivery is completed */
+    UtAssert_UINT32_EQ(Delivery.Count, 1);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, CFE_SB_RouteLockMask(MsgId));
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_INT32_EQ(CFE_SB_LocatePipeDescByID(PipeId)->CurrentQueueDepth, 1);
+
+    CFE_SB_DeliveryComplete(&Delivery, &SBSndErr);
+    UtAssert_UINT32_EQ(Delivery.Count, 0);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, 0);
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_UINT32_EQ(SBSndErr.EvtsToSnd, 0);
 
     CFE_UtAssert_EVENTCOUNT(2);
 
@@ -3324,6 +3476,221 @@ void Test_BroadcastBufferToRoute(void)
 
 } /* end Test_BroadcastBufferToRoute */
 
+/*
+** Test that delivery errors beyond the event buffer capacity are dropped
+*/
+void Test_BroadcastRecordError_Overflow(void)
+{
+    CFE_SB_EventBuf_t SBSndErr;
+    uint32            i;
+
+    SBSndErr.EvtsToSnd = 0;
+    for (i = 0; i <= CFE_PLATFORM_SB_MAX_DEST_PER_PKT; i++)
+    {
+        CFE_SB_BroadcastRecordError(&SBSndErr, SB_UT_TLM_MID, SB_UT_PIPEID_1, CFE_SB_Q_WR_ERR_EID, OS_ERROR);
+    }
+
+    UtAssert_UINT32_EQ(SBSndErr.EvtsToSnd, CFE_PLATFORM_SB_MAX_DEST_PER_PKT);
+    UtAssert_UINT32_EQ(SBSndErr.EvtBuf[0].EventId, CFE_SB_Q_WR_ERR_EID);
+    UtAssert_INT32_EQ(SBSndErr.EvtBuf[0].ErrStat, OS_ERROR);
+
+} /* end Test_BroadcastRecordError_Overflow */
+
+/*
+** Test broadcasting when the delivery list is already full
+*/
+void Test_DeliveryList_Full(void)
+{
+    CFE_SB_PipeId_t       PipeId;
+    CFE_SB_MsgId_t        MsgId = SB_UT_TLM_MID;
+    CFE_SB_BufferD_t      SBBufD;
+    CFE_SBR_RouteId_t     RouteId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
+
+    memset(&SBBufD, 0, sizeof(SBBufD));
+    SBBufD.MsgId = MsgId;
+    CFE_SB_TrackingListReset(&SBBufD.Link);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+
+    /* As after sending many messages under one lock */
+    memset(&Delivery, 0, sizeof(Delivery));
+    Delivery.Count     = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+    SBSndErr.EvtsToSnd = 0;
+    CFE_SB_LockRoutes(&Delivery, CFE_SB_RouteLockMask(MsgId));
+
+    /* The pending writes are done first, still holding the route lock, then the new one is added */
+    CFE_SB_BroadcastBufferToRoute_Unsync(&SBBufD, RouteId, CFE_ES_APPID_UNDEFINED, &SBSndErr, &Delivery);
+    UtAssert_STUB_COUNT(OS_QueuePut, CFE_PLATFORM_SB_MAX_DEST_PER_PKT);
+    UtAssert_UINT32_EQ(Delivery.Count, 1);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, CFE_SB_RouteLockMask(MsgId));
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+
+    CFE_SB_DeliveryComplete(&Delivery, &SBSndErr);
+    UtAssert_STUB_COUNT(OS_QueuePut, CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, 0);
+    UtAssert_UINT32_EQ(SBSndErr.EvtsToSnd, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_DeliveryList_Full */
+
+/*
+** Test that a failed pending write in a full delivery list is only counted once
+*/
+void Test_DeliveryList_Full_WriteErr(void)
+{
+    CFE_SB_PipeId_t       PipeId;
+    CFE_SB_MsgId_t        MsgId = SB_UT_TLM_MID;
+    CFE_SB_BufferD_t      SBBufD;
+    CFE_SB_BufferD_t *    PrevBufDscPtr;
+    CFE_SBR_RouteId_t     RouteId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
+    uint32                i;
+
+    memset(&SBBufD, 0, sizeof(SBBufD));
+    SBBufD.MsgId = MsgId;
+    CFE_SB_TrackingListReset(&SBBufD.Link);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    RouteId       = CFE_SBR_GetRouteId(MsgId);
+    PrevBufDscPtr = CFE_SB_GetBufferFromPool(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(PrevBufDscPtr);
+    PrevBufDscPtr->MsgId = MsgId;
+
+    /* As after sending an earlier message to many pipes under one lock */
+    memset(&Delivery, 0, sizeof(Delivery));
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; ++i)
+    {
+        Delivery.Entry[i].BufDscPtr  = PrevBufDscPtr;
+        Delivery.Entry[i].PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+        Delivery.Entry[i].RouteId    = RouteId;
+        Delivery.Entry[i].PipeId     = PipeId;
+        CFE_SB_IncrBufUseCnt(PrevBufDscPtr);
+    }
+    Delivery.Count     = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+    SBSndErr.EvtsToSnd = 0;
+    CFE_SB_LockRoutes(&Delivery, CFE_SB_RouteLockMask(MsgId));
+
+    /* The failed write is counted for the earlier message only, not for the new one */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_ERROR);
+    CFE_SB_BroadcastBufferToRoute_Unsync(&SBBufD, RouteId, CFE_ES_APPID_UNDEFINED, &SBSndErr, &Delivery);
+    UtAssert_UINT32_EQ(SBSndErr.EvtsToSnd, 1);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+
+    CFE_SB_DeliveryComplete(&Delivery, &SBSndErr);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_DeliveryList_Full_WriteErr */
+
+/*
+** Test undoing a failed queue write to a pipe that was deleted after it was set up
+*/
+void Test_DeliveryRevert_DeletedPipe(void)
+{
+    CFE_SB_PipeId_t       PipeId;
+    CFE_SB_MsgId_t        MsgId = SB_UT_TLM_MID;
+    CFE_SB_BufferD_t *    BufDscPtr;
+    CFE_SBR_RouteId_t     RouteId;
+    CFE_SB_EventBuf_t     SBSndErr;
+    CFE_SB_DeliveryList_t Delivery;
+    CFE_SB_PipeD_t *      PipeDscPtr;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    RouteId    = CFE_SBR_GetRouteId(MsgId);
+    BufDscPtr  = CFE_SB_GetBufferFromPool(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(BufDscPtr);
+    BufDscPtr->MsgId = MsgId;
+
+    SBSndErr.EvtsToSnd      = 0;
+    Delivery.Count          = 0;
+    Delivery.RouteLocksHeld = 0;
+    CFE_SB_LockRoutes(&Delivery, CFE_SB_RouteLockMask(MsgId));
+    CFE_SB_BroadcastBufferToRoute_Unsync(BufDscPtr, RouteId, CFE_ES_APPID_UNDEFINED, &SBSndErr, &Delivery);
+    UtAssert_UINT32_EQ(Delivery.Count, 1);
+    UtAssert_INT32_EQ(BufDscPtr->UseCount, 1);
+
+    /* The entry is written before the pipe is deleted, but the write fails */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_ERROR);
+    UtAssert_UINT32_EQ(CFE_SB_DeliveryWrite(&Delivery), 1);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, CFE_SB_RouteLockMask(MsgId));
+    CFE_SB_UnlockRoutes(&Delivery);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, 0);
+
+    CFE_UtAssert_SETUP(CFE_SB_DeletePipe(PipeId));
+
+    /* Undoing it must not touch the deleted pipe, but still releases the buffer */
+    CFE_SB_DeliveryRevert_Unsync(&Delivery, &SBSndErr);
+    UtAssert_UINT32_EQ(Delivery.Count, 0);
+    UtAssert_INT32_EQ(BufDscPtr->UseCount, 0);
+    UtAssert_INT32_EQ(PipeDscPtr->SendErrors, 0);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    UtAssert_UINT32_EQ(SBSndErr.EvtsToSnd, 1);
+    UtAssert_UINT32_EQ(SBSndErr.EvtBuf[0].EventId, CFE_SB_Q_WR_ERR_EID);
+
+} /* end Test_DeliveryRevert_DeletedPipe */
+
+/*
+** Test waiting for the queue writes in progress
+*/
+void Test_RouteLockBarrier(void)
+{
+    CFE_SB_RouteLockBarrier();
+
+    UtAssert_STUB_COUNT(OS_MutSemTake, CFE_PLATFORM_SB_ROUTE_LOCKS);
+    UtAssert_STUB_COUNT(OS_MutSemGive, CFE_PLATFORM_SB_ROUTE_LOCKS);
+
+    /* Lock errors are only logged */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_SEM_FAILURE);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, OS_SEM_FAILURE);
+    CFE_SB_RouteLockBarrier();
+
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2 * CFE_PLATFORM_SB_ROUTE_LOCKS);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
+
+} /* end Test_RouteLockBarrier */
+
+/*
+** Test taking the route locks of several messages
+*/
+void Test_LockRoutes(void)
+{
+    CFE_SB_DeliveryList_t Delivery;
+    uint32                LockMask;
+    uint32                LockCount;
+
+    /* Consecutive message IDs use different locks, unless there is only one */
+    LockMask  = CFE_SB_RouteLockMask(SB_UT_TLM_MID) | CFE_SB_RouteLockMask(SB_UT_TLM_MID1);
+    LockCount = (CFE_PLATFORM_SB_ROUTE_LOCKS > 1) ? 2 : 1;
+
+    Delivery.RouteLocksHeld = 0;
+    CFE_SB_LockRoutes(&Delivery, LockMask);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, LockMask);
+    UtAssert_STUB_COUNT(OS_MutSemTake, LockCount);
+
+    /* A lock already held by the list is not taken again */
+    CFE_SB_LockRoutes(&Delivery, CFE_SB_RouteLockMask(SB_UT_TLM_MID));
+    UtAssert_STUB_COUNT(OS_MutSemTake, LockCount);
+
+    CFE_SB_UnlockRoutes(&Delivery);
+    UtAssert_UINT32_EQ(Delivery.RouteLocksHeld, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, LockCount);
+
+} /* end Test_LockRoutes */
+
 /*
 ** Test response to sending a message with the message size larger than allowed
 */
@@ -3334,13 +3701,11 @@ void Test_TransmitMsgValidate_MaxMsgSizePlusOne(void)
     SB_UT_Test_Tlm_t  TlmPkt;
     CFE_MSG_Size_t    Size = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
     CFE_MSG_Size_t    SizeRtn;
-    CFE_SBR_RouteId_t RouteIdRtn;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
-    UtAssert_INT32_EQ(CFE_SB_TransmitMsgValidate(&TlmPkt.Hdr.Msg, &MsgIdRtn, &SizeRtn, &RouteIdRtn),
-                      CFE_SB_MSG_TOO_BIG);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgValidate(&TlmPkt.Hdr.Msg, &MsgIdRtn, &SizeRtn), CFE_SB_MSG_TOO_BIG);
     CFE_UtAssert_MSGID_EQ(MsgIdRtn, MsgId);
     UtAssert_INT32_EQ(SizeRtn, Size);
 
@@ -3364,15 +3729,345 @@ void Test_TransmitMsgValidate_NoSubscribers(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
-    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgValidate(&TlmPkt.Hdr.Msg, &MsgIdRtn, &SizeRtn, &RouteIdRtn));
+    /* Validation only checks the header, having no subscribers is not an error */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgValidate(&TlmPkt.Hdr.Msg, &MsgIdRtn, &SizeRtn));
     CFE_UtAssert_MSGID_EQ(MsgIdRtn, MsgId);
     UtAssert_INT32_EQ(SizeRtn, Size);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* The route lookup counts the message as having no subscribers */
+    CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter = 0;
+    RouteIdRtn = CFE_SB_TransmitMsgGetRoute_Unsync(MsgIdRtn);
     CFE_UtAssert_FALSE(CFE_SBR_IsValidRouteId(RouteIdRtn));
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 1);
+}
+
+/*
+** Test successfully sending a batch of messages on the software bus
+*/
+void Test_TransmitMsgBatch_BasicSend(void)
+{
+    CFE_SB_PipeId_t    PipeId;
+    CFE_SB_MsgId_t     MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t   TlmPkt[3];
+    CFE_MSG_Message_t *MsgPtrs[3];
+    int32              PipeDepth = 5;
+    CFE_SB_MsgId_t     MsgIds[6];
+    CFE_MSG_Size_t     Sizes[6];
+    CFE_MSG_Type_t     Types[3];
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    uint32             i;
+
+    /* The header of each message is read once for validation and once for sending */
+    for (i = 0; i < 6; ++i)
+    {
+        MsgIds[i] = MsgId;
+        Sizes[i]  = sizeof(SB_UT_Test_Tlm_t);
+    }
+    for (i = 0; i < 3; ++i)
+    {
+        MsgPtrs[i] = &TlmPkt[i].Hdr.Msg;
+        Types[i]   = CFE_MSG_Type_Tlm;
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIds, sizeof(MsgIds), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), Types, sizeof(Types), false);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgBatch(MsgPtrs, 3, true));
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_INT32_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 0);
+
+    CFE_UtAssert_EVENTCOUNT(2);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsgBatch_BasicSend */
+
+/*
+** Test response to sending a batch with invalid arguments or an invalid message
+*/
+void Test_TransmitMsgBatch_BadArgs(void)
+{
+    CFE_SB_PipeId_t    PipeId;
+    CFE_SB_MsgId_t     MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t   TlmPkt;
+    CFE_MSG_Message_t *MsgPtrs[2];
+    int32              PipeDepth = 5;
+    CFE_SB_MsgId_t     MsgIds[2];
+    CFE_MSG_Size_t     Sizes[2];
+    CFE_SB_PipeD_t *   PipeDscPtr;
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(NULL, 1, true), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(MsgPtrs, 0, true), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(MsgPtrs, CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH + 1, true),
+                      CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_EVENTCOUNT(3);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    /* A NULL entry fails the whole batch, without taking any route locks */
+    MsgPtrs[0] = NULL;
+    MsgPtrs[1] = &TlmPkt.Hdr.Msg;
+    UT_ClearEventHistory();
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(MsgPtrs, 2, true), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    /* Only the SB lock, to count the error */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+    /* If the second message is invalid, the first is not sent either */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    MsgPtrs[0] = &TlmPkt.Hdr.Msg;
+    MsgIds[0]  = MsgId;
+    MsgIds[1]  = MsgId;
+    Sizes[0]   = sizeof(TlmPkt);
+    Sizes[1]   = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIds, sizeof(MsgIds), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+    UT_ClearEventHistory();
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(MsgPtrs, 2, true), CFE_SB_MSG_TOO_BIG);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_INT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 45);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MSG_TOO_BIG_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsgBatch_BadArgs */
+
+/*
+** Test response to sending a batch of messages which have no subscribers
+*/
+void Test_TransmitMsgBatch_NoSubscribers(void)
+{
+    CFE_SB_MsgId_t     MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t   TlmPkt[2];
+    CFE_MSG_Message_t *MsgPtrs[2];
+    CFE_SB_MsgId_t     MsgIds[4] = {MsgId, MsgId, MsgId, MsgId};
+    CFE_MSG_Size_t     Sizes[4]  = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t),
+                               sizeof(SB_UT_Test_Tlm_t)};
+
+    MsgPtrs[0] = &TlmPkt[0].Hdr.Msg;
+    MsgPtrs[1] = &TlmPkt[1].Hdr.Msg;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIds, sizeof(MsgIds), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgBatch(MsgPtrs, 2, true));
+
+    /* Both are counted, but only one event is sent for the batch */
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 2);
 
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
-}
+
+} /* end Test_TransmitMsgBatch_NoSubscribers */
+
+/*
+** Test getting a pool buffer error while sending a batch of messages
+*/
+void Test_TransmitMsgBatch_GetPoolBufErr(void)
+{
+    CFE_SB_PipeId_t    PipeId;
+    CFE_SB_MsgId_t     MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t   TlmPkt[2];
+    CFE_MSG_Message_t *MsgPtrs[2];
+    int32              PipeDepth = 5;
+    CFE_SB_MsgId_t     MsgIds[4] = {MsgId, MsgId, MsgId, MsgId};
+    CFE_MSG_Size_t     Sizes[4]  = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t),
+                               sizeof(SB_UT_Test_Tlm_t)};
+    CFE_MSG_Type_t     Type      = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeD_t *   PipeDscPtr;
+
+    MsgPtrs[0] = &TlmPkt[0].Hdr.Msg;
+    MsgPtrs[1] = &TlmPkt[1].Hdr.Msg;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "GetPoolErrPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIds, sizeof(MsgIds), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    /* Allocation fails for the first message only, the second is still sent */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(MsgPtrs, 2, true), CFE_SB_BUF_ALOC_ERR);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_INT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+
+    CFE_UtAssert_EVENTCOUNT(3);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_GET_BUF_ERR_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsgBatch_GetPoolBufErr */
+
+/*
+** Test sending a batch of buffers in zero copy mode
+*/
+void Test_TransmitBufferBatch(void)
+{
+    CFE_SB_Buffer_t * SendPtrs[2];
+    CFE_SB_Buffer_t * ReceivePtr = NULL;
+    CFE_SB_PipeId_t   PipeId;
+    CFE_SB_MsgId_t    MsgId     = SB_UT_TLM_MID;
+    uint32            PipeDepth = 10;
+    CFE_SB_Buffer_t * DupPtrs[2];
+    CFE_SB_MsgId_t    MsgIds[4] = {MsgId, MsgId, MsgId, MsgId};
+    CFE_MSG_Size_t    Sizes[4]  = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t),
+                               sizeof(SB_UT_Test_Tlm_t)};
+    CFE_MSG_Type_t    Types[4]  = {CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm};
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "ZeroCpyBatchPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    SendPtrs[0] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    SendPtrs[1] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(SendPtrs[0]);
+    UtAssert_NOT_NULL(SendPtrs[1]);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIds, sizeof(MsgIds), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), Types, sizeof(Types), false);
+
+    /* Bad arguments do not consume anything */
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(NULL, 2, true), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(SendPtrs, 0, true), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(SendPtrs, CFE_PLATFORM_SB_MAX_TRANSMIT_BATCH + 1, true),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    /* The same buffer listed twice fails the whole batch, and is still owned by the app */
+    DupPtrs[0] = SendPtrs[0];
+    DupPtrs[1] = SendPtrs[0];
+    UT_ClearEventHistory();
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(DupPtrs, 2, true), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+    BufDscPtr = (CFE_SB_BufferD_t *)((cpuaddr)SendPtrs[0] - CFE_SB_BUFFERD_CONTENT_OFFSET);
+    UtAssert_UINT32_EQ(BufDscPtr->UseCount, 1);
+
+    /* An invalid buffer fails the whole batch, and the valid buffer is still owned by the app */
+    BufDscPtr        = (CFE_SB_BufferD_t *)((cpuaddr)SendPtrs[1] - CFE_SB_BUFFERD_CONTENT_OFFSET);
+    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(SendPtrs, 2, true), CFE_SB_BUFFER_INVALID);
+    BufDscPtr->AppId = ((CFE_SB_BufferD_t *)((cpuaddr)SendPtrs[0] - CFE_SB_BUFFERD_CONTENT_OFFSET))->AppId;
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 5);
+
+    /* Test a successful zero copy batch send */
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferBatch(SendPtrs, 2, true));
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ADDRESS_EQ(SendPtrs[0], ReceivePtr);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ADDRESS_EQ(SendPtrs[1], ReceivePtr);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitBufferBatch */
+
+/*
+** Test sending a zero copy buffer with the header composed in place by SB
+*/
+void Test_TransferBuffer(void)
+{
+    CFE_SB_Buffer_t *SendPtr    = NULL;
+    CFE_SB_Buffer_t *ReceivePtr = NULL;
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId     = SB_UT_TLM_MID;
+    uint32           PipeDepth = 10;
+    CFE_MSG_Size_t   Size      = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TransferTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(SendPtr);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransferBuffer(SendPtr, MsgId, sizeof(SB_UT_Test_Tlm_t), true));
+
+    /* The header is composed, and a telemetry message is time stamped */
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 1);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ADDRESS_EQ(SendPtr, ReceivePtr);
+
+    CFE_UtAssert_EVENTCOUNT(2);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransferBuffer */
+
+/*
+** Test sending a zero copy buffer with the header composed in place, with invalid arguments
+*/
+void Test_TransferBuffer_Errors(void)
+{
+    CFE_SB_Buffer_t *SendPtr = NULL;
+    CFE_MSG_Type_t   Type[3] = {CFE_MSG_Type_Tlm, CFE_MSG_Type_Cmd, CFE_MSG_Type_Tlm};
+
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(SendPtr);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), Type, sizeof(Type), false);
+
+    UtAssert_INT32_EQ(CFE_SB_TransferBuffer(NULL, SB_UT_TLM_MID, sizeof(SB_UT_Test_Tlm_t), true),
+                      CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransferBuffer(SendPtr, CFE_SB_INVALID_MSG_ID, sizeof(SB_UT_Test_Tlm_t), true),
+                      CFE_SB_BAD_ARGUMENT);
+
+    /* Larger than allocated */
+    UtAssert_INT32_EQ(CFE_SB_TransferBuffer(SendPtr, SB_UT_TLM_MID, sizeof(SB_UT_Test_Tlm_t) + 1, true),
+                      CFE_SB_MSG_TOO_BIG);
+
+    /* Smaller than the header */
+    UtAssert_INT32_EQ(CFE_SB_TransferBuffer(SendPtr, SB_UT_CMD_MID, sizeof(CFE_MSG_CommandHeader_t) - 1, true),
+                      CFE_SB_BAD_ARGUMENT);
+
+    /* Header composition failure */
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_Init), 1, CFE_MSG_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransferBuffer(SendPtr, SB_UT_TLM_MID, sizeof(SB_UT_Test_Tlm_t), true),
+                      CFE_SB_BAD_ARGUMENT);
+
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 0);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 5);
+
+    CFE_UtAssert_EVENTCOUNT(5);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_INV_MSGID_EID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MSG_TOO_BIG_EID);
+
+    /* The application still owns the buffer */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(SendPtr));
+
+} /* end Test_TransferBuffer_Errors */
 
 /*
 ** Function for calling SB receive message API test functions
@@ -3386,6 +4081,10 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_Empty);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_Batch);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_DeletePipe);
 } /* end Test_ReceiveBuffer_API */
 
 /*
@@ -3605,6 +4304,200 @@ void Test_ReceiveBuffer_InvalidBufferPtr(void)
 
 } /* end Test_ReceiveBuffer_InvalidBufferPtr */
 
+/*
+** Test receiving a batch of messages with invalid arguments
+*/
+void Test_ReceiveBuffers_InvalidArgs(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_PipeId_t  InvalidPipeId = SB_UT_ALTERNATE_INVALID_PIPEID;
+    uint32           PipeDepth     = 10;
+    uint32           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(NULL, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, 4, NULL, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, 0, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, 4, &Count, PipeId, -5), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+
+    UT_ClearEventHistory();
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, 4, &Count, InvalidPipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 5);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBuffers_InvalidArgs */
+
+/*
+** Test receiving a batch of messages from a pipe with nothing on it
+*/
+void Test_ReceiveBuffers_Empty(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_PipeId_t  PipeId;
+    uint32           PipeDepth = 10;
+    uint32           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+
+    /* Poll */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    /* Timeout */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, 4, &Count, PipeId, 200), CFE_SB_TIME_OUT);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    /* Pipe read error */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    CFE_UtAssert_EVENTCOUNT(2);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBuffers_Empty */
+
+/*
+** Helper to send two zero copy buffers and stage their descriptors as the
+** contents of the pipe queue, for the batch receive tests
+*/
+static void UT_SB_SetupReceiveBatch(CFE_SB_PipeId_t PipeId, CFE_SB_Buffer_t *SendPtrs[2],
+                                    CFE_SB_BufferD_t *BufDscPtrs[2])
+{
+    CFE_SB_MsgId_t MsgId[2] = {SB_UT_TLM_MID, SB_UT_TLM_MID};
+    CFE_MSG_Size_t Size[2]  = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t)};
+    CFE_MSG_Type_t Type[2]  = {CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm};
+    uint32         i;
+
+    /* Distinct pool blocks are needed, so each buffer has its own descriptor */
+    static union
+    {
+        CFE_ES_PoolAlign_t Align;
+        uint8              Bytes[2048];
+    } PoolBuf;
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), PoolBuf.Bytes, sizeof(PoolBuf), false);
+
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId[0], PipeId));
+
+    for (i = 0; i < 2; ++i)
+    {
+        SendPtrs[i] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+        UtAssert_NOT_NULL(SendPtrs[i]);
+        CFE_UtAssert_SETUP(CFE_SB_ZeroCopyBufferValidate(SendPtrs[i], &BufDscPtrs[i]));
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), true);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), true);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), Type, sizeof(Type), true);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitBufferBatch(SendPtrs, 2, true));
+
+    /* Both descriptors are pending on the queue, then it is empty */
+    UT_SetDataBuffer(UT_KEY(OS_QueueGet), BufDscPtrs, 2 * sizeof(CFE_SB_BufferD_t *), true);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 3, OS_QUEUE_EMPTY);
+}
+
+/*
+** Test receiving a batch of messages, and releasing it on the next receive
+*/
+void Test_ReceiveBuffers_Batch(void)
+{
+    CFE_SB_Buffer_t * SBBufPtrs[4];
+    CFE_SB_Buffer_t * SendPtrs[2];
+    CFE_SB_BufferD_t *BufDscPtrs[2];
+    CFE_SB_Buffer_t * SBBufPtr;
+    CFE_SB_PipeId_t   PipeId;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    uint32            PipeDepth = 10;
+    uint32            Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    UT_SB_SetupReceiveBatch(PipeId, SendPtrs, BufDscPtrs);
+    UtAssert_INT32_EQ(PipeDscPtr->CurrentQueueDepth, 2);
+    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 2);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_ADDRESS_EQ(SBBufPtrs[0], SendPtrs[0]);
+    UtAssert_ADDRESS_EQ(SBBufPtrs[1], SendPtrs[1]);
+    UtAssert_INT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_INT32_EQ(PipeDscPtr->LastBatchCount, 2);
+    UtAssert_INT32_EQ(BufDscPtrs[0]->UseCount, 1);
+    UtAssert_INT32_EQ(BufDscPtrs[1]->UseCount, 1);
+
+    /* A single receive on the same pipe releases the whole batch */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_INT32_EQ(PipeDscPtr->LastBatchCount, 0);
+    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    CFE_UtAssert_EVENTCOUNT(2);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBuffers_Batch */
+
+/*
+** Test that deleting a pipe releases the last batch received on it
+*/
+void Test_ReceiveBuffers_DeletePipe(void)
+{
+    CFE_SB_Buffer_t * SBBufPtrs[4];
+    CFE_SB_Buffer_t * SendPtrs[2];
+    CFE_SB_BufferD_t *BufDscPtrs[2];
+    CFE_SB_PipeId_t   PipeId;
+    uint32            PipeDepth = 10;
+    uint32            Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+
+    UT_SB_SetupReceiveBatch(PipeId, SendPtrs, BufDscPtrs);
+
+    /* Only part of the batch is taken by this call */
+    UT_ResetState(UT_KEY(OS_QueueGet));
+    UT_SetDataBuffer(UT_KEY(OS_QueueGet), BufDscPtrs, 2 * sizeof(CFE_SB_BufferD_t *), true);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, 1, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_ADDRESS_EQ(SBBufPtrs[0], SendPtrs[0]);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, 1, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_ADDRESS_EQ(SBBufPtrs[0], SendPtrs[1]);
+    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_DeletePipe(PipeId));
+    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+} /* end Test_ReceiveBuffers_DeletePipe */
+
 /*
 ** Test SB Utility APIs
 */
@@ -3613,6 +4506,7 @@ void Test_SB_Utils(void)
     SB_UT_ADD_SUBTEST(Test_CFE_SB_MsgHdrSize);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_GetUserData);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_SetGetUserDataLength);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_TimeStampMsgs);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_ValidateMsgId);
 } /* end Test_SB_Utils */
 
@@ -3767,6 +4661,31 @@ void Test_CFE_SB_SetGetUserDataLength(void)
 
 } /* end Util_CFE_SB_SetGetUserDataLength */
 
+/*
+** Test time stamping a group of messages
+*/
+void Test_CFE_SB_TimeStampMsgs(void)
+{
+    CFE_MSG_Message_t  msg[2];
+    CFE_MSG_Message_t *MsgPtrs[3];
+
+    MsgPtrs[0] = &msg[0];
+    MsgPtrs[1] = NULL;
+    MsgPtrs[2] = &msg[1];
+
+    /* Nothing to stamp */
+    CFE_SB_TimeStampMsgs(NULL, 3);
+    CFE_SB_TimeStampMsgs(MsgPtrs, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 0);
+
+    /* Time is read once, NULL entries are skipped */
+    CFE_SB_TimeStampMsgs(MsgPtrs, 3);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 2);
+
+} /* end Test_CFE_SB_TimeStampMsgs */
+
 /*
 ** Test validating a msg id
 */
@@ -3792,6 +4711,7 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_ReqToSendEvent_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_PutDestBlk_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_Buffers);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_BufferCache);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_BadPipeInfo);
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_Nominal);
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_LimitErr);
@@ -3898,7 +4818,7 @@ void Test_CFE_SB_Buffers(void)
 
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse = 0;
-    CFE_SB_PutDestinationBlk((CFE_SB_DestinationD_t *)bd);
+    CFE_SB_PutDestinationBlk((CFE_SB_DestinationList_t *)bd);
 
     UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, 0);
 
@@ -3906,6 +4826,85 @@ void Test_CFE_SB_Buffers(void)
 
 } /* end Test_CFE_SB_Buffers */
 
+/*
+** Test the caching of released buffers for reuse
+*/
+void Test_CFE_SB_BufferCache(void)
+{
+    CFE_SB_BufferD_t *    bd1;
+    CFE_SB_BufferD_t *    bd2;
+    CFE_SB_BufferCache_t *CachePtr;
+    uint32                i;
+
+    /* First allocation of a size comes from the pool */
+    bd1 = CFE_SB_GetBufferFromPool(10);
+    UtAssert_NOT_NULL(bd1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufferCacheHits, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufferCacheMisses, 1);
+    CachePtr = CFE_SB_BufferCacheLookup(bd1->AllocatedSize);
+    UtAssert_NOT_NULL(CachePtr);
+
+    /* Releasing it puts it in the cache, rather than the pool */
+    CFE_SB_DecrBufUseCnt(bd1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_UINT32_EQ(CachePtr->Count, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, 0);
+
+    /* The next allocation of the same size reuses it */
+    bd2 = CFE_SB_GetBufferFromPool(10);
+    UtAssert_ADDRESS_EQ(bd2, bd1);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_UINT32_EQ(CachePtr->Count, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufferCacheHits, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufferCacheMisses, 1);
+    UtAssert_UINT32_EQ(bd2->UseCount, 1);
+
+    /* A buffer still owned by an app is not cached */
+    CFE_ES_GetAppID(&bd2->AppId);
+    UtAssert_True(!CFE_SB_BufferCachePut(bd2), "CFE_SB_BufferCachePut() owned buffer not cached");
+    bd2->AppId = CFE_ES_APPID_UNDEFINED;
+
+    /* A buffer larger than the cached sizes is not cached */
+    bd1 = CFE_SB_GetBufferFromPool(CFE_PLATFORM_SB_BUFFER_CACHE_MAX_BLOCK_SIZE);
+    UtAssert_NOT_NULL(bd1);
+    UtAssert_NULL(CFE_SB_BufferCacheLookup(bd1->AllocatedSize));
+    UtAssert_True(!CFE_SB_BufferCachePut(bd1), "CFE_SB_BufferCachePut() large buffer not cached");
+    CFE_SB_ReturnBufferToPool(bd1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    /* Fill the cache up, then it should not take any more */
+    for (i = 0; i < CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH; ++i)
+    {
+        UtAssert_True(CFE_SB_BufferCachePut(bd2), "CFE_SB_BufferCachePut() buffer cached");
+    }
+    UtAssert_True(!CFE_SB_BufferCachePut(bd2), "CFE_SB_BufferCachePut() full cache");
+
+    /* A pool allocation failure gives back the cached buffers and retries */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    bd1 = CFE_SB_GetBufferFromPool(100);
+    UtAssert_NOT_NULL(bd1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1 + CFE_PLATFORM_SB_BUFFER_CACHE_DEPTH);
+    UtAssert_UINT32_EQ(CachePtr->Count, 0);
+
+    /* If nothing is cached, the failure is not retried */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_GetBufferFromPool(100));
+
+    /* Trimming only gives back buffers of a size that was not reused */
+    CachePtr = CFE_SB_BufferCacheLookup(bd1->AllocatedSize);
+    UtAssert_True(CFE_SB_BufferCachePut(bd1), "CFE_SB_BufferCachePut() buffer cached");
+    UtAssert_ADDRESS_EQ(CFE_SB_GetBufferFromPool(100), bd1);
+    UtAssert_True(CFE_SB_BufferCachePut(bd1), "CFE_SB_BufferCachePut() buffer cached");
+    UtAssert_UINT32_EQ(CFE_SB_BufferCacheFlush(true), 0);
+    UtAssert_UINT32_EQ(CachePtr->Count, 1);
+    UtAssert_UINT32_EQ(CFE_SB_BufferCacheFlush(true), 1);
+    UtAssert_UINT32_EQ(CachePtr->Count, 0);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+
+} /* end Test_CFE_SB_BufferCache */
+
 /*
 ** Test internal function to get the pipe table index for the given pipe ID
 */
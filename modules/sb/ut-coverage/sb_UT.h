@@ -1047,6 +1047,22 @@ void Test_SB_EarlyInit(void);
 ******************************************************************************/
 void Test_SB_EarlyInit_SemCreateError(void);
 
+/*****************************************************************************/
+/**
+** \brief Test early initialization response to a route lock create failure
+**
+** \par Description
+**        This function tests the early initialization response to a route
+**        lock create failure.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_EarlyInit_RouteLockCreateError(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test early initialization response to a pool create ex failure
@@ -1434,6 +1450,39 @@ void Test_Subscribe_LocalSubscription(void);
 ******************************************************************************/
 void Test_Subscribe_MaxDestCount(void);
 
+/*****************************************************************************/
+/**
+** \brief Test growing and compacting the destination list of a route
+**
+** \par Description
+**        This function tests that the destination list of a route grows as
+**        pipes subscribe, keeps the subscription order, and closes the gap
+**        left by an unsubscribe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_DestListGrowth(void);
+
+/*****************************************************************************/
+/**
+** \brief Test failure to grow the destination list of a route
+**
+** \par Description
+**        This function tests the message subscription response to a memory
+**        pool failure when the destination list of the route is full.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_DestListGrowthErr(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test message subscription response to reaching the maximum
@@ -1986,7 +2035,7 @@ void Test_TransmitMsg_DisabledDestination(void);
 
 /*****************************************************************************/
 /**
-** \brief Test CFE_SB_BroadcastBufferToRoute
+** \brief Test CFE_SB_BroadcastBufferToRoute_Unsync
 **
 ** \par Description
 **        This function tests broadcasting a message buffer with the metadata.
@@ -1999,6 +2048,102 @@ void Test_TransmitMsg_DisabledDestination(void);
 ******************************************************************************/
 void Test_BroadcastBufferToRoute(void);
 
+/*****************************************************************************/
+/**
+** \brief Test that delivery errors beyond the event buffer capacity are dropped
+**
+** \par Description
+**        This function tests recording more delivery errors than the event
+**        buffer can hold.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_BroadcastRecordError_Overflow(void);
+
+/*****************************************************************************/
+/**
+** \brief Test broadcasting when the delivery list is already full
+**
+** \par Description
+**        This function tests that the pending queue writes are done before
+**        another one is added to a full delivery list.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeliveryList_Full(void);
+
+/*****************************************************************************/
+/**
+** \brief Test a failed pending write when the delivery list is full
+**
+** \par Description
+**        This function tests that a failed write of an earlier message, done
+**        when the delivery list is full, is only counted as one send error.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeliveryList_Full_WriteErr(void);
+
+/*****************************************************************************/
+/**
+** \brief Test undoing a failed queue write to a deleted pipe
+**
+** \par Description
+**        This function tests that undoing a failed queue write releases the
+**        buffer, without updating a pipe that was deleted meanwhile.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeliveryRevert_DeletedPipe(void);
+
+/*****************************************************************************/
+/**
+** \brief Test waiting for the queue writes in progress
+**
+** \par Description
+**        This function tests taking and releasing every route lock, and the
+**        response to lock errors.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_RouteLockBarrier(void);
+
+/*****************************************************************************/
+/**
+** \brief Test taking the route locks of several messages
+**
+** \par Description
+**        This function tests that each route lock is taken once per delivery
+**        list, and released when the list is done.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_LockRoutes(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test response to sending a message which has no subscribers
@@ -2032,6 +2177,117 @@ void Test_TransmitMsgValidate_NoSubscribers(void);
 ******************************************************************************/
 void Test_TransmitMsgValidate_MaxMsgSizePlusOne(void);
 
+/*****************************************************************************/
+/**
+** \brief Test successfully sending a batch of messages
+**
+** \par Description
+**        This function tests successfully sending a batch of messages.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_BasicSend(void);
+
+/*****************************************************************************/
+/**
+** \brief Test response to sending a batch with invalid arguments
+**
+** \par Description
+**        This function tests sending a batch with invalid arguments or
+**        an invalid message.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_BadArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test response to sending a batch of messages with no subscribers
+**
+** \par Description
+**        This function tests sending a batch of messages which have no
+**        subscribers.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_NoSubscribers(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting a pool buffer error while sending a batch
+**
+** \par Description
+**        This function tests the response to a buffer allocation failure
+**        while sending a batch of messages.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_GetPoolBufErr(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending a batch of buffers in zero copy mode
+**
+** \par Description
+**        This function tests sending a batch of zero copy buffers.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitBufferBatch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending a zero copy buffer with the header composed by SB
+**
+** \par Description
+**        This function tests composing the header in place in a zero copy
+**        buffer and sending it.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransferBuffer(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending a zero copy buffer with the header composed by SB,
+**        with invalid arguments
+**
+** \par Description
+**        This function tests the response to an invalid buffer, message ID
+**        or size, and to a failure composing the header.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransferBuffer_Errors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB receive message API test functions
@@ -2160,6 +2416,70 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving a batch of messages with invalid arguments
+**
+** \par Description
+**        This function tests the batch receive response to null pointers, a zero
+**        maximum count, an invalid timeout, and an invalid pipe ID.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving a batch of messages from an empty pipe
+**
+** \par Description
+**        This function tests the batch receive response to a poll, a timeout,
+**        and a pipe read error when no message is available.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_Empty(void);
+
+/*****************************************************************************/
+/**
+** \brief Test successfully receiving a batch of messages
+**
+** \par Description
+**        This function tests receiving all pending messages in one call, and
+**        that the batch is released by the next receive on the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_Batch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test deleting a pipe holding a received batch
+**
+** \par Description
+**        This function tests that deleting a pipe releases the buffers from the
+**        last batch received on that pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_DeletePipe(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -2240,6 +2560,21 @@ void Test_CFE_SB_GetUserData(void);
 ******************************************************************************/
 void Test_CFE_SB_SetGetUserDataLength(void);
 
+/*****************************************************************************/
+/**
+** \brief Test time stamping a group of messages
+**
+** \par Description
+**        This function tests setting the time of a group of messages.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_TimeStampMsgs(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test validating a valid and invalid msg id
@@ -2334,6 +2669,22 @@ void Test_PutDestBlk_ErrLogic(void);
 ******************************************************************************/
 void Test_CFE_SB_Buffers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the SB buffer caches
+**
+** \par Description
+**        This function tests that released buffers are cached and reused,
+**        and are given back to the SB buffer pool when needed.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_BufferCache(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test functions that involve bad pipe information
@@ -107,3 +107,16 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     return routeid;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_GetProbeLength
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_SBR_GetProbeLength(CFE_SB_MsgId_t MsgId)
+{
+    /* Direct lookup never probes */
+    return 0;
+}
@@ -183,3 +183,39 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     return routeid;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_GetProbeLength
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_SBR_GetProbeLength(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SBR_RouteId_t   routeid;
+    uint16              probelength = 0;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        hash    = CFE_SBR_MsgIdHash(MsgId);
+        routeid = CFE_SBR_MSGMAP[hash];
+
+        /* Same walk as CFE_SBR_GetRouteId, counting the slots passed */
+        while (CFE_SBR_IsValidRouteId(routeid) && !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId))
+        {
+            /* Increment or loop to start of array */
+            hash    = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            routeid = CFE_SBR_MSGMAP[hash];
+            ++probelength;
+        }
+
+        if (!CFE_SBR_IsValidRouteId(routeid))
+        {
+            probelength = 0;
+        }
+    }
+
+    return probelength;
+}
@@ -0,0 +1,327 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/******************************************************************************
+ * Robin Hood hash routing map implementation
+ *
+ * The message id is stored in the map alongside the route id, so a lookup
+ * only reads the map itself and never the routing table.  On insert, an
+ * entry that is further from its hashed slot than the one occupying a slot
+ * takes that slot over, which keeps the probe lengths of all entries close
+ * to each other and lets a lookup stop as soon as it passes the point where
+ * the key would have been placed.
+ *
+ * Notes:
+ *   These functions manipulate/access global variables and need
+ *   to be protected by the SB Shared data lock.
+ *
+ */
+
+/*
+ * Include Files
+ */
+
+#include "common_types.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include "cfe_sb.h"
+
+#include <string.h>
+
+/*
+ * Macro Definitions
+ */
+
+/**
+ * \brief Message map size
+ *
+ * Robin Hood displacement keeps probe lengths short at higher load than
+ * plain linear probing, so the map only needs to be twice the maximum
+ * number of routes.  Note the multiple must be a factor of 2 to use the
+ * efficient mask logic, and can't be bigger than what can be indexed by
+ * CFE_SB_MsgId_Atom_t
+ */
+#define CFE_SBR_MSG_MAP_SIZE (2 * CFE_PLATFORM_SB_MAX_MSG_IDS)
+
+/* Verify power of two */
+#if ((CFE_SBR_MSG_MAP_SIZE & (CFE_SBR_MSG_MAP_SIZE - 1)) != 0)
+#error CFE_SBR_MSG_MAP_SIZE must be a power of 2 for hash algorithm to work
+#endif
+
+/** \brief Hash algorithm magic number
+ *
+ * Ref:
+ * https://stackoverflow.com/questions/664014/what-integer-hash-function-are-good-that-accepts-an-integer-hash-key/12996028#12996028
+ */
+#define CFE_SBR_HASH_MAGIC (0x45d9f3b)
+
+/******************************************************************************
+ * Type Definitions
+ */
+
+/** \brief Message map entry, an empty slot has an invalid route id */
+typedef struct
+{
+    CFE_SB_MsgId_t    MsgId;       /**< \brief Message id key, stored inline */
+    CFE_SBR_RouteId_t RouteId;     /**< \brief Route id associated with the message id */
+    uint16            ProbeLength; /**< \brief Distance from the hashed slot of the message id */
+} CFE_SBR_MapEntry_t;
+
+/******************************************************************************
+ * Shared data
+ */
+
+/** \brief Message map shared data */
+CFE_SBR_MapEntry_t CFE_SBR_MSGMAP[CFE_SBR_MSG_MAP_SIZE];
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_MsgIdHash
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Hashes the message id
+ *
+ * Note: algorithm designed for a 32 bit int, changing the size of
+ * CFE_SB_MsgId_Atom_t may require an update to this impelementation
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_MsgId_Atom_t CFE_SBR_MsgIdHash(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+
+    hash = CFE_SB_MsgIdToValue(MsgId);
+
+    hash = ((hash >> 16) ^ hash) * CFE_SBR_HASH_MAGIC;
+    hash = ((hash >> 16) ^ hash) * CFE_SBR_HASH_MAGIC;
+    hash = (hash >> 16) ^ hash;
+
+    /* Reduce to fit in map */
+    hash &= CFE_SBR_MSG_MAP_SIZE - 1;
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_FindMapEntry
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Returns the map entry for the message id, or NULL if not mapped
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_MapEntry_t *CFE_SBR_FindMapEntry(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SBR_MapEntry_t *entryptr;
+    uint16              probelength;
+
+    hash        = CFE_SBR_MsgIdHash(MsgId);
+    entryptr    = &CFE_SBR_MSGMAP[hash];
+    probelength = 0;
+
+    /*
+     * Entries are ordered by distance from their hashed slot, so once an entry
+     * is closer to its own slot than the key would be, the key is not in the map.
+     * Since map is larger than possible routes this will never deadlock
+     */
+    while (CFE_SBR_IsValidRouteId(entryptr->RouteId) && entryptr->ProbeLength >= probelength)
+    {
+        if (CFE_SB_MsgId_Equal(entryptr->MsgId, MsgId))
+        {
+            return entryptr;
+        }
+
+        /* Increment or loop to start of array */
+        hash     = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        entryptr = &CFE_SBR_MSGMAP[hash];
+        ++probelength;
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_RemoveMapEntry
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Removes the entry, moving back the entries displaced past it so
+ * no tombstone is needed and lookups stay as short as before
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_RemoveMapEntry(CFE_SBR_MapEntry_t *EntryPtr)
+{
+    CFE_SB_MsgId_Atom_t index;
+    CFE_SBR_MapEntry_t *nextptr;
+
+    index = EntryPtr - CFE_SBR_MSGMAP;
+
+    index   = (index + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+    nextptr = &CFE_SBR_MSGMAP[index];
+
+    /* Shift back until an empty slot or an entry already in its hashed slot */
+    while (CFE_SBR_IsValidRouteId(nextptr->RouteId) && nextptr->ProbeLength > 0)
+    {
+        *EntryPtr = *nextptr;
+        --EntryPtr->ProbeLength;
+
+        EntryPtr = nextptr;
+        index    = (index + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        nextptr  = &CFE_SBR_MSGMAP[index];
+    }
+
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_Init_Map
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_Init_Map(void)
+{
+    /* Clear the shared data */
+    memset(&CFE_SBR_MSGMAP, 0, sizeof(CFE_SBR_MSGMAP));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_SetRouteId
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SBR_MapEntry_t  newentry;
+    CFE_SBR_MapEntry_t  swapentry;
+    CFE_SBR_MapEntry_t *entryptr;
+    uint32              collisions = 0;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        entryptr = CFE_SBR_FindMapEntry(MsgId);
+
+        if (!CFE_SBR_IsValidRouteId(RouteId))
+        {
+            /* An invalid route id removes the message id from the map */
+            if (entryptr != NULL)
+            {
+                CFE_SBR_RemoveMapEntry(entryptr);
+            }
+        }
+        else if (entryptr != NULL)
+        {
+            /* Already mapped, only the route changes */
+            entryptr->RouteId = RouteId;
+        }
+        else
+        {
+            newentry.MsgId       = MsgId;
+            newentry.RouteId     = RouteId;
+            newentry.ProbeLength = 0;
+
+            hash     = CFE_SBR_MsgIdHash(MsgId);
+            entryptr = &CFE_SBR_MSGMAP[hash];
+
+            /*
+             * Increment from original hash to find the next open slot, taking
+             * over any slot whose entry is closer to its own hashed slot and
+             * carrying that entry on instead.  Since map is larger than
+             * possible routes this will never deadlock
+             */
+            while (CFE_SBR_IsValidRouteId(entryptr->RouteId))
+            {
+                if (entryptr->ProbeLength < newentry.ProbeLength)
+                {
+                    swapentry = *entryptr;
+                    *entryptr = newentry;
+                    newentry  = swapentry;
+                }
+
+                /* Increment or loop to start of array */
+                hash     = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+                entryptr = &CFE_SBR_MSGMAP[hash];
+                ++newentry.ProbeLength;
+                collisions++;
+            }
+
+            *entryptr = newentry;
+        }
+    }
+
+    return collisions;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_GetRouteId
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_MapEntry_t *entryptr;
+    CFE_SBR_RouteId_t   routeid = CFE_SBR_INVALID_ROUTE_ID;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        entryptr = CFE_SBR_FindMapEntry(MsgId);
+        if (entryptr != NULL)
+        {
+            routeid = entryptr->RouteId;
+        }
+    }
+
+    return routeid;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_GetProbeLength
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_SBR_GetProbeLength(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_MapEntry_t *entryptr;
+    uint16              probelength = 0;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        entryptr = CFE_SBR_FindMapEntry(MsgId);
+        if (entryptr != NULL)
+        {
+            probelength = entryptr->ProbeLength;
+        }
+    }
+
+    return probelength;
+}
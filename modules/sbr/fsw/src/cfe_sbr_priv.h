@@ -50,6 +50,10 @@ void CFE_SBR_Init_Map(void);
  * Used for implementations that use a mapping table (typically hash or direct)
  * and need this information to later get the route id from the message id.
  *
+ * Passing #CFE_SBR_INVALID_ROUTE_ID removes the message ID from the map
+ * for the direct and Robin Hood implementations.  The linear probing hash
+ * implementation does not support removal.
+ *
  * \note Typically not needed for a search implementation.  Assumes
  *       message ID is valid
  *
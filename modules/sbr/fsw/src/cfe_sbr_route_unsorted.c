@@ -47,9 +47,9 @@
 /** \brief Routing table entry */
 typedef struct
 {
-    CFE_SB_DestinationD_t * ListHeadPtr; /**< \brief Destination list head */
-    CFE_SB_MsgId_t          MsgId;       /**< \brief Message ID associated with route */
-    CFE_MSG_SequenceCount_t SeqCnt;      /**< \brief Message sequence counter */
+    CFE_SB_DestinationList_t *DestList; /**< \brief Destination list */
+    CFE_SB_MsgId_t            MsgId;    /**< \brief Message ID associated with route */
+    CFE_MSG_SequenceCount_t   SeqCnt;   /**< \brief Message sequence counter */
 } CFE_SBR_RouteEntry_t;
 
 /** \brief Module data */
@@ -140,37 +140,37 @@ CFE_SB_MsgId_t CFE_SBR_GetMsgId(CFE_SBR_RouteId_t RouteId)
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_SBR_GetDestListHeadPtr
+ * Function: CFE_SBR_GetDestList
  *
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId)
+CFE_SB_DestinationList_t *CFE_SBR_GetDestList(CFE_SBR_RouteId_t RouteId)
 {
 
-    CFE_SB_DestinationD_t *destptr = NULL;
+    CFE_SB_DestinationList_t *destlist = NULL;
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        destptr = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].ListHeadPtr;
+        destlist = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].DestList;
     }
 
-    return destptr;
+    return destlist;
 }
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_SBR_SetDestListHeadPtr
+ * Function: CFE_SBR_SetDestList
  *
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
+void CFE_SBR_SetDestList(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationList_t *DestList)
 {
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].ListHeadPtr = DestPtr;
+        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].DestList = DestList;
     }
 }
 
@@ -0,0 +1,221 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * Test SBR Robin Hood message map implementation
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Defines
+ */
+
+/* Unhash magic number */
+#define CFE_SBR_UNHASH_MAGIC (0x119de1f3)
+
+/* Number of lookups timed at each occupancy level */
+#define TEST_SBR_PERF_LOOKUPS 0xFFFF
+
+/******************************************************************************
+ * Local helper to unhash
+ */
+CFE_SB_MsgId_t Test_SBR_Unhash(CFE_SB_MsgId_Atom_t Hash)
+{
+
+    Hash = ((Hash >> 16) ^ Hash) * CFE_SBR_UNHASH_MAGIC;
+    Hash = ((Hash >> 16) ^ Hash) * CFE_SBR_UNHASH_MAGIC;
+    Hash = (Hash >> 16) ^ Hash;
+
+    return CFE_SB_ValueToMsgId(Hash);
+}
+
+void Test_SBR_Map_RobinHood(void)
+{
+
+    CFE_SB_MsgId_Atom_t msgidx;
+    CFE_SBR_RouteId_t   routeid[3];
+    CFE_SB_MsgId_t      msgid[3];
+    uint32              count;
+
+    UtPrintf("Invalid msg checks");
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(CFE_SB_ValueToMsgId(0), CFE_SBR_ValueToRouteId(0)), 0);
+    CFE_UtAssert_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(0))));
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(CFE_SB_ValueToMsgId(0)), 0);
+
+    UtPrintf("Initialize routing and map");
+    CFE_SBR_Init();
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Check that all entries are set invalid");
+    count = 0;
+    for (msgidx = 0; msgidx <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID; msgidx++)
+    {
+        if (!CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(msgidx))))
+        {
+            count++;
+        }
+    }
+    UtAssert_INT32_EQ(count, CFE_PLATFORM_SB_HIGHEST_VALID_MSGID + 1);
+
+    /*
+     * msgid[0] hashes to the first slot, msgid[1] and msgid[2] both hash to the
+     * last slot.  msgid[2] wraps into the first slot, which is closer to the hashed
+     * slot of msgid[0] than to its own, so it takes the slot and msgid[0] moves on.
+     */
+    UtPrintf("Add ids with a rollover and a displacement");
+    msgid[0]   = Test_SBR_Unhash(0);
+    msgid[1]   = Test_SBR_Unhash(0xFFFFFFFF);
+    msgid[2]   = Test_SBR_Unhash(0x7FFFFFFF);
+    routeid[0] = CFE_SBR_ValueToRouteId(0);
+    routeid[1] = CFE_SBR_ValueToRouteId(1);
+    routeid[2] = CFE_SBR_ValueToRouteId(2);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[0], routeid[0]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[1], routeid[1]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[2], routeid[2]), 2);
+
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[0]).RouteId, routeid[0].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[1]).RouteId, routeid[1].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(msgid[0]), 1);
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(msgid[1]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(msgid[2]), 1);
+
+    UtPrintf("Not found, stopping at an entry closer to its hashed slot");
+    CFE_UtAssert_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(Test_SBR_Unhash(0x3FFFFFFF))));
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(Test_SBR_Unhash(0x3FFFFFFF)), 0);
+
+    UtPrintf("Update the route of a mapped id");
+    routeid[0] = CFE_SBR_ValueToRouteId(3);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[0], routeid[0]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[0]).RouteId, routeid[0].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(msgid[0]), 1);
+
+    UtPrintf("Remove an id, the following entries move back to their hashed slots");
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[1], CFE_SBR_INVALID_ROUTE_ID), 0);
+    CFE_UtAssert_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[1])));
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[0]).RouteId, routeid[0].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(msgid[0]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_GetProbeLength(msgid[2]), 0);
+
+    UtPrintf("Remove an id that is not mapped");
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[1], CFE_SBR_INVALID_ROUTE_ID), 0);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[0]).RouteId, routeid[0].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+
+    UtPrintf("Remove the remaining ids");
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[0], CFE_SBR_INVALID_ROUTE_ID), 0);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[2], CFE_SBR_INVALID_ROUTE_ID), 0);
+    CFE_UtAssert_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[0])));
+    CFE_UtAssert_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[2])));
+}
+
+void Test_SBR_Map_RobinHood_Perf(void)
+{
+    CFE_SB_MsgId_t msgid[CFE_PLATFORM_SB_MAX_MSG_IDS];
+    uint32         occupancy;
+    uint32         numids;
+    uint32         count;
+    uint32         totalprobe;
+    uint32         maxprobe;
+    uint32         probelength;
+    uint32         i;
+    clock_t        start;
+    clock_t        elapsed;
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    /* Occupancy is the percentage of the maximum number of routes in use */
+    for (occupancy = 25; occupancy <= 100; occupancy += 25)
+    {
+        CFE_SBR_Init_Map();
+        numids = (CFE_PLATFORM_SB_MAX_MSG_IDS * occupancy) / 100;
+
+        /* Use distinct random ids, as ids actually in use are not evenly spaced */
+        srand(occupancy);
+        for (i = 0; i < numids; i++)
+        {
+            do
+            {
+                msgid[i] = CFE_SB_ValueToMsgId(rand() % (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID + 1));
+            } while (CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[i])));
+
+            CFE_SBR_SetRouteId(msgid[i], CFE_SBR_ValueToRouteId(i));
+        }
+
+        totalprobe = 0;
+        maxprobe   = 0;
+        for (i = 0; i < numids; i++)
+        {
+            probelength = CFE_SBR_GetProbeLength(msgid[i]);
+            totalprobe += probelength;
+            if (probelength > maxprobe)
+            {
+                maxprobe = probelength;
+            }
+        }
+
+        /* Half the lookups hit a mapped id, the rest are most likely misses */
+        count = 0;
+        start = clock();
+        for (i = 0; i < TEST_SBR_PERF_LOOKUPS; i++)
+        {
+            if ((i & 1) == 0)
+            {
+                count += CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[(i >> 1) % numids]));
+            }
+            else
+            {
+                count += CFE_SBR_IsValidRouteId(
+                    CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(rand() % (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID + 1))));
+            }
+        }
+        elapsed = clock() - start;
+
+        UtAssert_True(count >= (TEST_SBR_PERF_LOOKUPS + 1) / 2, "All mapped ids found (%u hits)", (unsigned int)count);
+
+        UtPrintf("Occupancy %u%% (%u ids): probe length mean %u.%02u max %u, %u lookups in %lu usec",
+                 (unsigned int)occupancy, (unsigned int)numids, (unsigned int)(totalprobe / numids),
+                 (unsigned int)(((totalprobe % numids) * 100) / numids), (unsigned int)maxprobe,
+                 (unsigned int)TEST_SBR_PERF_LOOKUPS, (unsigned long)((elapsed * 1000000) / CLOCKS_PER_SEC));
+    }
+}
+
+/* Main unit test routine */
+void UtTest_Setup(void)
+{
+    UT_Init("map_robinhood");
+    UtPrintf("Software Bus Routing Robin Hood map coverage test...");
+
+    UT_ADD_TEST(Test_SBR_Map_RobinHood);
+    UT_ADD_TEST(Test_SBR_Map_RobinHood_Perf);
+}
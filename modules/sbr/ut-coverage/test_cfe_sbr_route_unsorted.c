@@ -115,13 +115,13 @@ void Test_SBR_Route_Unsort_General(void)
 void Test_SBR_Route_Unsort_GetSet(void)
 {
 
-    CFE_SB_RouteId_Atom_t   routeidx;
-    CFE_SB_MsgId_t          msgid[3];
-    CFE_SBR_RouteId_t       routeid[3];
-    CFE_SB_DestinationD_t   dest[2];
-    CFE_MSG_SequenceCount_t seqcntexpected[] = {1, 2};
-    uint32                  count;
-    uint32                  i;
+    CFE_SB_RouteId_Atom_t    routeidx;
+    CFE_SB_MsgId_t           msgid[3];
+    CFE_SBR_RouteId_t        routeid[3];
+    CFE_SB_DestinationList_t dest[2];
+    CFE_MSG_SequenceCount_t  seqcntexpected[] = {1, 2};
+    uint32                   count;
+    uint32                   i;
 
     UtPrintf("Invalid route ID checks");
     routeid[0] = CFE_SBR_INVALID_ROUTE_ID;
@@ -129,7 +129,7 @@ void Test_SBR_Route_Unsort_GetSet(void)
     for (i = 0; i < 2; i++)
     {
         CFE_UtAssert_TRUE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[i]), CFE_SB_INVALID_MSG_ID));
-        UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[i]), NULL);
+        UtAssert_ADDRESS_EQ(CFE_SBR_GetDestList(routeid[i]), NULL);
         UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[i]), 0);
     }
 
@@ -149,7 +149,7 @@ void Test_SBR_Route_Unsort_GetSet(void)
     {
         routeid[0] = CFE_SBR_ValueToRouteId(routeidx);
         if (!CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[0]), CFE_SB_INVALID_MSG_ID) ||
-            (CFE_SBR_GetDestListHeadPtr(routeid[0]) != NULL) || (CFE_SBR_GetSequenceCounter(routeid[0]) != 0))
+            (CFE_SBR_GetDestList(routeid[0]) != NULL) || (CFE_SBR_GetSequenceCounter(routeid[0]) != 0))
         {
             count++;
         }
@@ -180,16 +180,16 @@ void Test_SBR_Route_Unsort_GetSet(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), seqcntexpected[1]);
     CFE_SBR_IncrementSequenceCounter(routeid[1]);
     UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 4);
-    CFE_SBR_SetDestListHeadPtr(routeid[1], &dest[1]);
-    CFE_SBR_SetDestListHeadPtr(routeid[2], &dest[0]);
+    CFE_SBR_SetDestList(routeid[1], &dest[1]);
+    CFE_SBR_SetDestList(routeid[2], &dest[0]);
 
     UtPrintf("Verify remaining set values");
     UtAssert_UINT32_EQ(CFE_SBR_GetSequenceCounter(routeid[0]), seqcntexpected[0]);
     UtAssert_UINT32_EQ(CFE_SBR_GetSequenceCounter(routeid[1]), seqcntexpected[1]);
     UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[2]), 0);
-    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[0]), NULL);
-    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[1]), &dest[1]);
-    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[2]), &dest[0]);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestList(routeid[0]), NULL);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestList(routeid[1]), &dest[1]);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestList(routeid[2]), &dest[0]);
 }
 
 /* Main unit test routine */
@@ -308,6 +308,10 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* Save the size of the table */
                     RegRecPtr->Size = Size;
 
+                    /* The first load goes into the active buffer, so the other buffer must be fully copied later */
+                    CFE_TBL_MarkBufferDirty(&RegRecPtr->Buffers[0], 0, Size);
+                    CFE_TBL_MarkBufferDirty(&RegRecPtr->Buffers[1], 0, Size);
+
                     /* Save the Callback function pointer */
                     RegRecPtr->ValidationFuncPtr = TblValidationFuncPtr;
 
@@ -325,6 +329,16 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                         RegRecPtr->DumpOnly = false;
                     }
 
+                    /* Set the "Changed Copy" flag to value based upon selected option */
+                    if ((TblOptionFlags & CFE_TBL_OPT_COPY_MSK) == CFE_TBL_OPT_CHANGED_COPY)
+                    {
+                        RegRecPtr->ChangedCopy = true;
+                    }
+                    else
+                    {
+                        RegRecPtr->ChangedCopy = false;
+                    }
+
                     /* Initialize the Table Access Descriptor */
                     AccessDescPtr = &CFE_TBL_Global.Handles[*TblHandlePtr];
 
@@ -346,6 +360,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     AccessDescPtr->NextLink = CFE_TBL_END_OF_LIST; /* We are the end of the list */
 
                     AccessDescPtr->UsedFlag = true;
+                    CFE_TBL_UpdateHandleIndex(*TblHandlePtr);
 
                     /* Make sure the Table Registry entry points to First Access Descriptor */
                     RegRecPtr->HeadOfAccessList = *TblHandlePtr;
@@ -477,6 +492,9 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* to share the table or get its address because registry entries that */
                     /* are unowned are not checked to see if they match names, etc.        */
                     RegRecPtr->OwnerAppId = ThisAppId;
+
+                    /* Now that it is owned, the table can be found by name */
+                    CFE_TBL_UpdateRegistryIndex(RegIndx);
                 }
             }
         }
@@ -566,6 +584,7 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
 
                 AccessDescPtr->RegIndex = RegIndx;
                 AccessDescPtr->UsedFlag = true;
+                CFE_TBL_UpdateHandleIndex(*TblHandlePtr);
 
                 AccessDescPtr->PrevLink = CFE_TBL_END_OF_LIST; /* We are the new head of the list */
                 AccessDescPtr->NextLink = RegRecPtr->HeadOfAccessList;
@@ -787,6 +806,7 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
             break;
         case CFE_TBL_SRC_ADDRESS:
             /* When the source is a block of memory, it is assumed to be a complete load */
+            CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 0, RegRecPtr->Size);
             memcpy(WorkingBufferPtr->BufferPtr, (uint8 *)SrcDataPtr, RegRecPtr->Size);
 
             snprintf(WorkingBufferPtr->DataSource, sizeof(WorkingBufferPtr->DataSource), "Addr 0x%08lX",
@@ -829,6 +849,7 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
                                        (unsigned int)Status, RegRecPtr->Name);
 
             /* Zero out the buffer to remove any bad data */
+            CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 0, RegRecPtr->Size);
             memset(WorkingBufferPtr->BufferPtr, 0, RegRecPtr->Size);
         }
     }
@@ -878,7 +899,7 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
         /* If the table is a critical table, update the appropriate CDS with the new data */
         if (RegRecPtr->CriticalTable == true)
         {
-            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr, 0, RegRecPtr->Size);
         }
 
         Status = CFE_SUCCESS;
@@ -1138,6 +1159,87 @@ CFE_Status_t CFE_TBL_ReleaseAddresses(uint16 NumTables, const CFE_TBL_Handle_t T
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_SnapshotAddress
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_SnapshotAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    int32                       Status;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
+
+    if (TblPtr == NULL)
+    {
+        return CFE_TBL_BAD_ARGUMENT;
+    }
+
+    /* Assume failure at returning the table address */
+    *TblPtr = NULL;
+
+    /*
+     * Unlike CFE_TBL_GetAddress(), the caller is not looked up through ES,
+     * as that requires the ES lock.  The handle is only checked for validity,
+     * so it is up to the caller to only use handles it owns.
+     */
+    Status = CFE_TBL_ValidateHandle(TblHandle);
+
+    if (Status == CFE_SUCCESS)
+    {
+        AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
+        RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+        /* If table is unowned, then owner must have unregistered it when we weren't looking */
+        if (CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED))
+        {
+            Status = CFE_TBL_ERR_UNREGISTERED;
+        }
+        else
+        {
+            /* Lock the table and return the current pointer */
+            *TblPtr = CFE_TBL_LockActiveBuffer(AccessDescPtr, RegRecPtr);
+
+            /* Return any pending warning or info status indicators */
+            Status = CFE_TBL_GetNextNotification(TblHandle);
+
+            /* Clear Table Updated Notify Bit so that caller only gets it once */
+            AccessDescPtr->Updated = false;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_ReleaseSnapshot
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_ReleaseSnapshot(CFE_TBL_Handle_t TblHandle)
+{
+    int32 Status;
+
+    Status = CFE_TBL_ValidateHandle(TblHandle);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Clear the lock flag */
+        CFE_TBL_Global.Handles[TblHandle].LockFlag = false;
+
+        /* Return any pending warning or info status indicators */
+        Status = CFE_TBL_GetNextNotification(TblHandle);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_Validate
@@ -1531,7 +1633,7 @@ CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
         /* If the table is a critical table, update the appropriate CDS with the new data */
         if (RegRecPtr->CriticalTable == true)
         {
-            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr, 0, RegRecPtr->Size);
         }
 
         /* Keep a record of change for the ground operators reference */
@@ -1542,6 +1644,12 @@ CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
         RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc = CFE_ES_CalculateCRC(
             RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
 
+        /* Any part of the table may have changed, so the inactive buffer has to be fully copied for the next load */
+        if (RegRecPtr->DoubleBuffered)
+        {
+            CFE_TBL_MarkBufferDirty(&RegRecPtr->Buffers[1U - RegRecPtr->ActiveBufferIndex], 0, RegRecPtr->Size);
+        }
+
         FilenameLen = strlen(RegRecPtr->LastFileLoaded);
         if (FilenameLen < (sizeof(RegRecPtr->LastFileLoaded) - 4))
         {
@@ -68,6 +68,9 @@ int32 CFE_TBL_EarlyInit(void)
         CFE_TBL_Global.Handles[i].NextLink = CFE_TBL_END_OF_LIST;
     }
 
+    /* Every registry record and access descriptor starts out free */
+    CFE_TBL_InitRegistryIndex();
+
     /* Initialize the Table Validation Results Records nonzero values */
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS; i++)
     {
@@ -342,6 +345,10 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
 
     /* Return the Access Descriptor to the pool */
     AccessDescPtr->UsedFlag = false;
+    CFE_TBL_UpdateHandleIndex(TblHandle);
+
+    /* The registry record becomes free once it has no owner and no access descriptors */
+    CFE_TBL_UpdateRegistryIndex(AccessDescPtr->RegIndex);
 
     /* If this was the last Access Descriptor for this table, we can free the memory buffers as well */
     if (RegRecPtr->HeadOfAccessList == CFE_TBL_END_OF_LIST)
@@ -433,14 +440,7 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_
             else /* Table Registry Entry is valid */
             {
                 /* Lock the table and return the current pointer */
-                AccessDescPtr->LockFlag = true;
-
-                /* Save the buffer we are using in the access descriptor */
-                /* This is used to ensure that if the buffer becomes inactive while */
-                /* we are using it, no one will modify it until we are done */
-                AccessDescPtr->BufferIndex = RegRecPtr->ActiveBufferIndex;
-
-                *TblPtr = RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
+                *TblPtr = CFE_TBL_LockActiveBuffer(AccessDescPtr, RegRecPtr);
 
                 /* Return any pending warning or info status indicators */
                 Status = CFE_TBL_GetNextNotification(TblHandle);
@@ -464,6 +464,37 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_LockActiveBuffer
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void *CFE_TBL_LockActiveBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr, const CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    uint32 UpdateCount;
+
+    /*
+     * Save the buffer we are using in the access descriptor.
+     * This is used to ensure that if the buffer becomes inactive while
+     * we are using it, no one will modify it until we are done.
+     *
+     * If the table was updated while doing so, the buffer may have been
+     * reused before the lock was seen, so do it again.  This repeats at most
+     * once per update, and never waits on the task doing the update.
+     */
+    do
+    {
+        UpdateCount                = RegRecPtr->UpdateCount;
+        AccessDescPtr->LockFlag    = true;
+        AccessDescPtr->BufferIndex = RegRecPtr->ActiveBufferIndex;
+    } while (UpdateCount != RegRecPtr->UpdateCount);
+
+    return RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_GetNextNotification
@@ -502,25 +533,16 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
  *-----------------------------------------------------------------*/
 int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i       = -1;
+    int16 RegIndx = CFE_TBL_Global.RegistryIndex.BucketHead[CFE_TBL_HashTableName(TblName)];
 
-    do
+    /* Walk the records filed under the same name bucket.  The owner is checked as well, */
+    /* because an owner releases a table before the name index is brought up to date    */
+    while ((RegIndx != CFE_TBL_NOT_FOUND) &&
+           (CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[RegIndx].OwnerAppId, CFE_TBL_NOT_OWNED) ||
+            (strcmp(TblName, CFE_TBL_Global.Registry[RegIndx].Name) != 0)))
     {
-        /* Point to next record in the Table Registry */
-        i++;
-
-        /* Check to see if the record is currently being used */
-        if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED))
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
-        }
-    } while ((RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1)));
+        RegIndx = CFE_TBL_Global.RegistryIndex.NextInBucket[RegIndx];
+    }
 
     return RegIndx;
 }
@@ -535,21 +557,37 @@ int16 CFE_TBL_FindTableInRegistry(const char *TblName)
  *-----------------------------------------------------------------*/
 int16 CFE_TBL_FindFreeRegistryEntry(void)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i       = 0;
+    uint32 * MaskPtr  = CFE_TBL_Global.RegistryIndex.FreeRegistryMask;
+    int16    RegIndx  = CFE_TBL_NOT_FOUND;
+    uint32   WordIndx = 0;
+    uint32   BitIndx;
 
-    while ((RegIndx == CFE_TBL_NOT_FOUND) && (i < CFE_PLATFORM_TBL_MAX_NUM_TABLES))
+    while ((RegIndx == CFE_TBL_NOT_FOUND) && (WordIndx < CFE_TBL_FREE_MASK_WORDS(CFE_PLATFORM_TBL_MAX_NUM_TABLES)))
     {
-        /* A Table Registry is only "Free" when there isn't an owner AND */
-        /* all other applications are not sharing or locking the table   */
-        if (CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED) &&
-            (CFE_TBL_Global.Registry[i].HeadOfAccessList == CFE_TBL_END_OF_LIST))
+        if (MaskPtr[WordIndx] == 0)
         {
-            RegIndx = i;
+            WordIndx++;
         }
         else
         {
-            i++;
+            /* Take the lowest free entry, to hand out entries in the same order as a linear search */
+            BitIndx = 0;
+            while ((MaskPtr[WordIndx] & ((uint32)1 << BitIndx)) == 0)
+            {
+                BitIndx++;
+            }
+
+            RegIndx = (WordIndx * CFE_TBL_FREE_MASK_BITS) + BitIndx;
+
+            /* A Table Registry is only "Free" when there isn't an owner AND */
+            /* all other applications are not sharing or locking the table   */
+            if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[RegIndx].OwnerAppId, CFE_TBL_NOT_OWNED) ||
+                (CFE_TBL_Global.Registry[RegIndx].HeadOfAccessList != CFE_TBL_END_OF_LIST))
+            {
+                /* The mask is out of date for this entry, drop it and keep looking */
+                MaskPtr[WordIndx] &= ~((uint32)1 << BitIndx);
+                RegIndx = CFE_TBL_NOT_FOUND;
+            }
         }
     }
 
@@ -566,24 +604,179 @@ int16 CFE_TBL_FindFreeRegistryEntry(void)
  *-----------------------------------------------------------------*/
 CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void)
 {
+    uint32 *         MaskPtr    = CFE_TBL_Global.RegistryIndex.FreeHandleMask;
     CFE_TBL_Handle_t HandleIndx = CFE_TBL_END_OF_LIST;
-    int16            i          = 0;
+    uint32           WordIndx   = 0;
+    uint32           BitIndx;
 
-    while ((HandleIndx == CFE_TBL_END_OF_LIST) && (i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES))
+    while ((HandleIndx == CFE_TBL_END_OF_LIST) &&
+           (WordIndx < CFE_TBL_FREE_MASK_WORDS(CFE_PLATFORM_TBL_MAX_NUM_HANDLES)))
     {
-        if (CFE_TBL_Global.Handles[i].UsedFlag == false)
+        if (MaskPtr[WordIndx] == 0)
         {
-            HandleIndx = i;
+            WordIndx++;
         }
         else
         {
-            i++;
+            /* Take the lowest free descriptor, to hand out handles in the same order as a linear search */
+            BitIndx = 0;
+            while ((MaskPtr[WordIndx] & ((uint32)1 << BitIndx)) == 0)
+            {
+                BitIndx++;
+            }
+
+            HandleIndx = (WordIndx * CFE_TBL_FREE_MASK_BITS) + BitIndx;
+
+            if (CFE_TBL_Global.Handles[HandleIndx].UsedFlag)
+            {
+                /* The mask is out of date for this descriptor, drop it and keep looking */
+                MaskPtr[WordIndx] &= ~((uint32)1 << BitIndx);
+                HandleIndx = CFE_TBL_END_OF_LIST;
+            }
         }
     }
 
     return HandleIndx;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_HashTableName
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_TBL_HashTableName(const char *TblName)
+{
+    uint32 Hash = 2166136261UL;
+
+    while (*TblName != '\0')
+    {
+        Hash ^= (uint8)*TblName;
+        Hash *= 16777619UL;
+        TblName++;
+    }
+
+    return Hash % CFE_TBL_NAME_INDEX_BUCKETS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_InitRegistryIndex
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_InitRegistryIndex(void)
+{
+    int32 i;
+
+    memset(&CFE_TBL_Global.RegistryIndex, 0, sizeof(CFE_TBL_Global.RegistryIndex));
+
+    for (i = 0; i < CFE_TBL_NAME_INDEX_BUCKETS; i++)
+    {
+        CFE_TBL_Global.RegistryIndex.BucketHead[i] = CFE_TBL_NOT_FOUND;
+    }
+
+    /* Filed in reverse, so each bucket lists its records from the lowest index up */
+    for (i = CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1; i >= 0; i--)
+    {
+        CFE_TBL_Global.RegistryIndex.NextInBucket[i] = CFE_TBL_NOT_FOUND;
+        CFE_TBL_Global.RegistryIndex.Bucket[i]       = CFE_TBL_NOT_FOUND;
+        CFE_TBL_UpdateRegistryIndex(i);
+    }
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
+    {
+        CFE_TBL_UpdateHandleIndex(i);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_UpdateRegistryIndex
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_UpdateRegistryIndex(int16 RegIndx)
+{
+    CFE_TBL_RegistryIndex_t *IndexPtr  = &CFE_TBL_Global.RegistryIndex;
+    CFE_TBL_RegistryRec_t *  RegRecPtr = &CFE_TBL_Global.Registry[RegIndx];
+    int16 *                  LinkPtr;
+    int16                    Bucket = CFE_TBL_NOT_FOUND;
+    uint32                   FreeBit;
+
+    /* Only tables with an owner can be found by name */
+    if (!CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED) && (RegRecPtr->Name[0] != '\0'))
+    {
+        Bucket = CFE_TBL_HashTableName(RegRecPtr->Name);
+    }
+
+    if (IndexPtr->Bucket[RegIndx] != Bucket)
+    {
+        /* Unlink the record from the bucket it was previously filed under */
+        if (IndexPtr->Bucket[RegIndx] != CFE_TBL_NOT_FOUND)
+        {
+            LinkPtr = &IndexPtr->BucketHead[IndexPtr->Bucket[RegIndx]];
+            while (*LinkPtr != RegIndx)
+            {
+                LinkPtr = &IndexPtr->NextInBucket[*LinkPtr];
+            }
+
+            *LinkPtr = IndexPtr->NextInBucket[RegIndx];
+        }
+
+        /* The record is linked before it becomes the head of the bucket, so that a */
+        /* name search running without the registry lock always ends on a valid chain */
+        if (Bucket != CFE_TBL_NOT_FOUND)
+        {
+            IndexPtr->NextInBucket[RegIndx] = IndexPtr->BucketHead[Bucket];
+            IndexPtr->BucketHead[Bucket]    = RegIndx;
+        }
+
+        IndexPtr->Bucket[RegIndx] = Bucket;
+    }
+
+    /* A Table Registry is only "Free" when there isn't an owner AND */
+    /* all other applications are not sharing or locking the table   */
+    FreeBit = (uint32)1 << (RegIndx % CFE_TBL_FREE_MASK_BITS);
+    if (CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED) &&
+        (RegRecPtr->HeadOfAccessList == CFE_TBL_END_OF_LIST))
+    {
+        IndexPtr->FreeRegistryMask[RegIndx / CFE_TBL_FREE_MASK_BITS] |= FreeBit;
+    }
+    else
+    {
+        IndexPtr->FreeRegistryMask[RegIndx / CFE_TBL_FREE_MASK_BITS] &= ~FreeBit;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_UpdateHandleIndex
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_UpdateHandleIndex(CFE_TBL_Handle_t TblHandle)
+{
+    uint32 FreeBit = (uint32)1 << (TblHandle % CFE_TBL_FREE_MASK_BITS);
+
+    if (CFE_TBL_Global.Handles[TblHandle].UsedFlag)
+    {
+        CFE_TBL_Global.RegistryIndex.FreeHandleMask[TblHandle / CFE_TBL_FREE_MASK_BITS] &= ~FreeBit;
+    }
+    else
+    {
+        CFE_TBL_Global.RegistryIndex.FreeHandleMask[TblHandle / CFE_TBL_FREE_MASK_BITS] |= FreeBit;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_FormTableName
@@ -760,6 +953,10 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                     *WorkingBufferPtr                 = &CFE_TBL_Global.LoadBuffs[i];
                     RegRecPtr->LoadInProgress         = i;
 
+                    /* Shared buffers may hold anything, so all of the table must be copied into it */
+                    CFE_TBL_Global.LoadBuffs[i].DirtyOffset = 0;
+                    CFE_TBL_Global.LoadBuffs[i].DirtyBytes  = RegRecPtr->Size;
+
                     /* Translate OS_SUCCESS into CFE_SUCCESS */
                     Status = CFE_SUCCESS;
                 }
@@ -778,8 +975,20 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                 (*WorkingBufferPtr)->BufferPtr != RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr)
             {
                 /* In case the file contains a partial table load, get the active buffer contents first */
-                memcpy((*WorkingBufferPtr)->BufferPtr, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
-                       RegRecPtr->Size);
+                if (RegRecPtr->ChangedCopy)
+                {
+                    /* Only the range which was changed since this buffer last matched needs to be copied */
+                    memcpy((uint8 *)(*WorkingBufferPtr)->BufferPtr + (*WorkingBufferPtr)->DirtyOffset,
+                           (const uint8 *)RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr +
+                               (*WorkingBufferPtr)->DirtyOffset,
+                           (*WorkingBufferPtr)->DirtyBytes);
+                }
+                else
+                {
+                    memcpy((*WorkingBufferPtr)->BufferPtr, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
+                           RegRecPtr->Size);
+                }
+                (*WorkingBufferPtr)->DirtyBytes = 0;
             }
         }
     }
@@ -804,7 +1013,12 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     osal_id_t          FileDescriptor;
     size_t             FilenameLen = strlen(Filename);
     uint32             NumBytes;
+    uint32             ChunkSize;
+    int32              ReadStatus;
+    uint32             Crc;
+    uint8 *            DataPtr;
     uint8              ExtraByte;
+    bool               UpdateCrc;
 
     if (FilenameLen > (OS_MAX_PATH_LEN - 1))
     {
@@ -871,8 +1085,47 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
         Status = CFE_TBL_WARN_SHORT_FILE;
     }
 
-    NumBytes =
-        OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset, TblFileHeader.NumBytes);
+    /* Mark the range as changed before changing it, so it is covered even if the read fails */
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, TblFileHeader.Offset, TblFileHeader.NumBytes);
+    UpdateCrc = CFE_TBL_CanUpdateCrc(RegRecPtr, WorkingBufferPtr);
+
+    /*
+     * Read the table image in chunks, and compute the CRC of each chunk while it is
+     * still in the cache, rather than making a second pass over the whole buffer.
+     * The CRC covers the entire table, including the parts this file does not load.
+     * When only part of a loaded table is changed, the CRC of the active buffer is
+     * updated for the change afterward instead.
+     */
+    DataPtr = WorkingBufferPtr->BufferPtr;
+    Crc     = 0;
+    if (!UpdateCrc)
+    {
+        Crc = CFE_ES_CalculateCRC(DataPtr, TblFileHeader.Offset, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+    }
+    DataPtr += TblFileHeader.Offset;
+    NumBytes = 0;
+
+    while (NumBytes < TblFileHeader.NumBytes)
+    {
+        ChunkSize = TblFileHeader.NumBytes - NumBytes;
+        if (ChunkSize > CFE_PLATFORM_TBL_LOAD_CHUNK_BYTES)
+        {
+            ChunkSize = CFE_PLATFORM_TBL_LOAD_CHUNK_BYTES;
+        }
+
+        ReadStatus = OS_read(FileDescriptor, DataPtr, ChunkSize);
+        if (ReadStatus <= 0)
+        {
+            break;
+        }
+
+        if (!UpdateCrc)
+        {
+            Crc = CFE_ES_CalculateCRC(DataPtr, ReadStatus, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+        }
+        DataPtr += ReadStatus;
+        NumBytes += ReadStatus;
+    }
 
     if (NumBytes != TblFileHeader.NumBytes)
     {
@@ -905,9 +1158,16 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     WorkingBufferPtr->FileCreateTimeSecs    = StdFileHeader.TimeSeconds;
     WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
 
-    /* Compute the CRC on the specified table buffer */
-    WorkingBufferPtr->Crc =
-        CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    if (UpdateCrc)
+    {
+        CFE_TBL_ComputeLoadCrc(RegRecPtr, WorkingBufferPtr);
+    }
+    else
+    {
+        /* Finish the CRC with the remainder of the table buffer */
+        WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(DataPtr, RegRecPtr->Size - (TblFileHeader.Offset + NumBytes), Crc,
+                                                    CFE_MISSION_ES_DEFAULT_CRC);
+    }
 
     OS_close(FileDescriptor);
 
@@ -925,9 +1185,10 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
 int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *RegRecPtr,
                              CFE_TBL_AccessDescriptor_t *AccessDescPtr)
 {
-    int32            Status = CFE_SUCCESS;
-    CFE_TBL_Handle_t AccessIterator;
-    bool             LockStatus = false;
+    int32               Status = CFE_SUCCESS;
+    CFE_TBL_Handle_t    AccessIterator;
+    bool                LockStatus = false;
+    CFE_TBL_LoadBuff_t *WorkingBufferPtr;
 
     if ((!RegRecPtr->LoadPending) || (RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS))
     {
@@ -941,6 +1202,13 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
         {
             /* To update a double buffered table only requires a pointer swap */
             RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
+            ++RegRecPtr->UpdateCount;
+
+            /* The now inactive buffer only differs from the active buffer by what was just loaded */
+            RegRecPtr->Buffers[1U - RegRecPtr->ActiveBufferIndex].DirtyOffset =
+                RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DirtyOffset;
+            RegRecPtr->Buffers[1U - RegRecPtr->ActiveBufferIndex].DirtyBytes =
+                RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DirtyBytes;
 
             /* Source description in buffer should already have been updated by either */
             /* the LoadFromFile function or the Load function (when a memory load).    */
@@ -954,7 +1222,8 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
             /* If the table is a critical table, update the appropriate CDS with the new data */
             if (RegRecPtr->CriticalTable == true)
             {
-                CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+                CFE_TBL_UpdateCriticalTblCDS(RegRecPtr, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DirtyOffset,
+                                             RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DirtyBytes);
             }
         }
         else
@@ -977,11 +1246,24 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
             else
             {
                 /* To update a single buffered table requires a memcpy from working buffer */
-                if (RegRecPtr->Buffers[0].BufferPtr != CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr)
+                WorkingBufferPtr = &CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress];
+                if (RegRecPtr->Buffers[0].BufferPtr != WorkingBufferPtr->BufferPtr)
                 {
-                    memcpy(RegRecPtr->Buffers[0].BufferPtr,
-                           CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr, RegRecPtr->Size);
+                    if (RegRecPtr->ChangedCopy)
+                    {
+                        /* The rest of the working buffer is a copy of the active buffer */
+                        memcpy((uint8 *)RegRecPtr->Buffers[0].BufferPtr + WorkingBufferPtr->DirtyOffset,
+                               (const uint8 *)WorkingBufferPtr->BufferPtr + WorkingBufferPtr->DirtyOffset,
+                               WorkingBufferPtr->DirtyBytes);
+                    }
+                    else
+                    {
+                        memcpy(RegRecPtr->Buffers[0].BufferPtr, WorkingBufferPtr->BufferPtr, RegRecPtr->Size);
+                    }
                 }
+                RegRecPtr->Buffers[0].DirtyOffset = WorkingBufferPtr->DirtyOffset;
+                RegRecPtr->Buffers[0].DirtyBytes  = WorkingBufferPtr->DirtyBytes;
+                ++RegRecPtr->UpdateCount;
 
                 /* Save source description with active buffer */
                 strncpy(RegRecPtr->Buffers[0].DataSource,
@@ -1009,7 +1291,8 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
                 /* If the table is a critical table, update the appropriate CDS with the new data */
                 if (RegRecPtr->CriticalTable == true)
                 {
-                    CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+                    CFE_TBL_UpdateCriticalTblCDS(RegRecPtr, RegRecPtr->Buffers[0].DirtyOffset,
+                                                 RegRecPtr->Buffers[0].DirtyBytes);
                 }
             }
         }
@@ -1018,6 +1301,82 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_MarkBufferDirty
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_MarkBufferDirty(CFE_TBL_LoadBuff_t *BufferPtr, size_t Offset, size_t NumBytes)
+{
+    size_t DirtyEnd;
+
+    if (BufferPtr->DirtyBytes == 0)
+    {
+        BufferPtr->DirtyOffset = Offset;
+        BufferPtr->DirtyBytes  = NumBytes;
+    }
+    else
+    {
+        DirtyEnd = BufferPtr->DirtyOffset + BufferPtr->DirtyBytes;
+        if ((Offset + NumBytes) > DirtyEnd)
+        {
+            DirtyEnd = Offset + NumBytes;
+        }
+        if (Offset < BufferPtr->DirtyOffset)
+        {
+            BufferPtr->DirtyOffset = Offset;
+        }
+
+        BufferPtr->DirtyBytes = DirtyEnd - BufferPtr->DirtyOffset;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_CanUpdateCrc
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_CanUpdateCrc(const CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_LoadBuff_t *WorkingBufferPtr)
+{
+    return (RegRecPtr->ChangedCopy && RegRecPtr->TableLoadedOnce &&
+            WorkingBufferPtr->BufferPtr != RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr &&
+            WorkingBufferPtr->DirtyBytes < RegRecPtr->Size);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_ComputeLoadCrc
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ComputeLoadCrc(const CFE_TBL_RegistryRec_t *RegRecPtr, CFE_TBL_LoadBuff_t *WorkingBufferPtr)
+{
+    const CFE_TBL_LoadBuff_t *ActiveBufferPtr = &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex];
+    size_t                    Offset          = WorkingBufferPtr->DirtyOffset;
+
+    if (CFE_TBL_CanUpdateCrc(RegRecPtr, WorkingBufferPtr))
+    {
+        /* Only the dirty range differs from the active buffer */
+        WorkingBufferPtr->Crc =
+            CFE_ES_UpdateCRC(ActiveBufferPtr->Crc, (const uint8 *)ActiveBufferPtr->BufferPtr + Offset,
+                             (const uint8 *)WorkingBufferPtr->BufferPtr + Offset, WorkingBufferPtr->DirtyBytes,
+                             RegRecPtr->Size - (Offset + WorkingBufferPtr->DirtyBytes), CFE_MISSION_ES_DEFAULT_CRC);
+    }
+    else
+    {
+        WorkingBufferPtr->Crc =
+            CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_NotifyTblUsersOfUpdate
@@ -1329,14 +1688,27 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
+void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr, size_t Offset, size_t NumBytes)
 {
     CFE_TBL_CritRegRec_t *CritRegRecPtr = NULL;
 
     int32 Status;
 
-    /* Copy an image of the updated table to the CDS for safekeeping */
-    Status = CFE_ES_CopyToCDS(RegRecPtr->CDSHandle, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+    /*
+     * Copy an image of the updated table to the CDS for safekeeping.  If the CDS
+     * holds the previous image then only the part that changed needs to be written.
+     */
+    if (RegRecPtr->CDSInSync && (Offset > 0 || NumBytes < RegRecPtr->Size))
+    {
+        Status = CFE_ES_CopyToCDSRange(RegRecPtr->CDSHandle, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
+                                       Offset, NumBytes);
+    }
+    else
+    {
+        Status = CFE_ES_CopyToCDS(RegRecPtr->CDSHandle, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+    }
+
+    RegRecPtr->CDSInSync = (Status == CFE_SUCCESS);
 
     if (Status != CFE_SUCCESS)
     {
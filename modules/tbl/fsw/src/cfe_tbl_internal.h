@@ -172,6 +172,28 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle);
 */
 int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_ES_AppId_t ThisAppId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Locks the active buffer of a table for reading
+**
+** \par Description
+**        Records the current active buffer of the table in the access descriptor
+**        and marks the descriptor as locked, so that the buffer will not be reused
+**        for a load while the application is using it.
+**
+** \par Assumptions, External Events, and Notes:
+**        This does not take the registry lock.  If the table is updated while the
+**        lock is being recorded, the read is repeated so the returned buffer is
+**        always one that a later load will see as locked.
+**
+** \param[in, out]  AccessDescPtr Pointer to the access descriptor of the caller. *AccessDescPtr is updated
+** \param[in]       RegRecPtr     Pointer to the registry record of the table.
+**
+** \return Pointer to the locked buffer
+**
+*/
+void *CFE_TBL_LockActiveBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr, const CFE_TBL_RegistryRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Returns any pending non-error status code for the specified table.
@@ -198,7 +220,8 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle);
 **
 ** \par Description
 **        Locates given Table Name in the Table Registry and
-**        returns the appropriate Registry Index.
+**        returns the appropriate Registry Index.  Only the registry
+**        records in the name index bucket of the table name are compared.
 **
 ** \par Assumptions, External Events, and Notes:
 **          None
@@ -216,7 +239,8 @@ int16 CFE_TBL_FindTableInRegistry(const char *TblName);
 ** \brief Locates a free slot in the Table Registry.
 **
 ** \par Description
-**        Locates a free slot in the Table Registry.
+**        Locates a free slot in the Table Registry.  The lowest numbered
+**        free slot is returned, as found in the free registry mask.
 **
 ** \par Assumptions, External Events, and Notes:
 **        Note: This function assumes the registry has been locked.
@@ -230,7 +254,9 @@ int16 CFE_TBL_FindFreeRegistryEntry(void);
 ** \brief Locates a free Access Descriptor in the Table Handles Array.
 **
 ** \par Description
-**        Locates a free Access Descriptor in the Table Handles Array.
+**        Locates a free Access Descriptor in the Table Handles Array.  The
+**        lowest numbered free descriptor is returned, as found in the free
+**        handle mask.
 **
 ** \par Assumptions, External Events, and Notes:
 **        Note: This function assumes the registry has been locked.
@@ -239,6 +265,71 @@ int16 CFE_TBL_FindFreeRegistryEntry(void);
 */
 CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Computes the name index bucket of a Table Name
+**
+** \par Description
+**        Hashes the complete Table Name (FNV-1a) into one of the
+**        #CFE_TBL_NAME_INDEX_BUCKETS buckets of the Table Registry name index.
+**
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+** \param[in]  TblName - Pointer to character string containing complete
+**                       Table Name (of the format "AppName.TblName").
+**
+** \return Name index bucket of the Table Name
+*/
+uint32 CFE_TBL_HashTableName(const char *TblName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Rebuilds the Table Registry Index
+**
+** \par Description
+**        Clears the Table Registry name index and free masks, then files every
+**        registry record and access descriptor according to its current contents.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked, or that
+**        no other task can access it yet (during early initialization).
+*/
+void CFE_TBL_InitRegistryIndex(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Brings the Table Registry Index up to date with a registry record
+**
+** \par Description
+**        Files the registry record into the name index bucket of its name when
+**        the table has an owner, and removes it from the name index otherwise.
+**        The record is marked free when it has no owner and no access descriptors.
+**        This must be called after any change to the owner, name or access list
+**        of a registry record.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  RegIndx - Index of the registry record that was changed
+*/
+void CFE_TBL_UpdateRegistryIndex(int16 RegIndx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Brings the Table Registry Index up to date with an access descriptor
+**
+** \par Description
+**        Marks the access descriptor free when it is not used.  This must be
+**        called after any change to the used flag of an access descriptor.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  TblHandle - Handle of the access descriptor that was changed
+*/
+void CFE_TBL_UpdateHandleIndex(CFE_TBL_Handle_t TblHandle);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Creates a Full Table name from application name and table name
@@ -367,6 +458,64 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
 int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
                            const char *Filename);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Adds a range to the dirty range of a table buffer
+**
+** \par Description
+**        Extends the dirty range of the buffer so that it also covers the given range.
+**        The dirty range is a single range, so loads of separate parts of a table are
+**        covered by one range from the start of the first to the end of the last.
+**
+** \par Assumptions, External Events, and Notes:
+**        This should be called before the buffer contents are changed, so the range
+**        is also covered if the change does not complete.
+**
+** \param[in, out]  BufferPtr Pointer to the buffer being changed. *BufferPtr is updated
+** \param[in]       Offset    Offset of the first byte being changed.
+** \param[in]       NumBytes  Number of bytes being changed.
+**
+*/
+void CFE_TBL_MarkBufferDirty(CFE_TBL_LoadBuff_t *BufferPtr, size_t Offset, size_t NumBytes);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Determines if the CRC of a working buffer can be updated from the active buffer
+**
+** \par Description
+**        This is true when the table was registered with #CFE_TBL_OPT_CHANGED_COPY, the
+**        working buffer is a copy of the loaded active buffer except within its dirty
+**        range, and the dirty range is not the whole table.
+**
+** \par Assumptions, External Events, and Notes:
+**        This relies on the CRC of the active buffer being current.  Applications which
+**        select #CFE_TBL_OPT_CHANGED_COPY call #CFE_TBL_Modified after changing a table.
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry Entry for the table.
+** \param[in]  WorkingBufferPtr Pointer to the working buffer of the table.
+**
+** \return true if only the dirty range needs to be read to get the CRC, false otherwise
+**
+*/
+bool CFE_TBL_CanUpdateCrc(const CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_LoadBuff_t *WorkingBufferPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Computes the CRC of a working buffer after a load
+**
+** \par Description
+**        When possible, the CRC of the active buffer is updated for the contents of the
+**        dirty range, otherwise the CRC of the whole buffer is calculated.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]       RegRecPtr        Pointer to Table Registry Entry for the table.
+** \param[in, out]  WorkingBufferPtr Pointer to the working buffer. WorkingBufferPtr->Crc is updated
+**
+*/
+void CFE_TBL_ComputeLoadCrc(const CFE_TBL_RegistryRec_t *RegRecPtr, CFE_TBL_LoadBuff_t *WorkingBufferPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -510,13 +659,18 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
 **        source of the data contained in the table.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**        Only the given range is copied when the CDS is known to hold the
+**        previous active image, otherwise the whole table is copied.
 **
 ** \param[in]  RegRecPtr Pointer to Registry Record of Critical Table whose CDS
 **                       needs to be updated.
 **
+** \param[in]  Offset    Start of the range of the active buffer that changed.
+**
+** \param[in]  NumBytes  Size of the range of the active buffer that changed.
+**
 */
-void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr);
+void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr, size_t Offset, size_t NumBytes);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -77,6 +77,15 @@
 */
 #define CFE_TBL_NO_DUMP_PENDING (-1)
 
+/** \brief Number of hash buckets in the table name index */
+#define CFE_TBL_NAME_INDEX_BUCKETS CFE_PLATFORM_TBL_MAX_NUM_TABLES
+
+/** \brief Number of bits held in each word of a free entry mask */
+#define CFE_TBL_FREE_MASK_BITS 32
+
+/** \brief Number of words needed for a free entry mask covering the given number of entries */
+#define CFE_TBL_FREE_MASK_WORDS(n) (((n) + CFE_TBL_FREE_MASK_BITS - 1) / CFE_TBL_FREE_MASK_BITS)
+
 /************************  Internal Structure Definitions  *****************************/
 
 /*******************************************************************************/
@@ -131,6 +140,12 @@ typedef struct
 **     This structure holds a pointer to a table buffer along with its associated
 **     data such as the time from the file that was loaded into the buffer, whether
 **     the buffer has been allocated and a string describing the source of the data.
+**
+**     The dirty range tracks which part of a working buffer has been loaded since it
+**     was copied from the active buffer.  After a double buffered table is updated, the
+**     inactive buffer keeps the dirty range of the new active buffer, so that only that
+**     range has to be copied into it for the next load of a table registered with
+**     #CFE_TBL_OPT_CHANGED_COPY.  Other tables always copy the whole active buffer.
 */
 typedef struct
 {
@@ -138,6 +153,8 @@ typedef struct
     uint32 FileCreateTimeSecs;    /**< \brief File creation time from last file loaded into table */
     uint32 FileCreateTimeSubSecs; /**< \brief File creation time from last file loaded into table */
     uint32 Crc;                   /**< \brief Last calculated CRC for this buffer's contents */
+    size_t DirtyOffset;           /**< \brief Start of the range which may differ from the buffer it was copied from */
+    size_t DirtyBytes;            /**< \brief Size of the range which may differ, zero when they are the same */
     bool   Taken;                 /**< \brief Flag indicating whether buffer is in use */
     bool   Validated;             /**< \brief Flag indicating whether the buffer has been successfully validated */
     char   DataSource[OS_MAX_PATH_LEN]; /**< \brief Source of data put into buffer (filename or memory address) */
@@ -158,9 +175,9 @@ typedef struct
     CFE_TBL_Handle_t PrevLink;    /**< \brief Index of previous access descriptor in linked list */
     CFE_TBL_Handle_t NextLink;    /**< \brief Index of next access descriptor in linked list */
     bool             UsedFlag;    /**< \brief Indicates whether this descriptor is being used or not  */
-    bool             LockFlag;    /**< \brief Indicates whether thread is currently accessing table data */
+    volatile bool    LockFlag;    /**< \brief Indicates whether thread is currently accessing table data */
     bool             Updated;     /**< \brief Indicates table has been updated since last GetAddress call */
-    uint8            BufferIndex; /**< \brief Index of buffer currently being used */
+    volatile uint8   BufferIndex; /**< \brief Index of buffer currently being used */
 } CFE_TBL_AccessDescriptor_t;
 
 /*******************************************************************************/
@@ -183,21 +200,44 @@ typedef struct
     int32              ValidateActiveIndex; /**< \brief Index to Validation Request on Active Table Result data */
     int32              ValidateInactiveIndex; /**< \brief Index to Validation Request on Inactive Table Result data */
     int32              DumpControlIndex;      /**< \brief Index to Dump Control Block */
+    volatile uint32    UpdateCount;           /**< \brief Number of times the active table contents were updated */
     CFE_ES_CDSHandle_t CDSHandle;             /**< \brief Handle to Critical Data Store for Critical Tables */
     CFE_MSG_FcnCode_t  NotificationCC;  /**< \brief Command Code of an associated management notification message */
     bool               CriticalTable;   /**< \brief Flag indicating whether table is a Critical Table */
+    bool               CDSInSync;       /**< \brief Flag indicating the CDS holds a copy of the active buffer */
     bool               TableLoadedOnce; /**< \brief Flag indicating whether table has been loaded once or not */
     bool               LoadPending;     /**< \brief Flag indicating an inactive buffer is ready to be copied */
     bool               DumpOnly;        /**< \brief Flag indicating Table is NOT to be loaded */
     bool               DoubleBuffered;  /**< \brief Flag indicating Table has a dedicated inactive buffer */
     bool               UserDefAddr;     /**< \brief Flag indicating Table address was defined by Owner Application */
+    bool               ChangedCopy;     /**< \brief Flag indicating loads only copy the changed range of the table */
     bool               NotifyByMsg;     /**< \brief Flag indicating Table Services should notify owning App via message
                                                     when table requires management */
-    uint8 ActiveBufferIndex;            /**< \brief Index identifying which buffer is the active buffer */
-    char  Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
-    char  LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
+    volatile uint8 ActiveBufferIndex;               /**< \brief Index identifying which buffer is the active buffer */
+    char           Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
+    char           LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
 } CFE_TBL_RegistryRec_t;
 
+/*******************************************************************************/
+/**   \brief Table Registry Index
+**
+**     Lookup data kept alongside the Table Registry and Access Descriptor arrays,
+**     so that finding a table by name, a free registry record or a free access
+**     descriptor does not require a scan of the whole array.  Owned tables are
+**     chained into name hash buckets, and the free masks have a bit set for each
+**     free entry.  The contents are derived from the registry records and access
+**     descriptors, and are brought up to date by CFE_TBL_UpdateRegistryIndex and
+**     CFE_TBL_UpdateHandleIndex whenever those change.
+*/
+typedef struct
+{
+    int16  BucketHead[CFE_TBL_NAME_INDEX_BUCKETS];        /**< \brief First registry record in each name bucket */
+    int16  NextInBucket[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Next registry record in the same bucket */
+    int16  Bucket[CFE_PLATFORM_TBL_MAX_NUM_TABLES];       /**< \brief Bucket each registry record is chained into */
+    uint32 FreeRegistryMask[CFE_TBL_FREE_MASK_WORDS(CFE_PLATFORM_TBL_MAX_NUM_TABLES)]; /**< \brief Free records */
+    uint32 FreeHandleMask[CFE_TBL_FREE_MASK_WORDS(CFE_PLATFORM_TBL_MAX_NUM_HANDLES)];  /**< \brief Free descriptors */
+} CFE_TBL_RegistryIndex_t;
+
 /*******************************************************************************/
 /**   \brief Critical Table Registry Record
 **
@@ -329,6 +369,7 @@ typedef struct
     */
     CFE_TBL_AccessDescriptor_t Handles[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Array of Access Descriptors */
     CFE_TBL_RegistryRec_t      Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Array of Table Registry Records */
+    CFE_TBL_RegistryIndex_t    RegistryIndex; /**< \brief Name and free entry lookup data for the Registry */
     CFE_TBL_CritRegRec_t
                         CritReg[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES]; /**< \brief Array of Critical Table Registry Records */
     CFE_TBL_BufParams_t Buf; /**< \brief Parameters associated with Table Task's Memory Pool */
@@ -422,6 +422,9 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
 
                         if (Status == CFE_SUCCESS)
                         {
+                            /* Mark the range as changed before changing it, in case the read fails */
+                            CFE_TBL_MarkBufferDirty(WorkingBufferPtr, TblFileHeader.Offset, TblFileHeader.NumBytes);
+
                             /* Copy data from file into working buffer */
                             Status =
                                 OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
@@ -455,8 +458,7 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
                                     WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
 
                                     /* Compute the CRC on the specified table buffer */
-                                    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(
-                                        WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                                    CFE_TBL_ComputeLoadCrc(RegRecPtr, WorkingBufferPtr);
 
                                     /* Initialize validation flag with true if no Validation Function is required to be
                                      * called */
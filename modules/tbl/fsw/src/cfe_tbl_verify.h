@@ -41,6 +41,10 @@
 #error Shared buffers and table of size CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE cannot be greater than memory pool size of CFE_PLATFORM_TBL_BUF_MEMORY_BYTES!
 #endif
 
+#if CFE_PLATFORM_TBL_LOAD_CHUNK_BYTES <= 0
+#error CFE_PLATFORM_TBL_LOAD_CHUNK_BYTES must be greater than zero!
+#endif
+
 #if CFE_PLATFORM_TBL_MAX_NUM_HANDLES < CFE_PLATFORM_TBL_MAX_NUM_TABLES
 #error CFE_PLATFORM_TBL_MAX_NUM_HANDLES cannot be set less than CFE_PLATFORM_TBL_MAX_NUM_TABLES!
 #endif
@@ -142,6 +142,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_TBL_ReleaseAddress);
     UT_ADD_TEST(Test_CFE_TBL_GetAddresses);
     UT_ADD_TEST(Test_CFE_TBL_ReleaseAddresses);
+    UT_ADD_TEST(Test_CFE_TBL_SnapshotAddress);
     UT_ADD_TEST(Test_CFE_TBL_Validate);
     UT_ADD_TEST(Test_CFE_TBL_Manage);
     UT_ADD_TEST(Test_CFE_TBL_Update);
@@ -151,6 +152,8 @@ void UtTest_Setup(void)
 
     /* Miscellaneous cfe_tbl_internal.c tests */
     UT_ADD_TEST(Test_CFE_TBL_Internal);
+    UT_ADD_TEST(Test_CFE_TBL_DirtyRange);
+    UT_ADD_TEST(Test_CFE_TBL_RegistryIndex);
 }
 
 /*
@@ -165,6 +168,8 @@ void UT_InitializeTableRegistryNames()
         snprintf(CFE_TBL_Global.Registry[i].Name, CFE_TBL_MAX_FULL_NAME_LEN, "%d", i);
         CFE_TBL_Global.Registry[i].OwnerAppId = UT_TBL_APPID_2;
     }
+
+    CFE_TBL_InitRegistryIndex();
 }
 
 /*
@@ -217,6 +222,8 @@ void UT_ResetTableRegistry(void)
     CFE_TBL_Global.ValidationCounter = 0;
     CFE_TBL_Global.HkTlmTblRegIndex  = CFE_TBL_NOT_FOUND;
     CFE_TBL_Global.LastTblUpdated    = CFE_TBL_NOT_FOUND;
+
+    CFE_TBL_InitRegistryIndex();
 }
 
 /*
@@ -992,6 +999,7 @@ void Test_CFE_TBL_DumpCmd(void)
     strncpy(CFE_TBL_Global.Registry[2].Name, "DumpCmdTest", sizeof(CFE_TBL_Global.Registry[2].Name) - 1);
     CFE_TBL_Global.Registry[2].Name[sizeof(CFE_TBL_Global.Registry[2].Name) - 1] = '\0';
     CFE_TBL_Global.Registry[2].OwnerAppId                                        = AppID;
+    CFE_TBL_InitRegistryIndex();
     strncpy(DumpCmd.Payload.TableName, CFE_TBL_Global.Registry[2].Name, sizeof(DumpCmd.Payload.TableName) - 1);
     DumpCmd.Payload.TableName[sizeof(DumpCmd.Payload.TableName) - 1] = '\0';
     DumpCmd.Payload.ActiveTableFlag                                  = CFE_TBL_BufferSelect_ACTIVE;
@@ -1809,6 +1817,7 @@ void Test_CFE_TBL_Register(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_SEVERITY_ERROR);
     snprintf(TblName, CFE_MISSION_TBL_MAX_NAME_LENGTH, "UT_Table%d", CFE_PLATFORM_TBL_MAX_NUM_TABLES);
     CFE_TBL_Global.Handles[0].UsedFlag = false;
+    CFE_TBL_InitRegistryIndex();
     UtAssert_INT32_EQ(CFE_TBL_Register(&TblHandle2, TblName, sizeof(UT_Table1_t) + 1, CFE_TBL_OPT_DBL_BUFFER, NULL),
                       CFE_SEVERITY_ERROR);
     AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle2];
@@ -2298,6 +2307,82 @@ void Test_CFE_TBL_ReleaseAddresses(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test function that obtains and releases the address of a table
+** without validating the calling application
+*/
+void Test_CFE_TBL_SnapshotAddress(void)
+{
+    CFE_TBL_Handle_t            TblHandle;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
+    CFE_TBL_LoadBuff_t *        WorkingBufferPtr;
+    void *                      TblPtr;
+    uint32                      UpdateCount;
+
+    UtPrintf("Begin Test Snapshot Address");
+
+    /* Test setup - register a double buffered table */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&TblHandle, "UT_Table4", sizeof(UT_Table1_t), CFE_TBL_OPT_DBL_BUFFER,
+                                          Test_CFE_TBL_ValidationFunc));
+    AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+    /* Test response to a null table pointer and an invalid handle */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_SnapshotAddress(NULL, TblHandle), CFE_TBL_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TBL_SnapshotAddress(&TblPtr, CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
+    UtAssert_NULL(TblPtr);
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseSnapshot(CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
+
+    /* Test getting the address of a table that has not been loaded, without any call to ES */
+    UtAssert_INT32_EQ(CFE_TBL_SnapshotAddress(&TblPtr, TblHandle), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_ADDRESS_EQ(TblPtr, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+    CFE_UtAssert_TRUE(AccessDescPtr->LockFlag);
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseSnapshot(TblHandle), CFE_TBL_ERR_NEVER_LOADED);
+    CFE_UtAssert_FALSE(AccessDescPtr->LockFlag);
+    UtAssert_STUB_COUNT(CFE_ES_GetAppID, 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test that a pending update notification is reported once */
+    UT_InitData();
+    RegRecPtr->TableLoadedOnce = true;
+    AccessDescPtr->Updated     = true;
+    UtAssert_INT32_EQ(CFE_TBL_SnapshotAddress(&TblPtr, TblHandle), CFE_TBL_INFO_UPDATED);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReleaseSnapshot(TblHandle));
+    CFE_UtAssert_SUCCESS(CFE_TBL_SnapshotAddress(&TblPtr, TblHandle));
+
+    /* Test that a double buffered table can be updated while the snapshot
+     * is held, and that the old buffer is not reused until it is released
+     */
+    UpdateCount               = RegRecPtr->UpdateCount;
+    RegRecPtr->LoadPending    = true;
+    RegRecPtr->LoadInProgress = 1 - RegRecPtr->ActiveBufferIndex;
+    CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(TblHandle, RegRecPtr, AccessDescPtr));
+    UtAssert_UINT32_EQ(RegRecPtr->UpdateCount, UpdateCount + 1);
+    UtAssert_ADDRESS_EQ(TblPtr, RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].BufferPtr);
+
+    RegRecPtr->LoadPending    = false;
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    UtAssert_INT32_EQ(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseSnapshot(TblHandle), CFE_TBL_INFO_UPDATED);
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false));
+    UtAssert_ADDRESS_EQ(WorkingBufferPtr, &RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex]);
+
+    /* Test response to a table which has been unregistered by its owner */
+    UT_InitData();
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    RegRecPtr->OwnerAppId     = CFE_TBL_NOT_OWNED;
+    UtAssert_INT32_EQ(CFE_TBL_SnapshotAddress(&TblPtr, TblHandle), CFE_TBL_ERR_UNREGISTERED);
+    UtAssert_NULL(TblPtr);
+
+    /* Restore the owner and remove the table so it does not affect subsequent tests */
+    RegRecPtr->OwnerAppId = UT_TBL_APPID_1;
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(TblHandle));
+}
+
 /*
 ** Test function for validating the table image for a specified table
 */
@@ -2931,6 +3016,7 @@ void Test_CFE_TBL_Internal(void)
     RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
     strncpy(RegRecPtr->Name, "ut_cfe_tbl.UT_Table3", sizeof(RegRecPtr->Name) - 1);
     RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = '\0';
+    CFE_TBL_InitRegistryIndex();
     RegRecPtr->TableLoadedOnce                   = false;
     RegRecPtr->LoadInProgress                    = CFE_TBL_NO_LOAD_IN_PROGRESS;
     CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true));
@@ -3016,6 +3102,19 @@ void Test_CFE_TBL_Internal(void)
     CFE_UtAssert_EVENTSENT(CFE_TBL_FILE_INCOMPLETE_ERR_EID);
     CFE_UtAssert_EVENTCOUNT(1);
 
+    /* Test CFE_TBL_LoadFromFile response to the file content being
+     * returned by more than one read
+     */
+    UT_InitData();
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, sizeof(UT_Table1_t) - 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    CFE_UtAssert_SUCCESS(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename));
+    UtAssert_STUB_COUNT(OS_read, 4);
+    CFE_UtAssert_EVENTCOUNT(0);
+
     /* Test CFE_TBL_LoadFromFile response to the file being for the
      * wrong table
      */
@@ -3460,6 +3559,7 @@ void Test_CFE_TBL_Internal(void)
     UT_InitData();
     CFE_TBL_Global.Registry[0].OwnerAppId       = CFE_TBL_NOT_OWNED;
     CFE_TBL_Global.Registry[0].HeadOfAccessList = CFE_TBL_END_OF_LIST + 1;
+    CFE_TBL_InitRegistryIndex();
     UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 1);
     CFE_UtAssert_EVENTCOUNT(0);
 
@@ -3521,6 +3621,42 @@ void Test_CFE_TBL_Internal(void)
     CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(App1TblHandle2, RegRecPtr, AccessDescPtr));
     CFE_UtAssert_EVENTCOUNT(0);
 
+    /* Test CFE_TBL_UpdateInternal on a critical table, where the whole table is
+     * copied to the CDS until the CDS is known to hold the previous image
+     */
+    UT_InitData();
+    RegRecPtr->LoadPending                                          = true;
+    RegRecPtr->LoadInProgress                                       = CFE_TBL_NO_LOAD_IN_PROGRESS + 1;
+    RegRecPtr->CriticalTable                                        = true;
+    RegRecPtr->CDSInSync                                            = false;
+    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DirtyOffset = 1;
+    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DirtyBytes  = 1;
+    CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(App1TblHandle2, RegRecPtr, AccessDescPtr));
+    CFE_UtAssert_ATLEAST(UT_GetStubCount(UT_KEY(CFE_ES_CopyToCDS)), 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDSRange, 0);
+    CFE_UtAssert_TRUE(RegRecPtr->CDSInSync);
+
+    /* After that, only the changed range is copied */
+    UT_InitData();
+    RegRecPtr->LoadPending                                          = true;
+    RegRecPtr->LoadInProgress                                       = CFE_TBL_NO_LOAD_IN_PROGRESS + 1;
+    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DirtyOffset = 1;
+    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DirtyBytes  = 1;
+    CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(App1TblHandle2, RegRecPtr, AccessDescPtr));
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDSRange, 1);
+    CFE_UtAssert_TRUE(RegRecPtr->CDSInSync);
+
+    /* A failed copy means the next one has to copy the whole table again */
+    UT_InitData();
+    RegRecPtr->LoadPending                                          = true;
+    RegRecPtr->LoadInProgress                                       = CFE_TBL_NO_LOAD_IN_PROGRESS + 1;
+    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DirtyOffset = 1;
+    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DirtyBytes  = 1;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDSRange), 1, CFE_ES_CDS_ACCESS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(App1TblHandle2, RegRecPtr, AccessDescPtr));
+    CFE_UtAssert_FALSE(RegRecPtr->CDSInSync);
+    RegRecPtr->CriticalTable = false;
+
     /* Test application cleanup where there are no dumped tables to delete and
      * the application doesn't own the table
      */
@@ -3605,3 +3741,259 @@ int32 Test_CFE_TBL_ValidationFunc(void *TblPtr)
 {
     return UT_DEFAULT_IMPL(Test_CFE_TBL_ValidationFunc);
 }
+
+/*
+** Test that partial loads of tables registered with CFE_TBL_OPT_CHANGED_COPY only
+** copy and CRC the range of the table that changed, and that other tables do not
+*/
+void Test_CFE_TBL_DirtyRange(void)
+{
+    CFE_TBL_Handle_t       DblTblHandle;
+    CFE_TBL_Handle_t       SnglTblHandle;
+    CFE_TBL_Handle_t       FullDblTblHandle;
+    CFE_TBL_Handle_t       FullSnglTblHandle;
+    CFE_TBL_RegistryRec_t *DblRegRecPtr;
+    CFE_TBL_RegistryRec_t *SnglRegRecPtr;
+    CFE_TBL_LoadBuff_t *   WorkingBufferPtr;
+    UT_Table1_t            TestTable;
+    uint8 *                ActivePtr;
+    uint8 *                WorkingPtr;
+
+    UtPrintf("Begin Test Dirty Range");
+
+    /* Test setup - register a double and a single buffered table, and load both */
+    UT_InitData();
+    Test_CFE_TBL_ApiInit();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UT_ResetPoolBufferIndex();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&DblTblHandle, "UT_Table1", sizeof(UT_Table1_t),
+                                          CFE_TBL_OPT_DBL_BUFFER | CFE_TBL_OPT_CHANGED_COPY, NULL));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&SnglTblHandle, "UT_Table2", sizeof(UT_Table1_t),
+                                          CFE_TBL_OPT_DEFAULT | CFE_TBL_OPT_CHANGED_COPY, NULL));
+    DblRegRecPtr  = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[DblTblHandle].RegIndex];
+    SnglRegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[SnglTblHandle].RegIndex];
+    UtAssert_UINT32_EQ(DblRegRecPtr->Buffers[1].DirtyOffset, 0);
+    UtAssert_UINT32_EQ(DblRegRecPtr->Buffers[1].DirtyBytes, sizeof(UT_Table1_t));
+
+    TestTable.TblElement1 = 0x01020304;
+    TestTable.TblElement2 = 0x05060708;
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(SnglTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+
+    /* Test combining ranges into the dirty range */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, DblRegRecPtr, false));
+    UtAssert_ADDRESS_EQ(WorkingBufferPtr, &DblRegRecPtr->Buffers[1]);
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyBytes, 0);
+    UtAssert_MemCmp(WorkingBufferPtr->BufferPtr, DblRegRecPtr->Buffers[0].BufferPtr, sizeof(UT_Table1_t),
+                    "Working buffer is a copy of the active buffer");
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 4, 2);
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 1, 1);
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyOffset, 1);
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyBytes, 5);
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 2, 1);
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyOffset, 1);
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyBytes, 5);
+
+    /* Test that the CRC of a partially loaded table is updated from the active buffer */
+    WorkingPtr    = WorkingBufferPtr->BufferPtr;
+    WorkingPtr[1] = 0xAA;
+    WorkingPtr[5] = 0xBB;
+    CFE_TBL_ComputeLoadCrc(DblRegRecPtr, WorkingBufferPtr);
+    UtAssert_STUB_COUNT(CFE_ES_UpdateCRC, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+
+    /* Test that activating the load leaves the dirty range with the now inactive buffer */
+    DblRegRecPtr->LoadPending = true;
+    CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(DblTblHandle, DblRegRecPtr, &CFE_TBL_Global.Handles[DblTblHandle]));
+    UtAssert_UINT32_EQ(DblRegRecPtr->ActiveBufferIndex, 1);
+    UtAssert_UINT32_EQ(DblRegRecPtr->Buffers[0].DirtyOffset, 1);
+    UtAssert_UINT32_EQ(DblRegRecPtr->Buffers[0].DirtyBytes, 5);
+
+    /* Test that the next load only needs the dirty range copied to match the active buffer */
+    DblRegRecPtr->LoadPending    = false;
+    DblRegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, DblRegRecPtr, false));
+    UtAssert_ADDRESS_EQ(WorkingBufferPtr, &DblRegRecPtr->Buffers[0]);
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyBytes, 0);
+    UtAssert_MemCmp(WorkingBufferPtr->BufferPtr, DblRegRecPtr->Buffers[1].BufferPtr, sizeof(UT_Table1_t),
+                    "Working buffer is a copy of the active buffer");
+
+    /* Test that a whole table load calculates the CRC over the whole table */
+    UT_InitData();
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 0, sizeof(UT_Table1_t));
+    CFE_TBL_ComputeLoadCrc(DblRegRecPtr, WorkingBufferPtr);
+    UtAssert_STUB_COUNT(CFE_ES_UpdateCRC, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+    DblRegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+    /* Test that a change by the application requires the whole inactive buffer to be copied */
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Modified(DblTblHandle));
+    UtAssert_UINT32_EQ(DblRegRecPtr->Buffers[0].DirtyOffset, 0);
+    UtAssert_UINT32_EQ(DblRegRecPtr->Buffers[0].DirtyBytes, sizeof(UT_Table1_t));
+
+    /* Test that activating a single buffered table only copies the dirty range */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, SnglRegRecPtr, false));
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyBytes, 0);
+    WorkingPtr = WorkingBufferPtr->BufferPtr;
+    ActivePtr  = SnglRegRecPtr->Buffers[0].BufferPtr;
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 2, 2);
+    WorkingPtr[2] = 0xCC;
+    WorkingPtr[3] = 0xDD;
+    WorkingPtr[6] = 0xEE; /* outside of the dirty range, as if the active buffer was changed after the copy */
+    SnglRegRecPtr->LoadPending = true;
+    CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(SnglTblHandle, SnglRegRecPtr, &CFE_TBL_Global.Handles[SnglTblHandle]));
+    UtAssert_UINT32_EQ(ActivePtr[2], 0xCC);
+    UtAssert_UINT32_EQ(ActivePtr[3], 0xDD);
+    UtAssert_UINT32_EQ(ActivePtr[6], ((uint8 *)&TestTable)[6]);
+    UtAssert_UINT32_EQ(SnglRegRecPtr->Buffers[0].DirtyOffset, 2);
+    UtAssert_UINT32_EQ(SnglRegRecPtr->Buffers[0].DirtyBytes, 2);
+    CFE_UtAssert_FALSE(WorkingBufferPtr->Taken);
+
+    /* Test setup - register and load a double and a single buffered table with the default copy option */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(
+        CFE_TBL_Register(&FullDblTblHandle, "UT_Table3", sizeof(UT_Table1_t), CFE_TBL_OPT_DBL_BUFFER, NULL));
+    CFE_UtAssert_SUCCESS(
+        CFE_TBL_Register(&FullSnglTblHandle, "UT_Table4", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL));
+    DblRegRecPtr  = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[FullDblTblHandle].RegIndex];
+    SnglRegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[FullSnglTblHandle].RegIndex];
+    CFE_UtAssert_FALSE(DblRegRecPtr->ChangedCopy);
+    CFE_UtAssert_FALSE(SnglRegRecPtr->ChangedCopy);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(FullDblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(FullSnglTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+
+    /* Test that a change made in place without CFE_TBL_Modified is still copied into the next load */
+    UT_InitData();
+    ActivePtr    = DblRegRecPtr->Buffers[DblRegRecPtr->ActiveBufferIndex].BufferPtr;
+    ActivePtr[6] = 0x5A;
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, DblRegRecPtr, false));
+    UtAssert_UINT32_EQ(WorkingBufferPtr->DirtyBytes, 0);
+    UtAssert_MemCmp(WorkingBufferPtr->BufferPtr, ActivePtr, sizeof(UT_Table1_t),
+                    "Working buffer is a copy of the whole active buffer");
+
+    /* Test that the CRC of a partial load is calculated over the whole table */
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 2, 2);
+    CFE_UtAssert_FALSE(CFE_TBL_CanUpdateCrc(DblRegRecPtr, WorkingBufferPtr));
+    CFE_TBL_ComputeLoadCrc(DblRegRecPtr, WorkingBufferPtr);
+    UtAssert_STUB_COUNT(CFE_ES_UpdateCRC, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+    DblRegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+    /* Test that activating a single buffered table copies the whole working buffer */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, SnglRegRecPtr, false));
+    WorkingPtr = WorkingBufferPtr->BufferPtr;
+    ActivePtr  = SnglRegRecPtr->Buffers[0].BufferPtr;
+    CFE_TBL_MarkBufferDirty(WorkingBufferPtr, 2, 2);
+    WorkingPtr[2] = 0xCC;
+    WorkingPtr[6] = 0xEE;
+    SnglRegRecPtr->LoadPending = true;
+    CFE_UtAssert_SUCCESS(
+        CFE_TBL_UpdateInternal(FullSnglTblHandle, SnglRegRecPtr, &CFE_TBL_Global.Handles[FullSnglTblHandle]));
+    UtAssert_UINT32_EQ(ActivePtr[2], 0xCC);
+    UtAssert_UINT32_EQ(ActivePtr[6], 0xEE);
+    CFE_UtAssert_FALSE(WorkingBufferPtr->Taken);
+}
+
+/*
+** Test the table registry name index and free entry masks
+*/
+void Test_CFE_TBL_RegistryIndex(void)
+{
+    CFE_TBL_Handle_t OwnerHandle;
+    CFE_TBL_Handle_t OtherHandle;
+    CFE_TBL_Handle_t SharedHandle;
+    CFE_TBL_Handle_t CollideHandle;
+    int16            OwnerRegIndx;
+    char             TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH];
+    char             FullName[CFE_TBL_MAX_FULL_NAME_LEN];
+    uint32           i;
+
+    UtPrintf("Begin Test Registry Index");
+
+    /* Test setup - start from an empty registry, where every entry is free */
+    UT_InitData();
+    Test_CFE_TBL_ApiInit();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UT_ResetPoolBufferIndex();
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 0);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeHandle(), 0);
+
+    /* Test that registered tables are found by name, and entries are handed out lowest first */
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&OwnerHandle, "UT_Table1", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&OtherHandle, "UT_Table2", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL));
+    UtAssert_INT32_EQ(OwnerHandle, 0);
+    UtAssert_INT32_EQ(OtherHandle, 1);
+    OwnerRegIndx = CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table1");
+    UtAssert_INT32_EQ(OwnerRegIndx, 0);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2"), 1);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table3"), CFE_TBL_NOT_FOUND);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 2);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeHandle(), 2);
+
+    /* Test that a shared table keeps its registry entry, but can no longer be found, after the owner unregisters */
+    UT_SetAppID(UT_TBL_APPID_2);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Share(&SharedHandle, "ut_cfe_tbl.UT_Table1"));
+    UtAssert_INT32_EQ(SharedHandle, 2);
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(OwnerHandle));
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table1"), CFE_TBL_NOT_FOUND);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 2);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeHandle(), 0);
+
+    /* Test that the registry entry is free once the last access descriptor is removed */
+    UT_SetAppID(UT_TBL_APPID_2);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(SharedHandle));
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), OwnerRegIndx);
+
+    /* Test that a table registered in a reused entry is found by name */
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&OwnerHandle, "UT_Table3", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL));
+    UtAssert_INT32_EQ(OwnerHandle, 0);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table3"), OwnerRegIndx);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2"), 1);
+
+    /* Test that tables whose names fall in the same bucket are told apart */
+    i = 0;
+    do
+    {
+        snprintf(TblName, sizeof(TblName), "Collide%u", (unsigned int)i);
+        snprintf(FullName, sizeof(FullName), "ut_cfe_tbl.%s", TblName);
+        i++;
+    } while (CFE_TBL_HashTableName(FullName) != CFE_TBL_HashTableName("ut_cfe_tbl.UT_Table3"));
+
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(FullName), CFE_TBL_NOT_FOUND);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&CollideHandle, TblName, sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL));
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(FullName), 2);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table3"), OwnerRegIndx);
+
+    /* Test removing a table which is not at the head of its bucket */
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(OwnerHandle));
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table3"), CFE_TBL_NOT_FOUND);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(FullName), 2);
+
+    /* Test that entries which are no longer free are skipped over */
+    CFE_TBL_Global.Registry[OwnerRegIndx].OwnerAppId = UT_TBL_APPID_2;
+    CFE_TBL_Global.Handles[OwnerHandle].UsedFlag     = true;
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 3);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeHandle(), 3);
+
+    /* Test that rebuilding the index picks up entries which were freed outside of the table services */
+    CFE_TBL_Global.Registry[OwnerRegIndx].OwnerAppId = CFE_TBL_NOT_OWNED;
+    CFE_TBL_Global.Handles[OwnerHandle].UsedFlag     = false;
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 3);
+    CFE_TBL_InitRegistryIndex();
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), OwnerRegIndx);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeHandle(), OwnerHandle);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(FullName), 2);
+
+    /* Clean up */
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(CollideHandle));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(OtherHandle));
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 0);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeHandle(), 0);
+}
@@ -532,6 +532,23 @@ void Test_CFE_TBL_GetAddresses(void);
 ******************************************************************************/
 void Test_CFE_TBL_ReleaseAddresses(void);
 
+/*****************************************************************************/
+/**
+** \brief Test function that obtains and releases the address of a table
+**        without validating the calling application
+**
+** \par Description
+**        This function tests CFE_TBL_SnapshotAddress and CFE_TBL_ReleaseSnapshot,
+**        including an update of the table while the address is held.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_SnapshotAddress(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function for validating the table image for a specified table
@@ -648,6 +665,39 @@ void Test_CFE_TBL_TblMod(void);
 ******************************************************************************/
 void Test_CFE_TBL_Internal(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the tracking of the changed range of table buffers
+**
+** \par Description
+**        This function tests that partial table loads only copy and compute
+**        the CRC of the range of the table which was changed.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_DirtyRange(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the table registry name index and free entry masks
+**
+** \par Description
+**        This function tests finding tables by name through the name hash
+**        index, and finding free registry entries and access descriptors
+**        through the free entry masks.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_RegistryIndex(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function executed when the contents of a table need to be
@@ -71,25 +71,10 @@ CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_GetTAI(void)
 {
-    CFE_TIME_Reference_t Reference;
-    CFE_TIME_SysTime_t   tai;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
     /*
-    ** Get reference time values (local time, time at tone, etc.)...
+    ** Current TAI from the precomputed reference offset...
     */
-    CFE_TIME_GetReference(&Reference);
-
-    /*
-    ** Calculate current TAI...
-    */
-    tai = CFE_TIME_CalculateTAI(&Reference);
-
-    return (tai);
+    return CFE_TIME_GetFastTime(CFE_TIME_FastRef_TAI);
 }
 
 /*----------------------------------------------------------------
@@ -102,24 +87,10 @@ CFE_TIME_SysTime_t CFE_TIME_GetTAI(void)
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_GetUTC(void)
 {
-    CFE_TIME_Reference_t Reference;
-    CFE_TIME_SysTime_t   utc;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
     /*
-    ** Get reference time values (local time, time at tone, etc.)...
+    ** Current UTC from the precomputed reference offset...
     */
-    CFE_TIME_GetReference(&Reference);
-
-    /*
-    ** Calculate current UTC...
-    */
-    utc = CFE_TIME_CalculateUTC(&Reference);
-
-    return (utc);
+    return CFE_TIME_GetFastTime(CFE_TIME_FastRef_UTC);
 }
 
 /*----------------------------------------------------------------
@@ -355,19 +326,7 @@ CFE_TIME_SysTime_t CFE_TIME_GetSTCF(void)
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_GetMET(void)
 {
-    CFE_TIME_Reference_t Reference;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
-    return (Reference.CurrentMET);
+    return CFE_TIME_GetFastTime(CFE_TIME_FastRef_MET);
 }
 
 /*----------------------------------------------------------------
@@ -380,19 +339,7 @@ CFE_TIME_SysTime_t CFE_TIME_GetMET(void)
  *-----------------------------------------------------------------*/
 uint32 CFE_TIME_GetMETseconds(void)
 {
-    CFE_TIME_Reference_t Reference;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
-    return (Reference.CurrentMET.Seconds);
+    return CFE_TIME_GetFastTime(CFE_TIME_FastRef_MET).Seconds;
 }
 
 /*----------------------------------------------------------------
@@ -405,19 +352,7 @@ uint32 CFE_TIME_GetMETseconds(void)
  *-----------------------------------------------------------------*/
 uint32 CFE_TIME_GetMETsubsecs(void)
 {
-    CFE_TIME_Reference_t Reference;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
-    return (Reference.CurrentMET.Subseconds);
+    return CFE_TIME_GetFastTime(CFE_TIME_FastRef_MET).Subseconds;
 }
 
 /*----------------------------------------------------------------
@@ -547,16 +482,12 @@ CFE_TIME_Compare_t CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t
  *-----------------------------------------------------------------*/
 uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds)
 {
-    OS_time_t tm;
-
     /*
-    ** Convert using the OSAL method.  Note that there
-    ** is no range check here because any uint32 value is valid,
-    ** and OSAL will handle and properly convert any input.
+    ** Sub-seconds are a 32-bit binary fraction of a second, so scaling by
+    ** one million and keeping the upper 32 bits gives whole microseconds.
+    ** Any uint32 input is valid, there is no range check.
     */
-    tm = OS_TimeAssembleFromSubseconds(0, SubSeconds);
-
-    return OS_TimeGetMicrosecondsPart(tm);
+    return (uint32)(((uint64)SubSeconds * 1000000) >> 32);
 }
 
 /*----------------------------------------------------------------
@@ -569,8 +500,7 @@ uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds)
  *-----------------------------------------------------------------*/
 uint32 CFE_TIME_Micro2SubSecs(uint32 MicroSeconds)
 {
-    OS_time_t tm;
-    uint32    SubSeconds;
+    uint32 SubSeconds;
 
     /*
     ** Conversion amount must be less than one second
@@ -583,10 +513,12 @@ uint32 CFE_TIME_Micro2SubSecs(uint32 MicroSeconds)
     else
     {
         /*
-        ** Convert micro-seconds count to sub-seconds (1/2^32) count using OSAL
+        ** Convert micro-seconds count to sub-seconds (1/2^32) count, rounding up...
         */
-        tm         = OS_TimeAssembleFromNanoseconds(0, MicroSeconds * 1000);
-        SubSeconds = OS_TimeGetSubsecondsPart(tm);
+        SubSeconds = (MicroSeconds * CFE_TIME_MICRO2SUB_WHOLE) +
+                     (uint32)((((uint64)MicroSeconds * CFE_TIME_MICRO2SUB_FRAC) +
+                               ((1ULL << CFE_TIME_MICRO2SUB_FRAC_SHIFT) - 1)) >>
+                              CFE_TIME_MICRO2SUB_FRAC_SHIFT);
     }
 
     return (SubSeconds);
@@ -609,6 +541,8 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     uint32 NumberOfSeconds;
     uint32 NumberOfMicros;
     uint32 DaysInThisYear;
+    uint32 YearStart;
+    uint32 YearCache;
 
     bool StillCountingYears = true;
 
@@ -647,49 +581,81 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     NumberOfDays  = (NumberOfHours / 24) + (CFE_MISSION_TIME_EPOCH_DAY - 1);
     NumberOfHours = (NumberOfHours % 24);
 
-    NumberOfYears = CFE_MISSION_TIME_EPOCH_YEAR;
-
     /*
-    ** Convert total number of days into years and remainder days...
+    ** Consecutive times are nearly always in the same year, so first check
+    ** the year found by the previous call...
     */
-    while (StillCountingYears)
+    YearCache = CFE_TIME_Global.PrintYearCache;
+    YearStart = YearCache & CFE_TIME_PRINT_YEAR_START_MASK;
+
+    if ((YearCache & CFE_TIME_PRINT_YEAR_VALID) != 0 && NumberOfDays >= YearStart &&
+        NumberOfDays < YearStart + (((YearCache & CFE_TIME_PRINT_YEAR_LEAP) != 0) ? 366 : 365))
     {
-        /*
-        ** Set number of days in this year (leap year?)...
-        */
+        NumberOfYears = CFE_MISSION_TIME_EPOCH_YEAR +
+                        ((YearCache >> CFE_TIME_PRINT_YEAR_OFFSET_SHIFT) & CFE_TIME_PRINT_YEAR_OFFSET_MASK);
+        NumberOfDays -= YearStart;
+    }
+    else
+    {
+        NumberOfYears  = CFE_MISSION_TIME_EPOCH_YEAR;
+        YearStart      = NumberOfDays;
         DaysInThisYear = 365;
 
-        if ((NumberOfYears % 4) == 0)
+        /*
+        ** Convert total number of days into years and remainder days...
+        */
+        while (StillCountingYears)
         {
-            if ((NumberOfYears % 100) != 0)
+            /*
+            ** Set number of days in this year (leap year?)...
+            */
+            DaysInThisYear = 365;
+
+            if ((NumberOfYears % 4) == 0)
             {
-                DaysInThisYear = 366;
+                if ((NumberOfYears % 100) != 0)
+                {
+                    DaysInThisYear = 366;
+                }
+                else if ((NumberOfYears % 400) == 0)
+                {
+                    DaysInThisYear = 366;
+                }
+                else
+                {
+                    /* Do Nothing. Non-leap year. */
+                }
             }
-            else if ((NumberOfYears % 400) == 0)
+
+            /*
+            ** When we have less than a years worth of days, we're done...
+            */
+            if (NumberOfDays < DaysInThisYear)
             {
-                DaysInThisYear = 366;
+                StillCountingYears = false;
             }
             else
             {
-                /* Do Nothing. Non-leap year. */
+                /*
+                ** Add a year and remove the number of days in that year...
+                */
+                NumberOfYears++;
+                NumberOfDays -= DaysInThisYear;
             }
         }
 
         /*
-        ** When we have less than a years worth of days, we're done...
+        ** Remember this year for the next call...
         */
-        if (NumberOfDays < DaysInThisYear)
+        YearStart -= NumberOfDays;
+        YearCache = CFE_TIME_PRINT_YEAR_VALID | (YearStart & CFE_TIME_PRINT_YEAR_START_MASK) |
+                    (((NumberOfYears - CFE_MISSION_TIME_EPOCH_YEAR) & CFE_TIME_PRINT_YEAR_OFFSET_MASK)
+                     << CFE_TIME_PRINT_YEAR_OFFSET_SHIFT);
+        if (DaysInThisYear == 366)
         {
-            StillCountingYears = false;
-        }
-        else
-        {
-            /*
-            ** Add a year and remove the number of days in that year...
-            */
-            NumberOfYears++;
-            NumberOfDays -= DaysInThisYear;
+            YearCache |= CFE_TIME_PRINT_YEAR_LEAP;
         }
+        CFE_TIME_Global.PrintYearCache = YearCache;
     }
 
     /*
@@ -698,9 +664,9 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     NumberOfDays++;
 
     /*
-    ** After computing microseconds, convert to 5 digits from 6 digits...
+    ** Convert sub-seconds directly to 5 digits (tens of microseconds)...
     */
-    NumberOfMicros = CFE_TIME_Sub2MicroSecs(TimeToPrint.Subseconds) / 10;
+    NumberOfMicros = (uint32)(((uint64)TimeToPrint.Subseconds * 100000) >> 32);
 
     /*
     ** Build formatted output string (yyyy-ddd-hh:mm:ss.xxxxx)...
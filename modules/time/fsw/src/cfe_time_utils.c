@@ -75,6 +75,57 @@ volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void)
     return NextState;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TIME_SetReferenceOffsets
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_SetReferenceOffsets(volatile CFE_TIME_ReferenceState_t *RefState)
+{
+    CFE_TIME_SysTime_t Offset;
+    CFE_TIME_SysTime_t LeapSeconds;
+
+    /*
+    ** MET = (CurrentLatch - AtToneLatch) + AtToneMET [+/- AtToneDelay]
+    **
+    ** Time arithmetic is modulo 2^32 seconds, so the terms that do not
+    ** depend on the current latch can be combined ahead of time.  The
+    ** local clock rollover is handled by the reader.
+    */
+    Offset = CFE_TIME_Subtract(RefState->AtToneMET, RefState->AtToneLatch);
+
+#if (CFE_PLATFORM_TIME_CFG_CLIENT == true)
+    if (RefState->DelayDirection == CFE_TIME_AdjustDirection_ADD)
+    {
+        Offset = CFE_TIME_Add(Offset, RefState->AtToneDelay);
+    }
+    else
+    {
+        Offset = CFE_TIME_Subtract(Offset, RefState->AtToneDelay);
+    }
+#endif
+
+    RefState->FastOffset[CFE_TIME_FastRef_MET] = Offset;
+
+    /*
+    ** TAI = MET + STCF
+    */
+    Offset = CFE_TIME_Add(Offset, RefState->AtToneSTCF);
+
+    RefState->FastOffset[CFE_TIME_FastRef_TAI] = Offset;
+
+    /*
+    ** UTC = TAI - Leap Seconds
+    */
+    LeapSeconds.Seconds    = RefState->AtToneLeapSeconds;
+    LeapSeconds.Subseconds = 0;
+
+    RefState->FastOffset[CFE_TIME_FastRef_UTC] = CFE_TIME_Subtract(Offset, LeapSeconds);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TIME_LatchClock
@@ -685,6 +736,71 @@ void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference)
     return;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TIME_GetFastTime
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_TIME_SysTime_t CFE_TIME_GetFastTime(CFE_TIME_FastRef_Enum_t Which)
+{
+    CFE_TIME_SysTime_t                  CurrentLatch;
+    CFE_TIME_SysTime_t                  AtToneLatch;
+    CFE_TIME_SysTime_t                  Offset;
+    uint32                              VersionCounter;
+    uint32                              RetryCount = 4;
+    volatile CFE_TIME_ReferenceState_t *RefState;
+
+    /*
+    ** Same versioned read as CFE_TIME_GetReference(), but only the
+    ** values needed to compute the requested time are copied.
+    */
+    while (true)
+    {
+        VersionCounter = CFE_TIME_Global.LastVersionCounter;
+        RefState       = &CFE_TIME_Global.ReferenceState[VersionCounter & CFE_TIME_REFERENCE_BUF_MASK];
+
+        CurrentLatch = CFE_TIME_LatchClock();
+        AtToneLatch  = RefState->AtToneLatch;
+        Offset       = RefState->FastOffset[Which];
+
+        if (VersionCounter == RefState->StateVersion)
+        {
+            /* successful read */
+            break;
+        }
+
+        if (RetryCount == 0)
+        {
+            /* unsuccessful read */
+            break;
+        }
+
+        --RetryCount;
+    }
+
+    if (RetryCount == 0)
+    {
+        /* set the flag that indicates this failed, and return zero time as GetReference does */
+        CFE_TIME_Global.GetReferenceFail = true;
+
+        memset(&CurrentLatch, 0, sizeof(CurrentLatch));
+        return CurrentLatch;
+    }
+
+    /*
+    ** Local clock has rolled over since last tone...
+    */
+    if (CFE_TIME_Compare(CurrentLatch, AtToneLatch) == CFE_TIME_A_LT_B)
+    {
+        CurrentLatch = CFE_TIME_Add(CurrentLatch, CFE_TIME_Global.MaxLocalClock);
+    }
+
+    return CFE_TIME_Add(CurrentLatch, Offset);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TIME_CalculateTAI
@@ -99,6 +99,34 @@
 #define CFE_TIME_REFERENCE_BUF_DEPTH 4
 #define CFE_TIME_REFERENCE_BUF_MASK  (CFE_TIME_REFERENCE_BUF_DEPTH - 1)
 
+/*
+ * Fixed-point constants for sub-second conversions
+ *
+ * One microsecond is 2^32 / 10^6 = 4294.967296 sub-seconds.  The whole part
+ * is applied as a plain multiply, and the fractional part as a 44-bit
+ * fixed-point multiply, so the conversion needs no division.  Rounding up
+ * gives the same result as the OSAL conversion for every microsecond value.
+ */
+#define CFE_TIME_MICRO2SUB_WHOLE      4294
+#define CFE_TIME_MICRO2SUB_FRAC       0xF7A0B5ED8D3ULL /* 0.967296 * 2^44 */
+#define CFE_TIME_MICRO2SUB_FRAC_SHIFT 44
+
+/*
+ * Packed calendar year cache used by CFE_TIME_Print()
+ *
+ * Holds the year that the last printed time fell in, as a single 32-bit word
+ * so that it is always read and written consistently from any task:
+ *   - the day number (days since Jan 1 of the epoch year) of Jan 1 of the year
+ *   - the year, as an offset from the epoch year
+ *   - whether the year is a leap year
+ *   - a valid flag
+ */
+#define CFE_TIME_PRINT_YEAR_START_MASK   0x0000FFFF
+#define CFE_TIME_PRINT_YEAR_OFFSET_SHIFT 16
+#define CFE_TIME_PRINT_YEAR_OFFSET_MASK  0x000000FF
+#define CFE_TIME_PRINT_YEAR_LEAP         0x01000000
+#define CFE_TIME_PRINT_YEAR_VALID        0x80000000
+
 /*************************************************************************/
 
 /*
@@ -129,6 +157,20 @@ typedef struct
     volatile CFE_TIME_SynchCallbackPtr_t Ptr; /**< \brief Pointer to Callback function */
 } CFE_TIME_SynchCallbackRegEntry_t;
 
+/*
+** Precomputed offsets kept with each time reference state...
+**
+** Each offset is the value to add to the local clock latch to get the
+** corresponding time directly, without going through the tone values.
+*/
+typedef enum
+{
+    CFE_TIME_FastRef_MET, /* AtToneMET [+/- AtToneDelay] - AtToneLatch */
+    CFE_TIME_FastRef_TAI, /* MET offset + AtToneSTCF */
+    CFE_TIME_FastRef_UTC, /* TAI offset - AtToneLeapSeconds */
+    CFE_TIME_FastRef_MAX
+} CFE_TIME_FastRef_Enum_t;
+
 /*
 ** Data values used to compute time (in reference to "tone")...
 **
@@ -150,6 +192,8 @@ typedef struct
     CFE_TIME_SysTime_t AtToneDelay;
     CFE_TIME_SysTime_t AtToneLatch;
 
+    CFE_TIME_SysTime_t FastOffset[CFE_TIME_FastRef_MAX];
+
 } CFE_TIME_ReferenceState_t;
 
 /*************************************************************************/
@@ -261,6 +305,11 @@ typedef struct
     */
     bool GetReferenceFail;
 
+    /*
+    ** Calendar year of the last time printed by "CFE_TIME_Print()"...
+    */
+    volatile uint32 PrintYearCache;
+
     /*
     ** Local 1Hz wake-up command packet (not related to time at tone)...
     */
@@ -379,6 +428,22 @@ void CFE_TIME_GetHkData(const CFE_TIME_Reference_t *Reference);
  */
 void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the current time using the precomputed reference offsets
+ *
+ * Fast path for the time query APIs.  This latches the local clock once and
+ * adds the offset that was computed when the reference state was published,
+ * rather than recomputing MET, STCF, delay and leap seconds on every call.
+ *
+ * Follows the same versioned read as CFE_TIME_GetReference(), and returns
+ * zero time (and sets GetReferenceFail) if a consistent state cannot be read.
+ *
+ * @param[in] Which selects the time base (MET, TAI or UTC)
+ * @returns the current time in the selected time base
+ */
+CFE_TIME_SysTime_t CFE_TIME_GetFastTime(CFE_TIME_FastRef_Enum_t Which);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief calculate TAI from reference data
@@ -536,6 +601,16 @@ int32 CFE_TIME_ToneSendTime(CFE_TIME_SysTime_t NewTime);
  */
 volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Compute the fast path offsets for a time reference state
+ *
+ * Derives the FastOffset values from the tone values in the state record.
+ * Called just before the state is published, so readers always see offsets
+ * that are consistent with the rest of the record.
+ */
+void CFE_TIME_SetReferenceOffsets(volatile CFE_TIME_ReferenceState_t *RefState);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Complete an update to the global time reference data
@@ -545,6 +620,7 @@ volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void);
  */
 static inline void CFE_TIME_FinishReferenceUpdate(volatile CFE_TIME_ReferenceState_t *NextState)
 {
+    CFE_TIME_SetReferenceOffsets(NextState);
     CFE_TIME_Global.LastVersionCounter = NextState->StateVersion;
 }
 
@@ -173,6 +173,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_ResetArea);
     UT_ADD_TEST(Test_State);
     UT_ADD_TEST(Test_GetReference);
+    UT_ADD_TEST(Test_GetFastTime);
     UT_ADD_TEST(Test_Tone);
     UT_ADD_TEST(Test_1Hz);
     UT_ADD_TEST(Test_UnregisterSynchCallback);
@@ -780,13 +781,9 @@ void Test_ConvertTime(void)
     /* SC = MET + SCTF [- Leaps for UTC] */
     CFE_UtAssert_STRINGBUF_EQ(timeBuf, sizeof(timeBuf), expectedSCTime, strlen(expectedSCTime));
 
-    /* NOTE: Microseconds <-> Subseconds conversion routines are implemented
-     * as part of OS_time_t in OSAL, and are coverage tested there.  CFE time
-     * conversions are now just wrappers of these OSAL routines.
-
-     * This should only sanity-check basic values to get coverage of the CFE
-     * wrappers.  Testing of value corner cases / rounding should be limited to
-     * OSAL coverage test. */
+    /* NOTE: Microseconds <-> Subseconds conversion routines use fixed-point
+     * multiplies that give the same results as the OS_time_t conversions in
+     * OSAL, including the rounding, so check the values at each end of the range. */
 
     /* Test subseconds to microseconds conversion; zero subsecond value */
     UtAssert_UINT32_EQ(CFE_TIME_Sub2MicroSecs(0), 0);
@@ -802,6 +799,12 @@ void Test_ConvertTime(void)
     /* Test microseconds to subseconds conversion; zero microsecond value */
     UtAssert_UINT32_EQ(CFE_TIME_Micro2SubSecs(0), 0);
 
+    /* Test microseconds to subseconds conversion; results are rounded up */
+    UtAssert_UINT32_EQ(CFE_TIME_Micro2SubSecs(1), 4295);
+    UtAssert_UINT32_EQ(CFE_TIME_Micro2SubSecs(500000), 0x80000000);
+    UtAssert_UINT32_EQ(CFE_TIME_Micro2SubSecs(999999), 0xffffef3a);
+    UtAssert_UINT32_EQ(CFE_TIME_Sub2MicroSecs(CFE_TIME_Micro2SubSecs(999999)), 999999);
+
     /* Test microseconds to subseconds conversion; microseconds exceeds
      * maximum limit
      */
@@ -856,6 +859,36 @@ void Test_Print(void)
     CFE_TIME_Print(timeBuf, time);
     strcpy(expectedBuf, "2116-038-06:28:15.99999");
     CFE_UtAssert_STRINGBUF_EQ(timeBuf, sizeof(timeBuf), expectedBuf, sizeof(expectedBuf));
+
+    /* Test the last day of a leap year, then the same year again from the cached year */
+    time.Subseconds = 0;
+    time.Seconds    = 1041465599;
+
+    CFE_TIME_Print(timeBuf, time);
+    strcpy(expectedBuf, "2012-366-23:59:59.00000");
+    CFE_UtAssert_STRINGBUF_EQ(timeBuf, sizeof(timeBuf), expectedBuf, sizeof(expectedBuf));
+    CFE_UtAssert_TRUE((CFE_TIME_Global.PrintYearCache & CFE_TIME_PRINT_YEAR_LEAP) != 0);
+
+    time.Seconds = 1041465599 - 86400;
+
+    CFE_TIME_Print(timeBuf, time);
+    strcpy(expectedBuf, "2012-365-23:59:59.00000");
+    CFE_UtAssert_STRINGBUF_EQ(timeBuf, sizeof(timeBuf), expectedBuf, sizeof(expectedBuf));
+
+    /* Test the next second, which is outside of the cached year */
+    time.Seconds = 1041465600;
+
+    CFE_TIME_Print(timeBuf, time);
+    strcpy(expectedBuf, "2013-001-00:00:00.00000");
+    CFE_UtAssert_STRINGBUF_EQ(timeBuf, sizeof(timeBuf), expectedBuf, sizeof(expectedBuf));
+    CFE_UtAssert_FALSE((CFE_TIME_Global.PrintYearCache & CFE_TIME_PRINT_YEAR_LEAP) != 0);
+
+    /* Test a time before the cached year */
+    time.Seconds = 0;
+
+    CFE_TIME_Print(timeBuf, time);
+    strcpy(expectedBuf, "1980-001-00:00:00.00000");
+    CFE_UtAssert_STRINGBUF_EQ(timeBuf, sizeof(timeBuf), expectedBuf, sizeof(expectedBuf));
 }
 
 /*
@@ -1929,6 +1962,93 @@ void Test_GetReference(void)
     CFE_TIME_Global.GetReferenceFail = false;
 }
 
+/*
+** Test the time query fast path (precomputed reference offsets)
+*/
+void Test_GetFastTime(void)
+{
+    CFE_TIME_Reference_t                Reference;
+    volatile CFE_TIME_ReferenceState_t *RefState;
+    CFE_TIME_SysTime_t                  Expected;
+    uint32                              UpdateCount;
+
+    UtPrintf("Begin Test Get Fast Time");
+
+    /* Offsets are derived from the tone values when the state is published */
+    UT_InitData();
+    RefState                                 = CFE_TIME_StartReferenceUpdate();
+    RefState->AtToneMET.Seconds              = 20;
+    RefState->AtToneMET.Subseconds           = 0x80000000;
+    RefState->AtToneSTCF.Seconds             = 3600;
+    RefState->AtToneSTCF.Subseconds          = 0x40000000;
+    RefState->AtToneLeapSeconds              = 32;
+    RefState->AtToneDelay.Seconds            = 1;
+    RefState->AtToneDelay.Subseconds         = 0x10000000;
+    RefState->DelayDirection                 = CFE_TIME_AdjustDirection_ADD;
+    RefState->AtToneLatch.Seconds            = 10;
+    RefState->AtToneLatch.Subseconds         = 0xC0000000;
+    CFE_TIME_Global.MaxLocalClock.Seconds    = 1000;
+    CFE_TIME_Global.MaxLocalClock.Subseconds = 0;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+
+    /* Without local clock rollover, results match the reference computation */
+    UT_SetBSP_Time(15, 0);
+    CFE_TIME_GetReference(&Reference);
+    UT_SetBSP_Time(15, 0);
+    Expected = CFE_TIME_GetMET();
+    UtAssert_UINT32_EQ(Expected.Seconds, Reference.CurrentMET.Seconds);
+    UtAssert_UINT32_EQ(Expected.Subseconds, Reference.CurrentMET.Subseconds);
+    UT_SetBSP_Time(15, 0);
+    Expected = CFE_TIME_GetTAI();
+    UtAssert_UINT32_EQ(Expected.Seconds, CFE_TIME_CalculateTAI(&Reference).Seconds);
+    UtAssert_UINT32_EQ(Expected.Subseconds, CFE_TIME_CalculateTAI(&Reference).Subseconds);
+    UT_SetBSP_Time(15, 0);
+    Expected = CFE_TIME_GetUTC();
+    UtAssert_UINT32_EQ(Expected.Seconds, CFE_TIME_CalculateUTC(&Reference).Seconds);
+    UtAssert_UINT32_EQ(Expected.Subseconds, CFE_TIME_CalculateUTC(&Reference).Subseconds);
+
+    /* With local clock rollover, results still match the reference computation */
+    UT_SetBSP_Time(0, 0);
+    CFE_TIME_GetReference(&Reference);
+    UT_SetBSP_Time(0, 0);
+    Expected = CFE_TIME_GetMET();
+    UtAssert_UINT32_EQ(Expected.Seconds, Reference.CurrentMET.Seconds);
+    UtAssert_UINT32_EQ(Expected.Subseconds, Reference.CurrentMET.Subseconds);
+    UT_SetBSP_Time(0, 0);
+    UtAssert_UINT32_EQ(CFE_TIME_GetMETseconds(), Reference.CurrentMET.Seconds);
+    UT_SetBSP_Time(0, 0);
+    UtAssert_UINT32_EQ(CFE_TIME_GetMETsubsecs(), Reference.CurrentMET.Subseconds);
+    UT_SetBSP_Time(0, 0);
+    Expected = CFE_TIME_GetUTC();
+    UtAssert_UINT32_EQ(Expected.Seconds, CFE_TIME_CalculateUTC(&Reference).Seconds);
+    UtAssert_UINT32_EQ(Expected.Subseconds, CFE_TIME_CalculateUTC(&Reference).Subseconds);
+
+    /* Subtracted delay is folded into the offset as well */
+    RefState                 = CFE_TIME_StartReferenceUpdate();
+    RefState->DelayDirection = CFE_TIME_AdjustDirection_SUBTRACT;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+    UT_SetBSP_Time(15, 0);
+    CFE_TIME_GetReference(&Reference);
+    UT_SetBSP_Time(15, 0);
+    Expected = CFE_TIME_GetTAI();
+    UtAssert_UINT32_EQ(Expected.Seconds, CFE_TIME_CalculateTAI(&Reference).Seconds);
+    UtAssert_UINT32_EQ(Expected.Subseconds, CFE_TIME_CalculateTAI(&Reference).Subseconds);
+
+    /* If a consistent state cannot be read, the result is zero and the failure is flagged */
+    UT_InitData();
+    CFE_TIME_Global.GetReferenceFail = false;
+    UpdateCount                      = 1000000;
+    UT_SetHookFunction(UT_KEY(CFE_PSP_GetTime), UT_TimeRefUpdateHook, &UpdateCount);
+    Expected = CFE_TIME_GetTAI();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.GetReferenceFail, true);
+    UtAssert_UINT32_EQ(Expected.Seconds, 0);
+    UtAssert_UINT32_EQ(Expected.Subseconds, 0);
+
+    CFE_TIME_Global.GetReferenceFail         = false;
+    CFE_TIME_Global.MaxLocalClock.Seconds    = 0;
+    CFE_TIME_Global.MaxLocalClock.Subseconds = 0;
+}
+
 /*
 ** Test send tone, and validate tone and data packet functions
 */
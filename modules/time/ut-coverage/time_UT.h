@@ -288,6 +288,22 @@ void Test_State(void);
 ******************************************************************************/
 void Test_GetReference(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the time query fast path
+**
+** \par Description
+**        This function tests that the precomputed reference offsets give
+**        the same MET, TAI and UTC as the full reference computation.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetFastTime(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send tone, and validate tone and data packet functions